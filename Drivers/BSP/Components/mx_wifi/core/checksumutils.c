@@ -37,30 +37,77 @@
 /* As the CRC is 16-bit long, the init value is 16-bit long as well */
 #define CRC_INIT_VALUE      0x0000 /* 0x5AB */
 
-#endif /* USE_STM32L_CRC */
+/* CRC16_Update uses the CRC peripheral from this length on, once HW_CRC16_Init has been called. */
+#ifndef CRC16_HW_MIN_SIZE
+#define CRC16_HW_MIN_SIZE   (64U)
+#endif /* CRC16_HW_MIN_SIZE */
 
-static uint8_t UpdateCRC8(uint8_t crcIn, uint8_t byte);
+/* CRC peripheral handle initialized by HW_CRC16_Init. */
+static CRC_HandleTypeDef *Crc16HwHandle = NULL;
 
-static uint8_t UpdateCRC8(uint8_t crcIn, uint8_t byte)
-{
-  uint8_t crc = crcIn;
-  uint8_t i;
+/* Set while a CRC16_Update call owns the CRC peripheral, concurrent calls use the table. */
+static volatile uint32_t Crc16HwBusy = 0U;
 
-  crc ^= byte;
+#endif /* USE_STM32L_CRC */
+
+/* CRC8 of each byte value (reflected polynomial 0x8C), one table lookup per input byte. */
+static const uint8_t Crc8Table[256] =
+{
+  0x00u, 0x5Eu, 0xBCu, 0xE2u, 0x61u, 0x3Fu, 0xDDu, 0x83u, 0xC2u, 0x9Cu, 0x7Eu, 0x20u, 0xA3u, 0xFDu, 0x1Fu, 0x41u,
+  0x9Du, 0xC3u, 0x21u, 0x7Fu, 0xFCu, 0xA2u, 0x40u, 0x1Eu, 0x5Fu, 0x01u, 0xE3u, 0xBDu, 0x3Eu, 0x60u, 0x82u, 0xDCu,
+  0x23u, 0x7Du, 0x9Fu, 0xC1u, 0x42u, 0x1Cu, 0xFEu, 0xA0u, 0xE1u, 0xBFu, 0x5Du, 0x03u, 0x80u, 0xDEu, 0x3Cu, 0x62u,
+  0xBEu, 0xE0u, 0x02u, 0x5Cu, 0xDFu, 0x81u, 0x63u, 0x3Du, 0x7Cu, 0x22u, 0xC0u, 0x9Eu, 0x1Du, 0x43u, 0xA1u, 0xFFu,
+  0x46u, 0x18u, 0xFAu, 0xA4u, 0x27u, 0x79u, 0x9Bu, 0xC5u, 0x84u, 0xDAu, 0x38u, 0x66u, 0xE5u, 0xBBu, 0x59u, 0x07u,
+  0xDBu, 0x85u, 0x67u, 0x39u, 0xBAu, 0xE4u, 0x06u, 0x58u, 0x19u, 0x47u, 0xA5u, 0xFBu, 0x78u, 0x26u, 0xC4u, 0x9Au,
+  0x65u, 0x3Bu, 0xD9u, 0x87u, 0x04u, 0x5Au, 0xB8u, 0xE6u, 0xA7u, 0xF9u, 0x1Bu, 0x45u, 0xC6u, 0x98u, 0x7Au, 0x24u,
+  0xF8u, 0xA6u, 0x44u, 0x1Au, 0x99u, 0xC7u, 0x25u, 0x7Bu, 0x3Au, 0x64u, 0x86u, 0xD8u, 0x5Bu, 0x05u, 0xE7u, 0xB9u,
+  0x8Cu, 0xD2u, 0x30u, 0x6Eu, 0xEDu, 0xB3u, 0x51u, 0x0Fu, 0x4Eu, 0x10u, 0xF2u, 0xACu, 0x2Fu, 0x71u, 0x93u, 0xCDu,
+  0x11u, 0x4Fu, 0xADu, 0xF3u, 0x70u, 0x2Eu, 0xCCu, 0x92u, 0xD3u, 0x8Du, 0x6Fu, 0x31u, 0xB2u, 0xECu, 0x0Eu, 0x50u,
+  0xAFu, 0xF1u, 0x13u, 0x4Du, 0xCEu, 0x90u, 0x72u, 0x2Cu, 0x6Du, 0x33u, 0xD1u, 0x8Fu, 0x0Cu, 0x52u, 0xB0u, 0xEEu,
+  0x32u, 0x6Cu, 0x8Eu, 0xD0u, 0x53u, 0x0Du, 0xEFu, 0xB1u, 0xF0u, 0xAEu, 0x4Cu, 0x12u, 0x91u, 0xCFu, 0x2Du, 0x73u,
+  0xCAu, 0x94u, 0x76u, 0x28u, 0xABu, 0xF5u, 0x17u, 0x49u, 0x08u, 0x56u, 0xB4u, 0xEAu, 0x69u, 0x37u, 0xD5u, 0x8Bu,
+  0x57u, 0x09u, 0xEBu, 0xB5u, 0x36u, 0x68u, 0x8Au, 0xD4u, 0x95u, 0xCBu, 0x29u, 0x77u, 0xF4u, 0xAAu, 0x48u, 0x16u,
+  0xE9u, 0xB7u, 0x55u, 0x0Bu, 0x88u, 0xD6u, 0x34u, 0x6Au, 0x2Bu, 0x75u, 0x97u, 0xC9u, 0x4Au, 0x14u, 0xF6u, 0xA8u,
+  0x74u, 0x2Au, 0xC8u, 0x96u, 0x15u, 0x4Bu, 0xA9u, 0xF7u, 0xB6u, 0xE8u, 0x0Au, 0x54u, 0xD7u, 0x89u, 0x6Bu, 0x35u
+};
+
+/* CRC16 of each byte value (polynomial 0x1021), one table lookup per input byte. */
+static const uint16_t Crc16Table[256] =
+{
+  0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+  0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+  0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+  0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+  0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+  0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+  0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+  0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+  0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+  0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+  0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+  0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+  0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+  0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+  0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+  0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+  0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+  0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+  0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+  0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+  0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+  0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+  0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+  0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+  0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+  0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+  0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+  0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+  0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+  0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+  0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+  0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+};
 
-  for (i = 0; i < (uint8_t)8; i++)
-  {
-    if ((crc & (uint8_t)0x01) > 0u)
-    {
-      crc = (uint8_t)(crc >> 1) ^ (uint8_t)0x8C;
-    }
-    else
-    {
-      crc >>= 1;
-    }
-  }
-  return crc;
-}
 
 
 void CRC8_Init(CRC8_Context *inContext)
@@ -74,11 +121,15 @@ void CRC8_Update(CRC8_Context *inContext, const uint8_t *inSrc, size_t inLen)
   const uint8_t *src = (const uint8_t *) inSrc;
   const uint8_t *const srcEnd = &src[inLen];
 
+  uint8_t crc = inContext->crc;
+
   while (src < srcEnd)
   {
-    inContext->crc = UpdateCRC8(inContext->crc, *src);
+    crc = Crc8Table[crc ^ *src];
     src++;
   }
+
+  inContext->crc = crc;
 }
 
 
@@ -182,6 +233,8 @@ int8_t HW_CRC16_Init(CRC_HandleTypeDef *CrcHandle)
     return -1;
   }
 
+  Crc16HwHandle = CrcHandle;
+
   return 0; /* init success */
 }
 
@@ -214,29 +267,32 @@ int8_t HW_CRC16_Update(CRC_HandleTypeDef *CrcHandle, uint8_t *input_data, uint32
   return 0;
 }
 
-#else  /* SOFTWARE CRC16 */
 
-static uint16_t UpdateCRC16(uint16_t crcIn, uint8_t byte)
+/* Claim the CRC peripheral without waiting, safe from threads and interrupts. */
+static uint32_t crc16_hw_claim(void)
 {
-  uint32_t crc = crcIn;
-  uint32_t in = (uint32_t)byte | (uint32_t)0x100;
-
   do
   {
-    crc <<= 1;
-    in <<= 1;
-    if ((in & (uint32_t)0x100) > 0u)
+    if (__LDREXW(&Crc16HwBusy) != 0U)
     {
-      ++crc;
+      __CLREX();
+      return 0U;
     }
-    if ((crc & (uint32_t)0x10000) > 0u)
-    {
-      crc ^= (uint32_t)0x1021;
-    }
-  } while (!((in & (uint32_t)0x10000) > 0u));
-  return (uint16_t)(crc & (uint32_t)0xffffu);
+  } while (__STREXW(1U, &Crc16HwBusy) != 0U);
+
+  __DMB();
+  return 1U;
 }
 
+
+static void crc16_hw_release(void)
+{
+  __DMB();
+  Crc16HwBusy = 0U;
+}
+#endif /* USE_STM32L_CRC */
+
+
 void CRC16_Init(CRC16_Context *inContext)
 {
   inContext->crc = 0;
@@ -247,20 +303,33 @@ void CRC16_Update(CRC16_Context *inContext, const uint8_t *inSrc, size_t inLen)
 {
   const uint8_t *src = (const uint8_t *) inSrc;
   const uint8_t *const srcEnd = &src[inLen];
+  uint16_t crc = inContext->crc;
+
+#ifdef USE_STM32L_CRC
+  /* INIT and DR hold the state of one computation: the peripheral is claimed for the */
+  /* whole computation, a concurrent call (other thread or interrupt) uses the table.  */
+  if ((NULL != Crc16HwHandle) && (inLen >= CRC16_HW_MIN_SIZE) && (crc16_hw_claim() != 0U))
+  {
+    /* Continue from the current CRC: it is the init value of the peripheral computation. */
+    WRITE_REG(Crc16HwHandle->Instance->INIT, crc);
+    __HAL_CRC_DR_RESET(Crc16HwHandle);
+    crc = (uint16_t)(HAL_CRC_Accumulate(Crc16HwHandle, (uint32_t *)inSrc, (uint32_t)inLen) & 0x0000FFFFu);
+    crc16_hw_release();
+    src = srcEnd;
+  }
+#endif /* USE_STM32L_CRC */
 
   while (src < srcEnd)
   {
-    inContext->crc = UpdateCRC16(inContext->crc, *src);
+    crc = (uint16_t)(crc << 8) ^ Crc16Table[(uint8_t)(crc >> 8) ^ *src];
     src++;
   }
+
+  inContext->crc = crc;
 }
 
 
 void CRC16_Final(CRC16_Context *inContext, uint16_t *outResult)
 {
-  inContext->crc = UpdateCRC16(inContext->crc, 0);
-  inContext->crc = UpdateCRC16(inContext->crc, 0);
   *outResult = inContext->crc & 0xffffu;
 }
-
-#endif /* USE_STM32L_CRC */
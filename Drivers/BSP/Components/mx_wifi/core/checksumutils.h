@@ -35,7 +35,7 @@ extern "C" {
 
 #ifdef USE_STM32L_CRC
 /*cstat -MISRAC2012-* */
-#include "stm32l4xx_hal.h"
+#include "stm32u5xx_hal.h"
 /*cstat +MISRAC2012-* */
 #endif /* USE_STM32L_CRC */
 
@@ -88,10 +88,22 @@ void CRC8_Final(CRC8_Context *inContext, uint8_t *outResult);
 
 #ifdef USE_STM32L_CRC
 
+/**
+  * @brief             initialize the CRC peripheral for CRC16
+  * @note              once initialized, CRC16_Update uses the peripheral for the long inputs.
+  *                    CRC16_Update claims the peripheral for each computation and falls back to
+  *                    the table when it is in use, so it may be called from several threads and
+  *                    interrupts. The peripheral must not be used by other code meanwhile,
+  *                    HW_CRC16_Update included, since INIT and DR are rewritten by each call.
+  *
+  * @param CrcHandle   CRC peripheral handle
+  *
+  * @retval            0 on success, -1 on failure
+  */
 int8_t HW_CRC16_Init(CRC_HandleTypeDef *CrcHandle);
 int8_t HW_CRC16_Update(CRC_HandleTypeDef *CrcHandle, uint8_t *input_data, uint32_t input_len, uint16_t *crc16_out);
 
-#else
+#endif /* USE_STM32L_CRC */
 
 typedef struct
 {
@@ -130,8 +142,6 @@ void CRC16_Update(CRC16_Context *inContext, const uint8_t *inSrc, size_t inLen);
   */
 void CRC16_Final(CRC16_Context *inContext, uint16_t *outResult);
 
-#endif /* USE_STM32L_CRC */
-
 
 #ifdef __cplusplus
 }
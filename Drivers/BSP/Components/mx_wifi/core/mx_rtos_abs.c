@@ -192,3 +192,164 @@ void *noos_fifo_pop(noos_queue_t *queue, uint32_t timeout, void (*idle_func)(uin
 }
 
 #endif /* MX_WIFI_USE_CMSIS_OS */
+
+
+#if (MX_WIFI_RX_BUFFER_POOL == 1) && \
+    ((MX_WIFI_USE_CMSIS_OS == 0) || (MX_WIFI_NETWORK_BYPASS_MODE == 0) || (MX_WIFI_NETWORK_BYPASS_LWIP == 0))
+/* Fixed size blocks able to hold a buffer of MX_WIFI_BUFFER_SIZE bytes. */
+#define MX_BUF_POOL_BLOCK_WORDS  ((sizeof(mx_buf_t) - 1U + MX_WIFI_BUFFER_SIZE + 3U) / 4U)
+#define MX_BUF_POOL_NONE         (0xFFFFFFFFU)
+
+#if defined(MX_WIFI_RX_BUFFER_POOL_SECTION)
+static uint32_t MxBufPool[MX_WIFI_RX_BUFFER_POOL_COUNT][MX_BUF_POOL_BLOCK_WORDS]
+__attribute__((section(MX_WIFI_RX_BUFFER_POOL_SECTION)));
+#else
+static uint32_t MxBufPool[MX_WIFI_RX_BUFFER_POOL_COUNT][MX_BUF_POOL_BLOCK_WORDS];
+#endif /* MX_WIFI_RX_BUFFER_POOL_SECTION */
+
+/* Free list of released blocks, linked by index. Blocks never used yet are taken in */
+/* order with MxBufPoolUnused so that the pool needs no initialization.              */
+static volatile uint32_t MxBufPoolFree = MX_BUF_POOL_NONE;
+static volatile uint32_t MxBufPoolUnused = 0U;
+static uint32_t MxBufPoolNext[MX_WIFI_RX_BUFFER_POOL_COUNT];
+
+static mx_buf_pool_stat_t MxBufPoolStat = {.count = MX_WIFI_RX_BUFFER_POOL_COUNT};
+
+
+/* Lock free update with exclusive accesses, safe from threads and interrupts. */
+static uint32_t mx_buf_pool_add(volatile uint32_t *value, uint32_t inc)
+{
+  uint32_t v;
+
+  do
+  {
+    v = __LDREXW(value) + inc;
+  } while (__STREXW(v, value) != 0U);
+
+  return v;
+}
+
+
+static uint32_t mx_buf_pool_take(void)
+{
+  uint32_t index;
+
+  /* Pop a released block. */
+  do
+  {
+    index = __LDREXW(&MxBufPoolFree);
+    if (MX_BUF_POOL_NONE == index)
+    {
+      __CLREX();
+      break;
+    }
+  } while (__STREXW(MxBufPoolNext[index], &MxBufPoolFree) != 0U);
+
+  /* Otherwise take a block never used yet. */
+  if (MX_BUF_POOL_NONE == index)
+  {
+    do
+    {
+      index = __LDREXW(&MxBufPoolUnused);
+      if (index >= (uint32_t)MX_WIFI_RX_BUFFER_POOL_COUNT)
+      {
+        __CLREX();
+        index = MX_BUF_POOL_NONE;
+        break;
+      }
+    } while (__STREXW(index + 1U, &MxBufPoolUnused) != 0U);
+  }
+
+  return index;
+}
+
+
+mx_buf_t *mx_buf_pool_alloc(uint32_t len)
+{
+  mx_buf_t *p = NULL;
+
+  if (len <= (uint32_t)MX_WIFI_BUFFER_SIZE)
+  {
+    const uint32_t index = mx_buf_pool_take();
+
+    if (MX_BUF_POOL_NONE != index)
+    {
+      const uint32_t used = mx_buf_pool_add(&MxBufPoolStat.used, 1U);
+      uint32_t used_max;
+
+      do
+      {
+        used_max = __LDREXW(&MxBufPoolStat.used_max);
+        if (used <= used_max)
+        {
+          __CLREX();
+          break;
+        }
+      } while (__STREXW(used, &MxBufPoolStat.used_max) != 0U);
+
+      (void)mx_buf_pool_add(&MxBufPoolStat.allocs, 1U);
+
+      p = (mx_buf_t *)&MxBufPool[index][0];
+      p->len = len;
+      p->header_len = 0;
+    }
+  }
+
+  if (NULL == p)
+  {
+    p = mx_buf_alloc(len);
+    if (NULL != p)
+    {
+      (void)mx_buf_pool_add(&MxBufPoolStat.heap_allocs, 1U);
+    }
+  }
+
+  return p;
+}
+
+
+void mx_buf_pool_free(mx_buf_t *p)
+{
+  const uint8_t *const addr = (const uint8_t *)p;
+  const uint8_t *const start = (const uint8_t *)&MxBufPool[0][0];
+
+  if ((addr >= start) && (addr < (start + sizeof(MxBufPool))))
+  {
+    const uint32_t index = (uint32_t)(addr - start) / sizeof(MxBufPool[0]);
+    uint32_t head;
+
+    /* Not counted as used anymore before it can be taken again. */
+    (void)mx_buf_pool_add(&MxBufPoolStat.used, 0xFFFFFFFFU);
+
+    /* Push the block on the free list. The block is linked before the exclusive load */
+    /* since no store may come between LDREX and STREX, the push is retried if the     */
+    /* head changed in the meantime.                                                   */
+    for (;;)
+    {
+      head = MxBufPoolFree;
+      MxBufPoolNext[index] = head;
+      if (__LDREXW(&MxBufPoolFree) != head)
+      {
+        __CLREX();
+      }
+      else if (__STREXW(index, &MxBufPoolFree) == 0U)
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    MX_WIFI_FREE(p);
+  }
+}
+
+
+void mx_buf_pool_get_stat(mx_buf_pool_stat_t *stat)
+{
+  if (NULL != stat)
+  {
+    *stat = MxBufPoolStat;
+  }
+}
+#endif /* MX_WIFI_RX_BUFFER_POOL */
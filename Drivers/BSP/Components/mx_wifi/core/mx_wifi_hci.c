@@ -46,6 +46,7 @@
 
 /* HCI low level function. */
 static hci_send_func_t TclOutputFunc = NULL;
+static hci_sendv_func_t TclOutputFuncV = NULL;
 
 /* HCI receive data queue. */
 static FIFO_DECLARE(HciPacketFifo);
@@ -64,9 +65,10 @@ static bool mx_wifi_hci_pkt_verify(const uint8_t *data, uint32_t len)
 
 
 /* Global functions ----------------------------------------------------------*/
-int32_t mx_wifi_hci_init(hci_send_func_t low_level_send)
+int32_t mx_wifi_hci_init(hci_send_func_t low_level_send, hci_sendv_func_t low_level_sendv)
 {
   TclOutputFunc = low_level_send;
+  TclOutputFuncV = low_level_sendv;
   FIFO_INIT(HciPacketFifo, MX_WIFI_MAX_RX_BUFFER_COUNT);
 
   return 0;
@@ -93,34 +95,50 @@ int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len)
     ret = -1;
   }
 #else
-  uint8_t *slip_frame = NULL;
+  /* The SLIP frame is built and sent part by part, no frame allocation. */
+  uint8_t slip_chunk[MX_WIFI_SLIP_TX_CHUNK_SIZE];
+  slip_encoder_t slip_enc;
   uint16_t slip_len = 0;
 
-  slip_frame = slip_transfer(payload, len, &slip_len);
-  if ((NULL != slip_frame) && (slip_len > 0))
+  slip_encoder_init(&slip_enc, payload, len);
+  do
   {
-    sent = TclOutputFunc(slip_frame, slip_len);
-    if (slip_len == sent)
-    {
-      ret = 0;
-    }
-    else
+    slip_len = slip_encode_next(&slip_enc, slip_chunk, (uint16_t)sizeof(slip_chunk));
+    sent = TclOutputFunc(slip_chunk, slip_len);
+    if (slip_len != sent)
     {
       DEBUG_ERROR("tcl_output(uart) error sent=%d !\n", sent);
       ret = -1;
     }
+  } while ((0 == ret) && !slip_encoder_done(&slip_enc));
+#endif /* (MX_WIFI_USE_SPI == 1) */
+
+  return ret;
+}
 
-    MX_WIFI_FREE(slip_frame);
-    slip_frame = NULL;
 
-    MX_STAT(free);
+int32_t mx_wifi_hci_send_v(const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count)
+{
+  int32_t ret = -1;
+  uint32_t len = 0;
+
+  for (uint8_t i = 0; i < seg_count; i++)
+  {
+    len += seg[i].len;
+  }
+
+  if (NULL == TclOutputFuncV)
+  {
+    DEBUG_ERROR("tcl_output gather send not supported!\n");
+  }
+  else if (len != TclOutputFuncV(seg, seg_count))
+  {
+    DEBUG_ERROR("tcl_output(v) error !\n");
   }
   else
   {
-    DEBUG_ERROR("Create slip frame error!\n");
-    ret = -2;
+    ret = 0;
   }
-#endif /* (MX_WIFI_USE_SPI == 1) */
 
   return ret;
 }
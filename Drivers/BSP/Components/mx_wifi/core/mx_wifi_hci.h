@@ -62,12 +62,21 @@ typedef struct _hci_pkt_s
   */
 typedef uint16_t (*hci_send_func_t)(uint8_t *data, uint16_t size);
 
+/**
+  * @brief prototype of the low level gather send function for the HCI layer
+  * @param seg: segments to send as a single msg
+  * @param seg_count: number of segments
+  * @retval size of the data sent
+  */
+typedef uint16_t (*hci_sendv_func_t)(const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count);
+
 /**
   * @brief Init for the HCI layer
   * @param low_level_send: send function for the HCI low level msg
+  * @param low_level_sendv: optional gather send function for the HCI low level msg
   * @retval 0 success, otherwise failed
   */
-int32_t mx_wifi_hci_init(hci_send_func_t low_level_send);
+int32_t mx_wifi_hci_init(hci_send_func_t low_level_send, hci_sendv_func_t low_level_sendv);
 
 /**
   * @brief Send msg for the HCI layer
@@ -77,6 +86,14 @@ int32_t mx_wifi_hci_init(hci_send_func_t low_level_send);
   */
 int32_t mx_wifi_hci_send(uint8_t *payload, uint16_t len);
 
+/**
+  * @brief Send msg made of several segments for the HCI layer
+  * @param seg: segments to send
+  * @param seg_count: number of segments
+  * @retval 0 success, otherwise failed
+  */
+int32_t mx_wifi_hci_send_v(const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count);
+
 /**
   * @brief Recv msg for the HCI layer
   * @param timeout: recv timeout in milliseconds
@@ -51,6 +51,9 @@ typedef struct _event_item_s
 } event_item_t;
 
 
+/* Command params up to this size are built in the pending request entry instead of an allocated buffer. */
+#define MIPC_REQ_INLINE_PARAMS_SIZE  (64)
+
 /**
   * @brief IPC API request list
   */
@@ -60,18 +63,68 @@ typedef struct _mipc_req_s
   SEM_DECLARE(resp_flag);
   uint16_t *rbuffer_size; /* in/out */
   uint8_t *rbuffer;
+  uint16_t *rdata_size;   /* in/out */
+  uint8_t *rdata;         /* response data following the response params */
+  uint32_t sent_id;       /* req_id the command was sent with, req_id is reset by the answer */
+  uint16_t api_id;
+  uint8_t *alloc_buf;     /* heap command buffer, freed with the entry */
+  uint32_t sent_tick;     /* time the command was sent, for the latency statistics */
+  bool in_use;            /* entry owned by a requester, until its answer is consumed */
+  uint8_t cbuf[MIPC_HEADER_SIZE + MIPC_REQ_INLINE_PARAMS_SIZE]; /* header and small params, no allocation */
 } mipc_req_t;
 
 #define MIPC_REQ_ID_RESET_VAL  ((uint32_t)(0xFFFFFFFF))
 
+/* Maximum number of requests waiting for the answer at the same time. */
+#ifndef MX_WIFI_MAX_PENDING_REQUEST_COUNT
+#define MX_WIFI_MAX_PENDING_REQUEST_COUNT  (4)
+#endif /* MX_WIFI_MAX_PENDING_REQUEST_COUNT */
+
+
+/* Number of APIs with request latency statistics, the first ones used get an entry. */
+#ifndef MX_WIFI_STAT_API_COUNT
+#define MX_WIFI_STAT_API_COUNT  (16)
+#endif /* MX_WIFI_STAT_API_COUNT */
+
+
+static mipc_req_t PendingRequest[MX_WIFI_MAX_PENDING_REQUEST_COUNT];
+static LOCK_DECLARE(PendingRequestLock);
+static SEM_DECLARE(PendingRequestFreeSem);
+
+/* Gather send is supported by the low level IO, data can be sent from the caller buffer. */
+static bool IpcGatherSend = false;
 
-static mipc_req_t PendingRequest;
+/* Command buffer statistics, updated under the command lock. */
+static mipc_tx_stat_t IpcTxStat;
+
+/* Response statistics, updated under the pending request lock. */
+static mipc_rx_stat_t IpcRxStat;
+
+/* Request latency statistics, updated under the pending request lock. */
+static mipc_latency_stat_t IpcLatencyStat[MX_WIFI_STAT_API_COUNT];
+static uint32_t IpcLatencyUntracked;
 
 static uint8_t *byte_pointer_add_signed_offset(uint8_t *BytePointer, int32_t Offset);
 static uint32_t get_new_req_id(void);
 static uint32_t mpic_get_req_id(const uint8_t Buffer[]);
 static uint16_t mpic_get_api_id(const uint8_t Buffer[]);
+static mipc_req_t *mipc_get_pending_request(uint32_t req_id);
 static void mipc_event(mx_buf_t *netbuf);
+static int32_t mipc_request_ex(uint16_t api_id,
+                               uint8_t *cparams, uint16_t cparams_size,
+                               const uint8_t *data, uint16_t data_size,
+                               uint8_t *rbuffer, uint16_t *rbuffer_size,
+                               uint8_t *rdata, uint16_t *rdata_size,
+                               uint32_t timeout_ms);
+static int32_t mipc_request_send(uint16_t api_id,
+                                 uint8_t *cparams, uint16_t cparams_size,
+                                 const uint8_t *data, uint16_t data_size,
+                                 uint8_t *rbuffer, uint16_t *rbuffer_size,
+                                 uint8_t *rdata, uint16_t *rdata_size,
+                                 uint32_t timeout_ms, mipc_req_t **req_out);
+static int32_t mipc_request_wait(mipc_req_t *req, uint32_t timeout_ms);
+static void mipc_request_release(mipc_req_t *req);
+static void mipc_latency_record(uint16_t api_id, uint32_t latency_ms, bool answered);
 
 
 static uint8_t *byte_pointer_add_signed_offset(uint8_t *BytePointer, int32_t Offset)
@@ -100,6 +153,24 @@ static uint16_t mpic_get_api_id(const uint8_t Buffer[])
 }
 
 
+/* Must be called with PendingRequestLock locked. */
+static mipc_req_t *mipc_get_pending_request(uint32_t req_id)
+{
+  mipc_req_t *req = NULL;
+
+  for (uint32_t i = 0; i < MX_WIFI_MAX_PENDING_REQUEST_COUNT; i++)
+  {
+    if (PendingRequest[i].req_id == req_id)
+    {
+      req = &PendingRequest[i];
+      break;
+    }
+  }
+
+  return req;
+}
+
+
 static void mipc_event(mx_buf_t *netbuf)
 {
   static const event_item_t event_table[] =
@@ -128,21 +199,43 @@ static void mipc_event(mx_buf_t *netbuf)
 
       if ((0 == (api_id & MIPC_API_EVENT_BASE)) && (MIPC_REQ_ID_NONE != req_id))
       {
-        /* The command response must match pending req id. */
-        if (PendingRequest.req_id == req_id)
+        mipc_req_t *req;
+
+        LOCK(PendingRequestLock);
+
+        /* The command response must match one of the pending req ids. */
+        req = mipc_get_pending_request(req_id);
+        if (NULL != req)
         {
+          uint8_t *params = byte_pointer_add_signed_offset(buffer_in, MIPC_PKT_PARAMS_OFFSET);
+          uint32_t params_size = buffer_in_size - MIPC_PKT_MIN_SIZE;
+
           /* return params */
-          if ((PendingRequest.rbuffer_size != NULL) && (*PendingRequest.rbuffer_size > 0) &&
-              (NULL != PendingRequest.rbuffer))
+          if ((req->rbuffer_size != NULL) && (*req->rbuffer_size > 0) &&
+              (NULL != req->rbuffer))
+          {
+            *(req->rbuffer_size) = *req->rbuffer_size < params_size ? \
+                                   *req->rbuffer_size : (uint16_t)params_size;
+            (void)memcpy(req->rbuffer, params, *req->rbuffer_size);
+            IpcRxStat.copied_bytes += *req->rbuffer_size;
+            params = byte_pointer_add_signed_offset(params, (int32_t)*req->rbuffer_size);
+            params_size -= *req->rbuffer_size;
+          }
+
+          /* return data straight into the caller buffer */
+          if ((req->rdata_size != NULL) && (NULL != req->rdata))
           {
-            *(PendingRequest.rbuffer_size) = *PendingRequest.rbuffer_size < (buffer_in_size - MIPC_PKT_MIN_SIZE) ? \
-                                             *PendingRequest.rbuffer_size : (uint16_t)(buffer_in_size - MIPC_PKT_MIN_SIZE);
-            (void)memcpy(PendingRequest.rbuffer, byte_pointer_add_signed_offset(buffer_in, MIPC_PKT_PARAMS_OFFSET),
-                         *PendingRequest.rbuffer_size);
+            *(req->rdata_size) = *req->rdata_size < params_size ? \
+                                 *req->rdata_size : (uint16_t)params_size;
+            (void)memcpy(req->rdata, params, *req->rdata_size);
+            IpcRxStat.copied_bytes += *req->rdata_size;
+            IpcRxStat.direct++;
           }
-          /* printf("Signal for %d\n",pending_request.req_id); */
-          PendingRequest.req_id = MIPC_REQ_ID_RESET_VAL;
-          if (SEM_OK != SEM_SIGNAL(PendingRequest.resp_flag))
+          IpcRxStat.responses++;
+
+          /* printf("Signal for %d\n",req->req_id); */
+          req->req_id = MIPC_REQ_ID_RESET_VAL;
+          if (SEM_OK != SEM_SIGNAL(req->resp_flag))
           {
             DEBUG_ERROR("Failed to signal command response\n");
             MX_ASSERT(false);
@@ -151,9 +244,11 @@ static void mipc_event(mx_buf_t *netbuf)
         }
         else
         {
-          DEBUG_LOG("response req_id: 0x%08"PRIx32" not match pending req_id: 0x%08" PRIx32 "!\n",
-                    req_id, PendingRequest.req_id);
+          DEBUG_LOG("response req_id: 0x%08"PRIx32" not match any pending req_id!\n", req_id);
         }
+
+        UNLOCK(PendingRequestLock);
+
         mx_wifi_hci_free(netbuf);
       }
       else /* event callback */
@@ -194,14 +289,25 @@ static void mipc_event(mx_buf_t *netbuf)
   * IPC API implementations for mx_wifi over HCI
   ******************************************************************************/
 
-int32_t mipc_init(mipc_send_func_t ipc_send)
+int32_t mipc_init(mipc_send_func_t ipc_send, mipc_sendv_func_t ipc_sendv)
 {
   int32_t ret;
 
-  PendingRequest.req_id = MIPC_REQ_ID_RESET_VAL;
-  SEM_INIT(PendingRequest.resp_flag, 1);
+  IpcGatherSend = (NULL != ipc_sendv);
+  (void)memset(&IpcTxStat, 0, sizeof(IpcTxStat));
 
-  ret = mx_wifi_hci_init(ipc_send);
+  LOCK_INIT(PendingRequestLock);
+  SEM_INIT(PendingRequestFreeSem, MX_WIFI_MAX_PENDING_REQUEST_COUNT);
+
+  for (uint32_t i = 0; i < MX_WIFI_MAX_PENDING_REQUEST_COUNT; i++)
+  {
+    PendingRequest[i].req_id = MIPC_REQ_ID_RESET_VAL;
+    PendingRequest[i].in_use = false;
+    SEM_INIT(PendingRequest[i].resp_flag, 1);
+    (void)SEM_SIGNAL(PendingRequestFreeSem);
+  }
+
+  ret = mx_wifi_hci_init(ipc_send, ipc_sendv);
 
   return ret;
 }
@@ -211,7 +317,12 @@ int32_t mipc_deinit(void)
 {
   int32_t ret;
 
-  SEM_DEINIT(PendingRequest.resp_flag);
+  for (uint32_t i = 0; i < MX_WIFI_MAX_PENDING_REQUEST_COUNT; i++)
+  {
+    SEM_DEINIT(PendingRequest[i].resp_flag);
+  }
+  SEM_DEINIT(PendingRequestFreeSem);
+  LOCK_DEINIT(PendingRequestLock);
 
   ret = mx_wifi_hci_deinit();
 
@@ -223,28 +334,118 @@ int32_t mipc_request(uint16_t api_id,
                      uint8_t *cparams, uint16_t cparams_size,
                      uint8_t *rbuffer, uint16_t *rbuffer_size,
                      uint32_t timeout_ms)
+{
+  return mipc_request_ex(api_id, cparams, cparams_size, NULL, 0,
+                         rbuffer, rbuffer_size, NULL, NULL, timeout_ms);
+}
+
+
+int32_t mipc_request_with_data(uint16_t api_id,
+                               uint8_t *cparams, uint16_t cparams_size,
+                               const uint8_t *data, uint16_t data_size,
+                               uint8_t *rbuffer, uint16_t *rbuffer_size,
+                               uint32_t timeout_ms)
+{
+  return mipc_request_ex(api_id, cparams, cparams_size, data, data_size,
+                         rbuffer, rbuffer_size, NULL, NULL, timeout_ms);
+}
+
+
+int32_t mipc_request_recv_data(uint16_t api_id,
+                               uint8_t *cparams, uint16_t cparams_size,
+                               uint8_t *rbuffer, uint16_t *rbuffer_size,
+                               uint8_t *rdata, uint16_t *rdata_size,
+                               uint32_t timeout_ms)
+{
+  return mipc_request_ex(api_id, cparams, cparams_size, NULL, 0,
+                         rbuffer, rbuffer_size, rdata, rdata_size, timeout_ms);
+}
+
+
+int32_t mipc_request_start(uint16_t api_id,
+                           uint8_t *cparams, uint16_t cparams_size,
+                           const uint8_t *data, uint16_t data_size,
+                           uint8_t *rbuffer, uint16_t *rbuffer_size,
+                           uint32_t timeout_ms, mipc_req_handle_t *handle)
+{
+  return mipc_request_send(api_id, cparams, cparams_size, data, data_size,
+                           rbuffer, rbuffer_size, NULL, NULL, timeout_ms, handle);
+}
+
+
+int32_t mipc_request_finish(mipc_req_handle_t handle, uint32_t timeout_ms)
+{
+  return mipc_request_wait(handle, timeout_ms);
+}
+
+
+static int32_t mipc_request_ex(uint16_t api_id,
+                               uint8_t *cparams, uint16_t cparams_size,
+                               const uint8_t *data, uint16_t data_size,
+                               uint8_t *rbuffer, uint16_t *rbuffer_size,
+                               uint8_t *rdata, uint16_t *rdata_size,
+                               uint32_t timeout_ms)
+{
+  const uint32_t tickstart = HAL_GetTick();
+  mipc_req_t *req = NULL;
+  int32_t ret;
+
+  ret = mipc_request_send(api_id, cparams, cparams_size, data, data_size,
+                          rbuffer, rbuffer_size, rdata, rdata_size, timeout_ms, &req);
+  if (MIPC_CODE_SUCCESS == ret)
+  {
+    /* The timeout covers the whole request, the answer only gets the remaining time. */
+    uint32_t remaining_ms = timeout_ms;
+
+    if (WAIT_FOREVER != timeout_ms)
+    {
+      const uint32_t elapsed_ms = HAL_GetTick() - tickstart;
+
+      remaining_ms = (elapsed_ms < timeout_ms) ? (timeout_ms - elapsed_ms) : 0U;
+    }
+    ret = mipc_request_wait(req, remaining_ms);
+  }
+
+  return ret;
+}
+
+
+/* Send the command, the request entry stays registered until mipc_request_wait(). */
+static int32_t mipc_request_send(uint16_t api_id,
+                                 uint8_t *cparams, uint16_t cparams_size,
+                                 const uint8_t *data, uint16_t data_size,
+                                 uint8_t *rbuffer, uint16_t *rbuffer_size,
+                                 uint8_t *rdata, uint16_t *rdata_size,
+                                 uint32_t timeout_ms, mipc_req_t **req_out)
 {
   int32_t ret = MIPC_CODE_ERROR;
-  uint8_t *cbuf;
+  uint8_t *cbuf = NULL;
   bool copy_buffer = true;
-
-  LOCK(wifi_obj_get()->lockcmd);
+  bool inline_buffer = false;
 
   /* DEBUG_LOG("\n%s()>  %" PRIu32 "\n", __FUNCTION__, (uint32_t)cparams_size); */
 
-  if (cparams_size <= MX_WIFI_IPC_PAYLOAD_SIZE)
+  *req_out = NULL;
+
+  if (((uint32_t)cparams_size + data_size) <= MX_WIFI_IPC_PAYLOAD_SIZE)
   {
     /* Create the command data. */
-    const uint16_t cbuf_size = MIPC_PKT_REQ_ID_SIZE + MIPC_PKT_API_ID_SIZE + cparams_size;
+    const uint16_t cbuf_size = MIPC_PKT_REQ_ID_SIZE + MIPC_PKT_API_ID_SIZE + cparams_size + data_size;
 
 #if MX_WIFI_TX_BUFFER_NO_COPY
-    if (api_id == MIPC_API_WIFI_BYPASS_OUT_CMD)
+    if ((api_id == MIPC_API_WIFI_BYPASS_OUT_CMD) && (0U == data_size))
     {
       cbuf = byte_pointer_add_signed_offset(cparams, - (MIPC_PKT_REQ_ID_SIZE + MIPC_PKT_API_ID_SIZE));
       copy_buffer = false;
     }
     else
 #endif /* MX_WIFI_TX_BUFFER_NO_COPY */
+    if ((cparams_size <= MIPC_REQ_INLINE_PARAMS_SIZE) && ((0U == data_size) || (true == IpcGatherSend)))
+    {
+      /* Header and params are built in the pending request entry, data is sent from the caller buffer. */
+      inline_buffer = true;
+    }
+    else
     {
       DEBUG_LOG("\n%-15s(): Allocate %" PRIu32 " bytes\n", __FUNCTION__, (uint32_t)cbuf_size);
 
@@ -253,58 +454,140 @@ int32_t mipc_request(uint16_t api_id,
       MX_STAT(alloc);
     }
 
-    if (NULL != cbuf)
+    if ((NULL == cbuf) && (false == inline_buffer))
     {
-      /* Get an unique identifier. */
-      const uint32_t req_id = get_new_req_id();
-
-      /* Copy the protocol parameter to the head part of the buffer. */
-      (void)memcpy(byte_pointer_add_signed_offset(cbuf, MIPC_PKT_REQ_ID_OFFSET), &req_id, sizeof(req_id));
-      (void)memcpy(byte_pointer_add_signed_offset(cbuf, MIPC_PKT_API_ID_OFFSET), &api_id, sizeof(api_id));
-
-      if ((true == copy_buffer) && (cparams_size > 0))
+      ret = MIPC_CODE_NO_MEMORY;
+    }
+    else
+    {
+      /* Wait for a free entry in the pending request table. */
+      if (SEM_WAIT(PendingRequestFreeSem, timeout_ms, mipc_poll) != SEM_OK)
       {
-        (void)memcpy(byte_pointer_add_signed_offset(cbuf, MIPC_PKT_PARAMS_OFFSET), cparams, cparams_size);
+        DEBUG_ERROR("Error: command 0x%04" PRIx32 " timeout(%" PRIu32 " ms) waiting free request entry\n",
+                    (uint32_t)api_id, timeout_ms);
+        ret = MIPC_CODE_TIMEOUT;
       }
-
-      /* A single pending request due to LOCK usage on command. */
-      if (PendingRequest.req_id != MIPC_REQ_ID_RESET_VAL)
+      else
       {
-        DEBUG_LOG("Error req_id must be 0xffffffff here %" PRIu32 "\n", PendingRequest.req_id);
-        MX_ASSERT(false);
-      }
+        mipc_req_t *req;
+        uint32_t req_id;
 
-      PendingRequest.req_id = req_id;
-      PendingRequest.rbuffer = rbuffer;
-      PendingRequest.rbuffer_size = rbuffer_size;
+        bool gather;
 
-      /* static int iter=0;                       */
-      /* printf("%d push %d\n",iter++,cbuf_size); */
+        /* The command lock only covers the request id assignment and the sending, */
+        /* so independent requests can wait for their answers at the same time.    */
+        LOCK(wifi_obj_get()->lockcmd);
 
-      /* Send the command. */
-      DEBUG_LOG("%-15s(): req_id: 0x%08" PRIx32 " : %" PRIu32 "\n", __FUNCTION__, req_id, (uint32_t)cbuf_size);
+        /* Get an unique identifier. */
+        req_id = get_new_req_id();
 
-      ret = mx_wifi_hci_send(cbuf, cbuf_size);
-      if (ret == 0)
-      {
-        /* Wait for the command answer. */
-        if (SEM_WAIT(PendingRequest.resp_flag, timeout_ms, mipc_poll) != SEM_OK)
+        /* Register the request, an entry is free thanks to PendingRequestFreeSem. */
+        LOCK(PendingRequestLock);
+        req = NULL;
+        for (uint32_t i = 0; i < MX_WIFI_MAX_PENDING_REQUEST_COUNT; i++)
+        {
+          if (false == PendingRequest[i].in_use)
+          {
+            req = &PendingRequest[i];
+            break;
+          }
+        }
+        MX_ASSERT(NULL != req);
+        req->in_use = true;
+        req->req_id = req_id;
+        req->sent_id = req_id;
+        req->api_id = api_id;
+        req->rbuffer = rbuffer;
+        req->rbuffer_size = rbuffer_size;
+        req->rdata = rdata;
+        req->rdata_size = rdata_size;
+        req->alloc_buf = ((true == copy_buffer) && (false == inline_buffer)) ? cbuf : NULL;
+        req->sent_tick = HAL_GetTick();
+        UNLOCK(PendingRequestLock);
+
+        if (true == inline_buffer)
+        {
+          cbuf = req->cbuf;
+        }
+
+        /* Copy the protocol parameter to the head part of the buffer. */
+        (void)memcpy(byte_pointer_add_signed_offset(cbuf, MIPC_PKT_REQ_ID_OFFSET), &req_id, sizeof(req_id));
+        (void)memcpy(byte_pointer_add_signed_offset(cbuf, MIPC_PKT_API_ID_OFFSET), &api_id, sizeof(api_id));
+
+        if ((true == copy_buffer) && (cparams_size > 0))
         {
-          DEBUG_ERROR("Error: command 0x%04" PRIx32 " timeout(%" PRIu32 " ms) waiting answer %" PRIu32 "\n",
-                      (uint32_t)api_id, timeout_ms, PendingRequest.req_id);
-          PendingRequest.req_id = MIPC_REQ_ID_RESET_VAL;
+          (void)memcpy(byte_pointer_add_signed_offset(cbuf, MIPC_PKT_PARAMS_OFFSET), cparams, cparams_size);
+        }
+
+        IpcTxStat.requests++;
+
+        gather = ((true == inline_buffer) && (data_size > 0U));
+        if (true == gather)
+        {
+          IpcTxStat.zero_copy++;
+        }
+        else if ((true == copy_buffer) && (false == inline_buffer))
+        {
+          if (data_size > 0U)
+          {
+            (void)memcpy(byte_pointer_add_signed_offset(cbuf, (int32_t)MIPC_PKT_PARAMS_OFFSET + cparams_size),
+                         data, data_size);
+          }
+          IpcTxStat.allocs++;
+        }
+        else
+        {
+          /* Command built in place. */
+        }
+
+#if (MX_WIFI_USE_SPI == 1)
+        /* The SPI IO queues a frame atomically and then waits until it has been sent, */
+        /* the other senders queue their frames meanwhile.                             */
+        UNLOCK(wifi_obj_get()->lockcmd);
+#endif /* (MX_WIFI_USE_SPI == 1) */
+
+        /* static int iter=0;                       */
+        /* printf("%d push %d\n",iter++,cbuf_size); */
+
+        /* Send the command. */
+        DEBUG_LOG("%-15s(): req_id: 0x%08" PRIx32 " : %" PRIu32 "\n", __FUNCTION__, req_id, (uint32_t)cbuf_size);
+
+        if (true == gather)
+        {
+          const MX_WIFI_IO_Segment_t seg[2] =
+          {
+            {cbuf, (uint16_t)(MIPC_PKT_PARAMS_OFFSET + cparams_size)},
+            {data, data_size}
+          };
+
+          ret = mx_wifi_hci_send_v(seg, 2);
+        }
+        else
+        {
+          ret = mx_wifi_hci_send(cbuf, cbuf_size);
+        }
+
+#if (MX_WIFI_USE_SPI == 0)
+        /* The SLIP frame is written in several chunks, the whole frame stays under the lock. */
+        UNLOCK(wifi_obj_get()->lockcmd);
+#endif /* (MX_WIFI_USE_SPI == 0) */
+
+        if (ret == 0)
+        {
+          *req_out = req;
+        }
+        else
+        {
+          DEBUG_ERROR("Failed to send command to HCI\n");
+          MX_ASSERT(false);
+
           ret = MIPC_CODE_ERROR;
+          mipc_request_release(req);
         }
+        cbuf = NULL;
       }
-      else
-      {
-        DEBUG_ERROR("Failed to send command to HCI\n");
-        MX_ASSERT(false);
-      }
-
-      DEBUG_LOG("%-15s()< req_id: 0x%08" PRIx32 " done (%" PRId32 ")\n\n", __FUNCTION__, req_id, ret);
 
-      if (true == copy_buffer)
+      if ((NULL != cbuf) && (true == copy_buffer) && (false == inline_buffer))
       {
         MX_WIFI_FREE(cbuf);
 
@@ -313,12 +596,170 @@ int32_t mipc_request(uint16_t api_id,
     }
   }
 
-  UNLOCK(wifi_obj_get()->lockcmd);
+  return ret;
+}
+
+
+/* Wait for the answer of a sent command and release its request entry. */
+static int32_t mipc_request_wait(mipc_req_t *req, uint32_t timeout_ms)
+{
+  int32_t ret = MIPC_CODE_SUCCESS;
+
+  /* Wait for the command answer. */
+  if (SEM_WAIT(req->resp_flag, timeout_ms, mipc_poll) != SEM_OK)
+  {
+    LOCK(PendingRequestLock);
+    if (req->req_id == req->sent_id)
+    {
+      DEBUG_ERROR("Error: command 0x%04" PRIx32 " timeout(%" PRIu32 " ms) waiting answer %" PRIu32 "\n",
+                  (uint32_t)req->api_id, timeout_ms, req->sent_id);
+      ret = MIPC_CODE_ERROR;
+
+      /* A late answer must not match the entry anymore. */
+      req->req_id = MIPC_REQ_ID_RESET_VAL;
+    }
+    else
+    {
+      /* The answer arrived in the meantime, consume its signal. */
+      (void)SEM_WAIT(req->resp_flag, 0, NULL);
+    }
+    UNLOCK(PendingRequestLock);
+  }
+
+  LOCK(PendingRequestLock);
+  mipc_latency_record(req->api_id, HAL_GetTick() - req->sent_tick, (MIPC_CODE_SUCCESS == ret));
+  UNLOCK(PendingRequestLock);
+
+  DEBUG_LOG("%-15s()< req_id: 0x%08" PRIx32 " done (%" PRId32 ")\n\n", __FUNCTION__, req->sent_id, ret);
+
+  mipc_request_release(req);
 
   return ret;
 }
 
 
+/* Release the request entry, with its command buffer if it was allocated. */
+static void mipc_request_release(mipc_req_t *req)
+{
+  uint8_t *const alloc_buf = req->alloc_buf;
+
+  LOCK(PendingRequestLock);
+  req->req_id = MIPC_REQ_ID_RESET_VAL;
+  req->alloc_buf = NULL;
+
+  /* Drop a pending answer signal while the entry is still owned, the next user of the */
+  /* entry starts from a clean state and its own answer cannot be consumed here.       */
+  (void)SEM_WAIT(req->resp_flag, 0, NULL);
+  req->in_use = false;
+  UNLOCK(PendingRequestLock);
+
+  (void)SEM_SIGNAL(PendingRequestFreeSem);
+
+  if (NULL != alloc_buf)
+  {
+    MX_WIFI_FREE(alloc_buf);
+
+    MX_STAT(free);
+  }
+}
+
+
+/* Account the latency of a request, must be called with PendingRequestLock locked. */
+static void mipc_latency_record(uint16_t api_id, uint32_t latency_ms, bool answered)
+{
+  mipc_latency_stat_t *entry = NULL;
+
+  for (uint32_t i = 0; (i < (uint32_t)MX_WIFI_STAT_API_COUNT) && (NULL == entry); i++)
+  {
+    if ((IpcLatencyStat[i].api_id == api_id) || (IpcLatencyStat[i].api_id == MIPC_API_ID_NONE))
+    {
+      entry = &IpcLatencyStat[i];
+      entry->api_id = api_id;
+    }
+  }
+
+  if (NULL == entry)
+  {
+    IpcLatencyUntracked++;
+  }
+  else if (false == answered)
+  {
+    entry->timeouts++;
+  }
+  else
+  {
+    uint32_t limit = 1U;
+    uint32_t bucket = 0;
+
+    while ((bucket < (MIPC_LATENCY_HIST_BUCKETS - 1U)) && (latency_ms >= limit))
+    {
+      bucket++;
+      limit <<= 1;
+    }
+    entry->hist[bucket]++;
+    entry->count++;
+    entry->total_ms += latency_ms;
+    if (latency_ms > entry->max_ms)
+    {
+      entry->max_ms = latency_ms;
+    }
+  }
+}
+
+
+void mipc_get_tx_stat(mipc_tx_stat_t *stat)
+{
+  if (NULL != stat)
+  {
+    LOCK(wifi_obj_get()->lockcmd);
+    *stat = IpcTxStat;
+    UNLOCK(wifi_obj_get()->lockcmd);
+  }
+}
+
+
+void mipc_get_rx_stat(mipc_rx_stat_t *stat)
+{
+  if (NULL != stat)
+  {
+    LOCK(PendingRequestLock);
+    *stat = IpcRxStat;
+    UNLOCK(PendingRequestLock);
+  }
+}
+
+
+int32_t mipc_get_latency_stat(uint32_t index, mipc_latency_stat_t *stat)
+{
+  int32_t ret = -1;
+
+  if ((NULL != stat) && (index < (uint32_t)MX_WIFI_STAT_API_COUNT))
+  {
+    LOCK(PendingRequestLock);
+    if (IpcLatencyStat[index].api_id != MIPC_API_ID_NONE)
+    {
+      *stat = IpcLatencyStat[index];
+      ret = 0;
+    }
+    UNLOCK(PendingRequestLock);
+  }
+
+  return ret;
+}
+
+
+uint32_t mipc_get_latency_untracked(void)
+{
+  uint32_t untracked;
+
+  LOCK(PendingRequestLock);
+  untracked = IpcLatencyUntracked;
+  UNLOCK(PendingRequestLock);
+
+  return untracked;
+}
+
+
 void mipc_poll(uint32_t timeout)
 {
   mx_buf_t *nbuf;
@@ -466,8 +907,15 @@ void mapi_wifi_netlink_input_callback(mx_buf_t *netbuf)
         (in_rprarams->tot_len > 0))
     {
       uint32_t low_level_netif_idx = (uint32_t)in_rprarams->idx;
+      const uint32_t frame_len = (uint32_t)in_rprarams->tot_len;
 
       MX_NET_BUFFER_HIDE_HEADER(netbuf, MIPC_PKT_PARAMS_OFFSET + sizeof(wifi_bypass_in_rparams_t));
+
+      /* The payload is the frame only. */
+      if (frame_len < MX_NET_BUFFER_GET_PAYLOAD_SIZE(netbuf))
+      {
+        MX_NET_BUFFER_SET_PAYLOAD_SIZE(netbuf, frame_len);
+      }
       wifi_obj_get()->Runtime.netlink_input_cb(netbuf, (void *)&low_level_netif_idx);
     }
     else
@@ -164,6 +164,49 @@ extern "C" {
 
 /* Exported typedef ----------------------------------------------------------*/
 typedef uint16_t (*mipc_send_func_t)(uint8_t *data, uint16_t size);
+typedef uint16_t (*mipc_sendv_func_t)(const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count);
+
+/**
+  * @brief IPC request started with mipc_request_start() and not finished yet
+  */
+typedef struct _mipc_req_s *mipc_req_handle_t;
+
+/**
+  * @brief IPC command buffer statistics
+  */
+typedef struct
+{
+  uint32_t requests;   /* number of requests sent */
+  uint32_t allocs;     /* number of requests sent from a heap allocated command buffer */
+  uint32_t zero_copy;  /* number of requests with data sent directly from the caller buffer */
+} mipc_tx_stat_t;
+
+/**
+  * @brief IPC response statistics
+  */
+typedef struct
+{
+  uint32_t responses;    /* number of responses delivered to the requesters */
+  uint32_t direct;       /* number of responses with data delivered directly into the caller buffer */
+  uint32_t copied_bytes; /* number of bytes copied from the received buffers to the requesters */
+} mipc_rx_stat_t;
+
+/* Request latency histogram: bucket 0 counts the latencies below 1 ms, each next bucket */
+/* doubles the limit and the last one counts all the longer latencies.                  */
+#define MIPC_LATENCY_HIST_BUCKETS   (12U)
+
+/**
+  * @brief IPC request latency statistics of one API
+  */
+typedef struct
+{
+  uint16_t api_id;    /* API of the requests, MIPC_API_ID_NONE if the entry is not used */
+  uint32_t count;     /* number of answered requests */
+  uint32_t timeouts;  /* number of requests without answer */
+  uint32_t total_ms;  /* sum of the latencies of the answered requests */
+  uint32_t max_ms;    /* maximum latency of the answered requests */
+  uint32_t hist[MIPC_LATENCY_HIST_BUCKETS]; /* latency histogram of the answered requests */
+} mipc_latency_stat_t;
 
 /* Exported functions --------------------------------------------------------*/
 
@@ -171,9 +214,10 @@ typedef uint16_t (*mipc_send_func_t)(uint8_t *data, uint16_t size);
 /**
   * @brief  Init MXCHIP WiFi IPC(Inter Processor Communication)
   * @param  ipc_send: the function call this ipc_send internally to send the low level msg
+  * @param  ipc_sendv: optional gather send function of the low level msg, NULL if not supported
   * @retval 0 success, otherwise failed, @ref ipc error code
   */
-int32_t mipc_init(mipc_send_func_t ipc_send);
+int32_t mipc_init(mipc_send_func_t ipc_send, mipc_sendv_func_t ipc_sendv);
 
 
 /**
@@ -197,6 +241,101 @@ int32_t mipc_request(uint16_t api_id,
                      uint8_t *rbuffer, uint16_t *rbuffer_size,
                      uint32_t timeout_ms);
 
+/**
+  * @brief  Request and get response by MXCHIP IPC API, with data appended to the input params
+  * @note   When the low level IO supports gather send and the params are small, the command
+  *         is sent without allocation and the data directly from the caller buffer.
+  * @param  api_id: IPC API ID @ref IPC api id
+  * @param  cparams: input params for the call
+  * @param  cparams_size: size of the input params
+  * @param  data: data sent after the input params
+  * @param  data_size: size of the data
+  * @param  rbuffer: response buffer
+  * @param  rbuffer_size: size of the response buffer
+  * @param  timeout_ms: timeout in milliseconds
+  * @retval 0 success, otherwise failed, @ref ipc error code
+  */
+int32_t mipc_request_with_data(uint16_t api_id,
+                               uint8_t *cparams, uint16_t cparams_size,
+                               const uint8_t *data, uint16_t data_size,
+                               uint8_t *rbuffer, uint16_t *rbuffer_size,
+                               uint32_t timeout_ms);
+
+/**
+  * @brief  Request and get response by MXCHIP IPC API, with the response data returned in a separate buffer
+  * @note   The response params are copied to rbuffer and the data following them directly from
+  *         the received buffer into rdata, so no intermediate buffer is needed.
+  * @param  api_id: IPC API ID @ref IPC api id
+  * @param  cparams: input params for the call
+  * @param  cparams_size: size of the input params
+  * @param  rbuffer: response buffer
+  * @param  rbuffer_size: size of the response buffer
+  * @param  rdata: response data buffer
+  * @param  rdata_size: size of the response data buffer, size of the returned data on output
+  * @param  timeout_ms: timeout in milliseconds
+  * @retval 0 success, otherwise failed, @ref ipc error code
+  */
+int32_t mipc_request_recv_data(uint16_t api_id,
+                               uint8_t *cparams, uint16_t cparams_size,
+                               uint8_t *rbuffer, uint16_t *rbuffer_size,
+                               uint8_t *rdata, uint16_t *rdata_size,
+                               uint32_t timeout_ms);
+
+/**
+  * @brief  Send a request by MXCHIP IPC API without waiting for the response
+  * @note   Several requests can be started before their responses are awaited with
+  *         mipc_request_finish(). The buffers must stay valid until then.
+  * @param  api_id: IPC API ID @ref IPC api id
+  * @param  cparams: input params for the call
+  * @param  cparams_size: size of the input params
+  * @param  data: data sent after the input params
+  * @param  data_size: size of the data
+  * @param  rbuffer: response buffer
+  * @param  rbuffer_size: size of the response buffer
+  * @param  timeout_ms: timeout in milliseconds waiting for a free request entry
+  * @param  handle: started request, to be passed to mipc_request_finish()
+  * @retval 0 success, MIPC_CODE_TIMEOUT no free request entry, otherwise failed, @ref ipc error code
+  */
+int32_t mipc_request_start(uint16_t api_id,
+                           uint8_t *cparams, uint16_t cparams_size,
+                           const uint8_t *data, uint16_t data_size,
+                           uint8_t *rbuffer, uint16_t *rbuffer_size,
+                           uint32_t timeout_ms, mipc_req_handle_t *handle);
+
+/**
+  * @brief  Wait for the response of a request started with mipc_request_start()
+  * @param  handle: started request
+  * @param  timeout_ms: timeout in milliseconds
+  * @retval 0 success, otherwise failed, @ref ipc error code
+  */
+int32_t mipc_request_finish(mipc_req_handle_t handle, uint32_t timeout_ms);
+
+/**
+  * @brief  Get IPC command buffer statistics
+  * @param  stat: pointer to the statistics structure to be filled
+  */
+void mipc_get_tx_stat(mipc_tx_stat_t *stat);
+
+/**
+  * @brief  Get IPC response statistics
+  * @param  stat: pointer to the statistics structure to be filled
+  */
+void mipc_get_rx_stat(mipc_rx_stat_t *stat);
+
+/**
+  * @brief  Get IPC request latency statistics of one API
+  * @param  index: entry index, the APIs get an entry in first use order
+  * @param  stat: pointer to the statistics structure to be filled
+  * @retval 0 success, -1 if the entry is not used
+  */
+int32_t mipc_get_latency_stat(uint32_t index, mipc_latency_stat_t *stat);
+
+/**
+  * @brief  Get the number of IPC requests of the APIs without latency statistics entry
+  * @retval number of requests, see MX_WIFI_STAT_API_COUNT
+  */
+uint32_t mipc_get_latency_untracked(void);
+
 
 /**
   * @brief  Polling to get the IPC response
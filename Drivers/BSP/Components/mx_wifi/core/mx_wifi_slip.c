@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <inttypes.h>
 
@@ -43,6 +44,17 @@
 /* SLIP buffer size. */
 #define SLIP_BUFFER_SIZE        (MIPC_PKT_MAX_SIZE + 100)
 
+/* Word at a time search of the SLIP special characters (START, END, ESCAPE).   */
+/* A byte of the word equals b when the same byte of (w ^ b...b) is zero.       */
+#define SLIP_WORD_ONES                 (0x01010101UL)
+#define SLIP_WORD_HIGHS                (0x80808080UL)
+#define SLIP_WORD_HAS_ZERO(w)          ((((w) - SLIP_WORD_ONES) & ~(w) & SLIP_WORD_HIGHS) != 0UL)
+#define SLIP_WORD_HAS_BYTE(w, b)       SLIP_WORD_HAS_ZERO((w) ^ (SLIP_WORD_ONES * (uint32_t)(b)))
+
+#define SLIP_IS_SPECIAL(b)             (((b) == (uint8_t)SLIP_START) || \
+                                        ((b) == (uint8_t)SLIP_END)   || \
+                                        ((b) == (uint8_t)SLIP_ESCAPE))
+
 
 enum
 {
@@ -51,112 +63,246 @@ enum
   SLIP_STATE_GOT_ESCAPE  /* last byte is escape */
 };
 
+enum
+{
+  SLIP_ENC_STATE_START,  /* START not written yet */
+  SLIP_ENC_STATE_DATA,   /* writing the escaped payload */
+  SLIP_ENC_STATE_DONE    /* END written */
+};
+
 
-uint8_t *slip_transfer(uint8_t data[], uint16_t len, uint16_t *outlen)
+/* SLIP receive context. */
+static struct
 {
-  uint16_t i;
-  uint16_t j;
-  uint16_t inc = 2;
-  uint8_t *buff = NULL;
+  uint16_t state;
+  uint16_t index;
+  uint8_t *buffer;
+  mx_buf_t *nbuf;
+} SlipRx = {SLIP_STATE_IDLE, 0, NULL, NULL};
+
+
+static uint16_t slip_plain_run(const uint8_t data[], uint16_t len);
+static uint8_t slip_escape_code(uint8_t data);
+static mx_buf_t *slip_input_one(uint8_t data);
 
-  for (i = 0; i < len; i++)
+
+/**
+  * @brief  Number of leading bytes which are not a SLIP special character
+  * @param  data: data to scan
+  * @param  len: size of the data
+  * @retval offset of the first special character, len if there is none
+  */
+static uint16_t slip_plain_run(const uint8_t data[], uint16_t len)
+{
+  uint16_t i = 0;
+  bool found = false;
+
+  while ((((uint32_t)len - i) >= sizeof(uint32_t)) && (false == found))
   {
-    if ((data[i] == SLIP_START) || (data[i] == SLIP_END) || (data[i] == SLIP_ESCAPE))
+    uint32_t word;
+
+    (void)memcpy(&word, &data[i], sizeof(word));
+    if (SLIP_WORD_HAS_BYTE(word, SLIP_START) ||
+        SLIP_WORD_HAS_BYTE(word, SLIP_END) ||
+        SLIP_WORD_HAS_BYTE(word, SLIP_ESCAPE))
+    {
+      found = true;
+    }
+    else
     {
-      inc++;
+      i += (uint16_t)sizeof(word);
     }
   }
 
-  buff = (uint8_t *)MX_WIFI_MALLOC(len + inc);
+  /* Locate the special character in the last word or finish the tail. */
+  while ((i < len) && !SLIP_IS_SPECIAL(data[i]))
+  {
+    i++;
+  }
 
-  if (buff != NULL)
+  return i;
+}
+
+
+static uint8_t slip_escape_code(uint8_t data)
+{
+  uint8_t code;
+
+  if (data == (uint8_t)SLIP_START)
+  {
+    code = (uint8_t)SLIP_ESCAPE_START;
+  }
+  else if (data == (uint8_t)SLIP_END)
+  {
+    code = (uint8_t)SLIP_ESCAPE_END;
+  }
+  else
+  {
+    code = (uint8_t)SLIP_ESCAPE_ES;
+  }
+
+  return code;
+}
+
+
+void slip_encoder_init(slip_encoder_t *enc, const uint8_t data[], uint16_t len)
+{
+  enc->data = data;
+  enc->len = len;
+  enc->pos = 0;
+  enc->state = SLIP_ENC_STATE_START;
+}
+
+
+bool slip_encoder_done(const slip_encoder_t *enc)
+{
+  return (SLIP_ENC_STATE_DONE == enc->state);
+}
+
+
+uint16_t slip_encode_next(slip_encoder_t *enc, uint8_t out[], uint16_t out_size)
+{
+  uint16_t j = 0;
+  bool full = false;
+
+  if ((SLIP_ENC_STATE_START == enc->state) && (out_size > 0U))
   {
+    out[j++] = SLIP_START;
+    enc->state = SLIP_ENC_STATE_DATA;
+  }
 
-    buff[0] = SLIP_START;
-    for (i = 0, j = 1; i < len; i++)
+  while ((SLIP_ENC_STATE_DATA == enc->state) && (false == full))
+  {
+    const uint16_t room = out_size - j;
+
+    if (enc->pos == enc->len)
     {
-      if (data[i] == SLIP_START)
+      if (room > 0U)
       {
-        buff[j++] = SLIP_ESCAPE;
-        buff[j++] = SLIP_ESCAPE_START;
+        out[j++] = SLIP_END;
+        enc->state = SLIP_ENC_STATE_DONE;
       }
-      else if (data[i] == SLIP_END)
+      else
       {
-        buff[j++] = SLIP_ESCAPE;
-        buff[j++] = SLIP_ESCAPE_END;
+        full = true;
       }
-      else if (data[i] == SLIP_ESCAPE)
+    }
+    else
+    {
+      uint16_t run = enc->len - enc->pos;
+
+      if (run > room)
+      {
+        run = room;
+      }
+      run = slip_plain_run(&enc->data[enc->pos], run);
+
+      if (run > 0U)
       {
-        buff[j++] = SLIP_ESCAPE;
-        buff[j++] = SLIP_ESCAPE_ES;
+        /* Copy the bytes which do not need escaping at once. */
+        (void)memcpy(&out[j], &enc->data[enc->pos], run);
+        j += run;
+        enc->pos += run;
+      }
+      else if (room >= 2U)
+      {
+        out[j++] = SLIP_ESCAPE;
+        out[j++] = slip_escape_code(enc->data[enc->pos]);
+        enc->pos++;
       }
       else
       {
-        buff[j++] = data[i];
+        full = true;
       }
     }
-    buff[j++] = SLIP_END;
-    *outlen = j;
   }
 
-  return buff;
+  return j;
 }
 
 
-mx_buf_t *slip_input_byte(uint8_t data)
+uint16_t slip_encode(const uint8_t data[], uint16_t len, uint8_t out[], uint16_t out_size)
 {
-  mx_buf_t *outgoing_nbuf = NULL;
-  static uint16_t slip_state = SLIP_STATE_IDLE;
-  static uint16_t slip_index = 0;
-  static uint8_t *slip_buffer = NULL;
-  static mx_buf_t *nbuf = NULL;
-  bool do_reset = false;
+  slip_encoder_t enc;
+  uint16_t outlen;
+
+  slip_encoder_init(&enc, data, len);
+  outlen = slip_encode_next(&enc, out, out_size);
+
+  return slip_encoder_done(&enc) ? outlen : 0U;
+}
 
-  if (slip_buffer == NULL)
+
+uint16_t slip_encoded_size(const uint8_t data[], uint16_t len)
+{
+  uint16_t size = len + 2U;
+  uint16_t i = 0;
+
+  while (i < len)
   {
-    bool first_miss = true;
-    do
+    i += slip_plain_run(&data[i], len - i);
+    if (i < len)
     {
-      nbuf = MX_NET_BUFFER_ALLOC(SLIP_BUFFER_SIZE);
-      if (nbuf == NULL)
-      {
-        DELAY_MS(1);
-        if (true == first_miss)
-        {
-          first_miss = false;
-          DEBUG_WARNING("Running out of buffer for RX\n");
-        }
-      }
-    } while (NULL == nbuf);
-    slip_buffer = MX_NET_BUFFER_PAYLOAD(nbuf);
-    DEBUG_LOG("SLIP buffer: %p\n", slip_buffer);
+      size++;
+      i++;
+    }
   }
 
-  if (slip_index >= SLIP_BUFFER_SIZE)
+  return size;
+}
+
+
+uint8_t *slip_transfer(uint8_t data[], uint16_t len, uint16_t *outlen)
+{
+  const uint16_t size = slip_encoded_size(data, len);
+  uint8_t *buff = NULL;
+
+  buff = (uint8_t *)MX_WIFI_MALLOC(size);
+
+  if (buff != NULL)
   {
-    slip_index = 0;
-    slip_state = SLIP_STATE_IDLE;
+    *outlen = slip_encode(data, len, buff, size);
   }
 
-  switch (slip_state)
+  return buff;
+}
+
+
+/**
+  * @brief  Process one byte of the receive state machine
+  * @param  data: serial byte
+  * @retval new SLIP frame, NULL if no new frame
+  */
+static mx_buf_t *slip_input_one(uint8_t data)
+{
+  mx_buf_t *outgoing_nbuf = NULL;
+  bool do_reset = false;
+
+  if (SlipRx.index >= SLIP_BUFFER_SIZE)
+  {
+    SlipRx.index = 0;
+    SlipRx.state = SLIP_STATE_IDLE;
+  }
+
+  switch (SlipRx.state)
   {
     case SLIP_STATE_GOT_ESCAPE:
     {
       if (data == SLIP_START)
       {
-        slip_index = 0;
+        SlipRx.index = 0;
       }
       else if (data == SLIP_ESCAPE_START)
       {
-        slip_buffer[slip_index++] = SLIP_START;
+        SlipRx.buffer[SlipRx.index++] = SLIP_START;
       }
       else if (data == SLIP_ESCAPE_ES)
       {
-        slip_buffer[slip_index++] = SLIP_ESCAPE;
+        SlipRx.buffer[SlipRx.index++] = SLIP_ESCAPE;
       }
       else if (data == SLIP_ESCAPE_END)
       {
-        slip_buffer[slip_index++] = SLIP_END;
+        SlipRx.buffer[SlipRx.index++] = SLIP_END;
       }
       else
       {
@@ -165,7 +311,7 @@ mx_buf_t *slip_input_byte(uint8_t data)
 
       if (!do_reset)
       {
-        slip_state = SLIP_STATE_CONTINUE;
+        SlipRx.state = SLIP_STATE_CONTINUE;
       }
     }
     break;
@@ -174,8 +320,8 @@ mx_buf_t *slip_input_byte(uint8_t data)
     {
       if (data == SLIP_START)
       {
-        slip_index = 0;
-        slip_state = SLIP_STATE_CONTINUE;
+        SlipRx.index = 0;
+        SlipRx.state = SLIP_STATE_CONTINUE;
       }
     }
     break;
@@ -184,24 +330,24 @@ mx_buf_t *slip_input_byte(uint8_t data)
     {
       if (data == SLIP_START)
       {
-        slip_index = 0;
-        slip_state = SLIP_STATE_CONTINUE;
+        SlipRx.index = 0;
+        SlipRx.state = SLIP_STATE_CONTINUE;
       }
       else if (data == SLIP_END)
       {
-        outgoing_nbuf = nbuf;
-        slip_buffer = NULL;
-        MX_NET_BUFFER_SET_PAYLOAD_SIZE(nbuf, slip_index);
-        nbuf = NULL;
+        outgoing_nbuf = SlipRx.nbuf;
+        SlipRx.buffer = NULL;
+        MX_NET_BUFFER_SET_PAYLOAD_SIZE(SlipRx.nbuf, SlipRx.index);
+        SlipRx.nbuf = NULL;
         do_reset = true;
       }
       else if (data == SLIP_ESCAPE)
       {
-        slip_state = SLIP_STATE_GOT_ESCAPE;
+        SlipRx.state = SLIP_STATE_GOT_ESCAPE;
       }
       else
       {
-        slip_buffer[slip_index++] = data;
+        SlipRx.buffer[SlipRx.index++] = data;
       }
     }
     break;
@@ -212,9 +358,89 @@ mx_buf_t *slip_input_byte(uint8_t data)
 
   if (do_reset)
   {
-    slip_index = 0;
-    slip_state = SLIP_STATE_IDLE;
+    SlipRx.index = 0;
+    SlipRx.state = SLIP_STATE_IDLE;
+  }
+
+  return outgoing_nbuf;
+}
+
+
+mx_buf_t *slip_input_block(const uint8_t data[], uint16_t len, uint16_t *consumed)
+{
+  mx_buf_t *outgoing_nbuf = NULL;
+  uint16_t i = 0;
+
+  if (SlipRx.buffer == NULL)
+  {
+    bool first_miss = true;
+    do
+    {
+      SlipRx.nbuf = MX_NET_BUFFER_ALLOC(SLIP_BUFFER_SIZE);
+      if (SlipRx.nbuf == NULL)
+      {
+        DELAY_MS(1);
+        if (true == first_miss)
+        {
+          first_miss = false;
+          DEBUG_WARNING("Running out of buffer for RX\n");
+        }
+      }
+    } while (NULL == SlipRx.nbuf);
+    SlipRx.buffer = MX_NET_BUFFER_PAYLOAD(SlipRx.nbuf);
+    DEBUG_LOG("SLIP buffer: %p\n", SlipRx.buffer);
   }
 
+  /* Stop at the end of a frame, the next frame needs a new buffer. */
+  while ((i < len) && (NULL == outgoing_nbuf))
+  {
+    uint16_t run = 0;
+
+    if (SLIP_STATE_CONTINUE == SlipRx.state)
+    {
+      /* Copy the bytes up to the next special character at once. */
+      if (SlipRx.index < SLIP_BUFFER_SIZE)
+      {
+        run = SLIP_BUFFER_SIZE - SlipRx.index;
+        if (run > (len - i))
+        {
+          run = len - i;
+        }
+        run = slip_plain_run(&data[i], run);
+        (void)memcpy(&SlipRx.buffer[SlipRx.index], &data[i], run);
+        SlipRx.index += run;
+      }
+    }
+    else if (SLIP_STATE_IDLE == SlipRx.state)
+    {
+      /* Skip everything up to the next frame start. */
+      const uint8_t *start = (const uint8_t *)memchr(&data[i], SLIP_START, (size_t)len - i);
+
+      run = (start == NULL) ? (len - i) : (uint16_t)(start - &data[i]);
+    }
+    else
+    {
+      /* Escaped byte, handled below. */
+    }
+
+    i += run;
+
+    if ((run == 0U) && (i < len))
+    {
+      outgoing_nbuf = slip_input_one(data[i]);
+      i++;
+    }
+  }
+
+  *consumed = i;
+
   return outgoing_nbuf;
 }
+
+
+mx_buf_t *slip_input_byte(uint8_t data)
+{
+  uint16_t consumed;
+
+  return slip_input_block(&data, 1, &consumed);
+}
@@ -26,6 +26,7 @@ extern "C" {
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
+#include <stdbool.h>
 
 /*
  * CONFIGURATIONS
@@ -39,6 +40,15 @@ extern "C" {
  * |--------+---------+--------|
  */
 
+/* Incremental SLIP encoder, see slip_encode_next. */
+typedef struct
+{
+  const uint8_t *data;
+  uint16_t len;
+  uint16_t pos;
+  uint8_t state;
+} slip_encoder_t;
+
 /*
  * API
  */
@@ -53,6 +63,61 @@ extern "C" {
 uint8_t *slip_transfer(uint8_t data[], uint16_t len, uint16_t *outlen);
 
 
+/**
+  * @brief  Size of the SLIP packet of HCI data
+  *
+  * @param  data: data to be transfer
+  * @param  len: size of the data to be transfer
+  * @retval size of the SLIP packet, START and END included
+  */
+uint16_t slip_encoded_size(const uint8_t data[], uint16_t len);
+
+
+/**
+  * @brief  transfer HCI data to SLIP packet in a caller buffer
+  *
+  * @param  data: data to be transfer
+  * @param  len: size of the data to be transfer
+  * @param  out: buffer receiving the SLIP packet
+  * @param  out_size: size of the buffer, see slip_encoded_size
+  * @retval size of the SLIP packet, 0 if the buffer is too small
+  */
+uint16_t slip_encode(const uint8_t data[], uint16_t len, uint8_t out[], uint16_t out_size);
+
+
+/**
+  * @brief  Start the incremental transfer of HCI data to SLIP packet
+  * @note   data must remain valid until slip_encoder_done returns true
+  *
+  * @param  enc: encoder context
+  * @param  data: data to be transfer
+  * @param  len: size of the data to be transfer
+  */
+void slip_encoder_init(slip_encoder_t *enc, const uint8_t data[], uint16_t len);
+
+
+/**
+  * @brief  Write the next part of the SLIP packet
+  * @note   runs of bytes which need no escaping are copied at once, so the
+  *         packet can be produced in a small buffer and sent part by part
+  *
+  * @param  enc: encoder context
+  * @param  out: buffer receiving the next part of the SLIP packet
+  * @param  out_size: size of the buffer, at least 2 bytes
+  * @retval number of bytes written, 0 when the packet is complete
+  */
+uint16_t slip_encode_next(slip_encoder_t *enc, uint8_t out[], uint16_t out_size);
+
+
+/**
+  * @brief  Check if the whole SLIP packet has been written
+  *
+  * @param  enc: encoder context
+  * @retval true if the END byte has been written
+  */
+bool slip_encoder_done(const slip_encoder_t *enc);
+
+
 /**
   * @brief  Feed one serial byte to SLIP
   * @note   use slip_buf_free to free slip buffer if data process finished
@@ -63,6 +128,19 @@ uint8_t *slip_transfer(uint8_t data[], uint16_t len, uint16_t *outlen);
 mx_buf_t *slip_input_byte(uint8_t data);
 
 
+/**
+  * @brief  Feed a block of serial bytes to SLIP
+  * @note   the block is consumed up to the end of the first completed frame,
+  *         call again with the remaining bytes
+  *
+  * @param  data: serial bytes, for example a contiguous segment of a ring buffer
+  * @param  len: number of serial bytes
+  * @param  consumed: number of bytes consumed
+  * @retval new SLIP frame, NULL if no new frame
+  */
+mx_buf_t *slip_input_block(const uint8_t data[], uint16_t len, uint16_t *consumed);
+
+
 /**
   * @brief  free slip frame buffer returned by slip_input_byte
   *
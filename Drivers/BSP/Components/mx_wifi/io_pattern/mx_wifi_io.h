@@ -29,6 +29,46 @@ extern "C" {
 #include "mx_wifi.h"
 
 
+/* States of the SPI link in the time in state histograms. */
+#define MX_WIFI_SPI_STATE_WAIT_FLOW  (0U)  /* Waiting for the module to raise FLOW. */
+#define MX_WIFI_SPI_STATE_HEADER     (1U)  /* Header exchange. */
+#define MX_WIFI_SPI_STATE_DATA       (2U)  /* Data transfer. */
+#define MX_WIFI_SPI_STATE_COUNT      (3U)
+
+/* Histogram bucket 0 counts the times below MX_WIFI_SPI_HIST_BASE_US, each next bucket */
+/* doubles the limit and the last one counts all the longer times.                      */
+#define MX_WIFI_SPI_HIST_BASE_US     (8U)
+#define MX_WIFI_SPI_HIST_BUCKETS     (10U)
+
+/* SPI transfer statistics. */
+typedef struct
+{
+  uint32_t dma_transfers;  /* Transfers done by DMA. */
+  uint32_t poll_transfers; /* Transfers done by polling. */
+  uint32_t errors;         /* Failed transfers, including timeouts. */
+  uint32_t timeouts;       /* DMA transfers aborted on timeout. */
+  uint32_t frames;         /* Completed frames. */
+  /* CPU cycles per phase of the completed frames, counted with MX_WIFI_SPI_TIMING only. */
+  uint64_t handshake_cycles;     /* Chip select, FLOW waits and header exchange. */
+  uint64_t data_cycles;          /* Data transfer. */
+  uint32_t handshake_cycles_max;
+  uint32_t data_cycles_max;
+  uint32_t tx_frames;      /* Frames put in the TX queue. */
+  uint32_t tx_queue_max;   /* Maximum number of frames waiting in the TX queue. */
+  uint32_t tx_wait_ms;     /* Time spent by the senders waiting for a free place in the TX queue. */
+  uint32_t tx_wait_ms_max;
+  uint32_t flow_stale;     /* FLOW rising edges found with FLOW low again, ignored. */
+  uint32_t tx_bytes;       /* Data bytes sent in the completed frames. */
+  uint32_t rx_bytes;       /* Data bytes received in the completed frames. */
+  uint32_t flow_waits;     /* Waits for FLOW high. */
+  uint32_t flow_timeouts;  /* Waits for FLOW high ended by the timeout. */
+  uint32_t flow_wait_ms;   /* Time spent waiting for FLOW high, counted with the system tick. */
+  uint32_t flow_wait_ms_max;
+  uint32_t rx_no_buffer;   /* Times the link waited for a free RX buffer. */
+  /* Time in state histograms in microseconds, counted with MX_WIFI_SPI_TIMING only. */
+  uint32_t state_hist[MX_WIFI_SPI_STATE_COUNT][MX_WIFI_SPI_HIST_BUCKETS];
+} mx_wifi_spi_stat_t;
+
 /**
   * @brief  Create internal connections to the had hoc bus.
   * @param  ll_drv_context
@@ -48,6 +88,9 @@ void mxchip_WIFI_ISR(uint16_t isr_source);
 /* The handler of SPI transfer with the WiFi module. */
 void HAL_SPI_TransferCallback(void *hspi);
 
+/* Get the SPI transfer statistics. */
+void mx_wifi_spi_get_stat(mx_wifi_spi_stat_t *stat);
+
 /* The handler for the WiFi module UART interrupts (byte received). */
 void mxchip_WIFI_ISR_UART(void *huart);
 
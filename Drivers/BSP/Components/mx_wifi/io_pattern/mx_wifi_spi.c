@@ -80,12 +80,43 @@ typedef struct _spi_header
 #define NET_PERF_TASK_TAG(...)
 #endif /* NET_PERF_TASK_TAG */
 
+#ifndef MX_WIFI_SPI_DMA_MIN_SIZE
+#define MX_WIFI_SPI_DMA_MIN_SIZE (16)
+#endif /* MX_WIFI_SPI_DMA_MIN_SIZE */
+
+#ifndef MX_WIFI_SPI_TIMING
+#define MX_WIFI_SPI_TIMING (0)
+#endif /* MX_WIFI_SPI_TIMING */
+
+#if (MX_WIFI_SPI_TIMING == 1)
+/* Frame timing with the DWT cycle counter. */
+#define SPI_TIMING_INIT()                                   \
+  do {                                                      \
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;         \
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                    \
+  } while(0)
+
+#define SPI_TIMING_GET()    (DWT->CYCCNT)
+#else
+#define SPI_TIMING_INIT()
+#define SPI_TIMING_GET()    (0U)
+#endif /* MX_WIFI_SPI_TIMING */
+
 /* Private define ------------------------------------------------------------*/
 /* SPI protocol */
 #define SPI_WRITE         ((uint8_t)0x0A)
 #define SPI_READ          ((uint8_t)0x0B)
 #define SPI_DATA_SIZE     (MX_WIFI_HCI_DATA_SIZE)
 
+/* Maximum number of segments of a frame sent by gather send. */
+#define SPI_TX_SEG_MAX    (4U)
+
+/* No sender ticket. */
+#define SPI_TX_TICKET_NONE  (0xFFU)
+
+/* Number of frames that can wait in the TX queue. */
+#define SPI_TX_QUEUE_SIZE (MX_WIFI_MAX_TX_BUFFER_COUNT)
+
 /* HW RESET */
 
 #define MX_WIFI_HW_RESET()                                                    \
@@ -124,13 +155,64 @@ static MX_WIFIObject_t MxWifiObj = {0};
 static SPI_HandleTypeDef *const HSpiMX = &MXCHIP_SPI;
 
 static LOCK_DECLARE(SpiTxLock);
+static LOCK_DECLARE(SpiTxQueueLock);
 
 static SEM_DECLARE(SpiTxRxSem);
+static SEM_DECLARE(SpiTxFreeSem);
 static SEM_DECLARE(SpiFlowRiseSem);
 static SEM_DECLARE(SpiTransferDoneSem);
 
-static uint8_t *SpiTxData = NULL;
-static uint16_t SpiTxLen  = 0;
+/* Frame waiting in the TX queue, a frame cancelled by its sender has no segment. */
+typedef struct
+{
+  MX_WIFI_IO_Segment_t seg[SPI_TX_SEG_MAX];
+  uint8_t seg_count;
+  uint16_t len;
+  uint8_t ticket;
+} spi_tx_frame_t;
+
+/* Completion ticket of a sender, signaled once its frame no longer references the sender buffers. */
+typedef struct
+{
+  SEM_DECLARE(done);
+  bool in_use;
+} spi_tx_ticket_t;
+
+/* TX queue filled by the sending threads under SpiTxQueueLock and drained by the TX/RX thread. */
+static spi_tx_frame_t SpiTxQueue[SPI_TX_QUEUE_SIZE];
+static uint8_t SpiTxQueueHead = 0;
+static __IO uint8_t SpiTxQueueCount = 0;
+
+/* Tickets of the senders, and the one of the frame owned by the TX/RX thread, under SpiTxQueueLock. */
+static spi_tx_ticket_t SpiTxTicket[SPI_TX_QUEUE_SIZE];
+static uint8_t SpiTxActiveTicket = SPI_TX_TICKET_NONE;
+
+#if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
+/* Segmented frame whose DMA transfers are chained from the transfer complete callback. */
+typedef struct
+{
+  const MX_WIFI_IO_Segment_t *seg;
+  uint8_t seg_count;
+  uint8_t seg_index;
+  uint8_t *rxdata;
+  uint16_t rxlen;
+  uint16_t offset;
+  __IO bool active;
+} spi_tx_chain_t;
+
+static spi_tx_chain_t SpiTxChain;
+
+/* Result of the last DMA transfer, updated by the transfer and error callbacks. */
+static __IO HAL_StatusTypeDef SpiTransferStatus = HAL_OK;
+#endif /* (DMA_ON_USE == 1) */
+
+/* Link statistics, the sender and per frame counters and the snapshot are under SpiTxQueueLock. */
+static mx_wifi_spi_stat_t SpiStat;
+
+/* Current state of the SPI link and its start time, for the time in state histograms. */
+#define SPI_STATE_IDLE    (0xFFU)
+static uint8_t SpiState = SPI_STATE_IDLE;
+static uint32_t SpiStateStart = 0;
 
 /* Private functions ---------------------------------------------------------*/
 static uint16_t MX_WIFI_SPI_Read(uint8_t *buffer, uint16_t buff_size);
@@ -138,9 +220,18 @@ static HAL_StatusTypeDef TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *txdat
                                          uint32_t timeout);
 static HAL_StatusTypeDef Transmit(SPI_HandleTypeDef *hspi, uint8_t *txdata, uint16_t datalen, uint32_t timeout);
 static HAL_StatusTypeDef Receive(SPI_HandleTypeDef *hspi, uint8_t *rxdata, uint16_t datalen, uint32_t timeout);
+static HAL_StatusTypeDef TransmitSegments(SPI_HandleTypeDef *hspi, const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count,
+                                          uint8_t *rxdata, uint16_t datalen, uint32_t timeout);
+static void FrameDone(uint32_t t_frame, uint32_t t_data, uint16_t tx_len, uint16_t rx_len);
+static void StateEnter(uint8_t state);
+#if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
+static bool TransmitSegmentNext(SPI_HandleTypeDef *hspi);
+static HAL_StatusTypeDef WaitTransferDone(SPI_HandleTypeDef *hspi, HAL_StatusTypeDef status, uint32_t timeout);
+#endif /* (DMA_ON_USE == 1) */
 
 static int8_t wait_flow_high(uint32_t timeout);
 static uint16_t MX_WIFI_SPI_Write(uint8_t *data, uint16_t len);
+static uint16_t MX_WIFI_SPI_WriteV(const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count);
 
 static int8_t mx_wifi_spi_txrx_start(void);
 static int8_t mx_wifi_spi_txrx_stop(void);
@@ -236,6 +327,19 @@ void HAL_SPI_TransferCallback(void *hspi)
 #endif
 {
   (void)hspi;
+
+#if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
+  /* Start the next transfer of a segmented frame without waking up the SPI thread. */
+  if (SpiTxChain.active)
+  {
+    if (TransmitSegmentNext(HSpiMX))
+    {
+      return;
+    }
+    SpiTxChain.active = false;
+  }
+#endif /* (DMA_ON_USE == 1) */
+
   SEM_SIGNAL(SpiTransferDoneSem);
 }
 
@@ -248,7 +352,14 @@ void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi)
 {
   if (hspi == HSpiMX)
   {
+#if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
+    /* The HAL has already stopped the transfer, report the error to the waiting thread. */
+    SpiTxChain.active = false;
+    SpiTransferStatus = HAL_ERROR;
+    SEM_SIGNAL(SpiTransferDoneSem);
+#else
     MX_ASSERT(false);
+#endif /* (DMA_ON_USE == 1) */
   }
 }
 
@@ -273,17 +384,44 @@ void mxchip_WIFI_ISR(uint16_t isr_source)
 }
 
 
+/* Wait for the FLOW rising edge signaled by its interrupt. An edge found with FLOW */
+/* low again is a stale one (raised before the wait started) and is ignored.       */
 static int8_t wait_flow_high(uint32_t timeout)
 {
-  int8_t ret = 0;
-  if (SEM_WAIT(SpiFlowRiseSem, timeout, NULL) != SEM_OK)
+  int8_t ret = -1;
+  const uint32_t tickstart = HAL_GetTick();
+  uint32_t elapsed = 0;
+
+  StateEnter(MX_WIFI_SPI_STATE_WAIT_FLOW);
+
+  while (SEM_WAIT(SpiFlowRiseSem, timeout - elapsed, NULL) == SEM_OK)
   {
-    ret = -1;
+    if (!MX_WIFI_SPI_FLOW_IS_LOW())
+    {
+      ret = 0;
+      break;
+    }
+    SpiStat.flow_stale++;
+
+    elapsed = HAL_GetTick() - tickstart;
+    if (elapsed >= timeout)
+    {
+      DEBUG_ERROR("FLOW is low\n");
+      break;
+    }
   }
-  if (MX_WIFI_SPI_FLOW_IS_LOW())
+
+  /* The tick resolution is coarse, the total is accurate over many waits. */
+  elapsed = HAL_GetTick() - tickstart;
+  SpiStat.flow_waits++;
+  SpiStat.flow_wait_ms += elapsed;
+  if (elapsed > SpiStat.flow_wait_ms_max)
   {
-    DEBUG_ERROR("FLOW is low\n");
-    ret = -1;
+    SpiStat.flow_wait_ms_max = elapsed;
+  }
+  if (0 != ret)
+  {
+    SpiStat.flow_timeouts++;
   }
 
   DEBUG_LOG("\n%s()< %" PRIi32 "\n\n", __FUNCTION__, (int32_t)ret);
@@ -293,33 +431,146 @@ static int8_t wait_flow_high(uint32_t timeout)
 
 
 static uint16_t MX_WIFI_SPI_Write(uint8_t *data, uint16_t len)
+{
+  const MX_WIFI_IO_Segment_t seg = {data, len};
+
+  return MX_WIFI_SPI_WriteV(&seg, 1);
+}
+
+
+static uint16_t MX_WIFI_SPI_WriteV(const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count)
 {
   uint16_t sent;
+  uint32_t len = 0;
+  bool is_valid = (NULL != seg) && (seg_count > 0U) && (seg_count <= SPI_TX_SEG_MAX);
 
-  DEBUG_LOG("\n%s()> %" PRIu32 "\n\n", __FUNCTION__, (uint32_t)len);
+  for (uint8_t i = 0; (true == is_valid) && (i < seg_count); i++)
+  {
+    if (NULL == seg[i].data)
+    {
+      is_valid = false;
+    }
+    len += seg[i].len;
+  }
 
-  LOCK(SpiTxLock);
+  DEBUG_LOG("\n%s()> %" PRIu32 "\n\n", __FUNCTION__, len);
 
-  if ((NULL == data) || (0 == len) || (len > SPI_DATA_SIZE))
+  if ((false == is_valid) || (0U == len) || (len > SPI_DATA_SIZE))
   {
-    DEBUG_ERROR("Warning, SPI send null or size overflow! len=%" PRIu32 "\n", (uint32_t)len);
-    SpiTxLen = 0;
+    DEBUG_ERROR("Warning, SPI send null or size overflow! len=%" PRIu32 "\n", len);
     sent = 0;
   }
   else
   {
-    SpiTxData = data;
-    SpiTxLen  = len;
+    const uint32_t tickstart = HAL_GetTick();
 
-    if (SEM_SIGNAL(SpiTxRxSem) != SEM_OK)
+    /* Wait for a free place in the TX queue. */
+    if (SEM_WAIT(SpiTxFreeSem, MX_WIFI_CMD_TIMEOUT, process_txrx_poll) != SEM_OK)
     {
-      /* Happen if received thread did not have a chance to run on time, need to increase priority */
-      DEBUG_ERROR("Warning, SPI semaphore has been already notified\n");
+      DEBUG_ERROR("Warning, SPI send timeout waiting for a free place in the TX queue\n");
+      sent = 0;
     }
-    sent = len;
-  }
+    else
+    {
+      const uint32_t wait_time = HAL_GetTick() - tickstart;
+      spi_tx_frame_t *frame;
+      spi_tx_ticket_t *ticket = NULL;
+      uint8_t ticket_id = 0;
+      bool cancelled = false;
+
+      LOCK(SpiTxQueueLock);
+
+      /* A ticket is free thanks to SpiTxFreeSem. */
+      while ((ticket_id < SPI_TX_QUEUE_SIZE) && (true == SpiTxTicket[ticket_id].in_use))
+      {
+        ticket_id++;
+      }
+      MX_ASSERT(ticket_id < SPI_TX_QUEUE_SIZE);
+      ticket = &SpiTxTicket[ticket_id];
+      ticket->in_use = true;
+      (void)SEM_WAIT(ticket->done, 0, NULL);
+
+      frame = &SpiTxQueue[(SpiTxQueueHead + SpiTxQueueCount) % SPI_TX_QUEUE_SIZE];
+      (void)memcpy(frame->seg, seg, seg_count * sizeof(frame->seg[0]));
+      frame->seg_count = seg_count;
+      frame->len = (uint16_t)len;
+      frame->ticket = ticket_id;
+      SpiTxQueueCount++;
+
+      SpiStat.tx_frames++;
+      SpiStat.tx_wait_ms += wait_time;
+      if (wait_time > SpiStat.tx_wait_ms_max)
+      {
+        SpiStat.tx_wait_ms_max = wait_time;
+      }
+      if (SpiTxQueueCount > SpiStat.tx_queue_max)
+      {
+        SpiStat.tx_queue_max = SpiTxQueueCount;
+      }
+
+      UNLOCK(SpiTxQueueLock);
+
+      if (SEM_SIGNAL(SpiTxRxSem) != SEM_OK)
+      {
+        /* Already notified, the TX/RX thread sends all the queued frames. */
+        DEBUG_LOG("SPI semaphore has been already notified\n");
+      }
+
+      /* The segments reference the caller buffers, wait until the frame has been sent. */
+      while (SEM_WAIT(ticket->done, MX_WIFI_CMD_TIMEOUT, process_txrx_poll) != SEM_OK)
+      {
+        bool is_queued = false;
+        bool is_active;
 
-  UNLOCK(SpiTxLock);
+        LOCK(SpiTxQueueLock);
+        is_active = (SpiTxActiveTicket == ticket_id);
+        if (false == is_active)
+        {
+          /* Not in the hands of the TX/RX thread, cancel the frame if it is still queued. */
+          for (uint8_t i = 0; i < SpiTxQueueCount; i++)
+          {
+            spi_tx_frame_t *const queued = &SpiTxQueue[(SpiTxQueueHead + i) % SPI_TX_QUEUE_SIZE];
+
+            if ((queued->seg_count > 0U) && (queued->ticket == ticket_id))
+            {
+              queued->seg_count = 0;
+              queued->ticket = SPI_TX_TICKET_NONE;
+              is_queued = true;
+            }
+          }
+        }
+        UNLOCK(SpiTxQueueLock);
+
+        if (true == is_queued)
+        {
+          DEBUG_ERROR("Warning, SPI send timeout, frame cancelled\n");
+          cancelled = true;
+          break;
+        }
+        if (false == is_active)
+        {
+          /* Sent meanwhile, the ticket has been signaled. */
+          (void)SEM_WAIT(ticket->done, 0, NULL);
+          break;
+        }
+      }
+
+      LOCK(SpiTxQueueLock);
+      ticket->in_use = false;
+      UNLOCK(SpiTxQueueLock);
+
+      if (true == cancelled)
+      {
+        /* The queue place is given back by the TX/RX thread when it drops the frame. */
+        sent = 0;
+      }
+      else
+      {
+        (void)SEM_SIGNAL(SpiTxFreeSem);
+        sent = (uint16_t)len;
+      }
+    }
+  }
 
   DEBUG_LOG("\n%s()< %" PRIi32 "\n\n", __FUNCTION__, (int32_t)sent);
 
@@ -350,12 +601,23 @@ static HAL_StatusTypeDef TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *txdat
 #endif /* 0 */
 
 #if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
-  ret = HAL_SPI_TransmitReceive_DMA(hspi, txdata, rxdata, datalen);
-  SEM_WAIT(SpiTransferDoneSem, timeout, NULL);
-
-#else
-  ret = HAL_SPI_TransmitReceive(hspi, txdata, rxdata, datalen, timeout);
+  if (datalen >= MX_WIFI_SPI_DMA_MIN_SIZE)
+  {
+    SpiTransferStatus = HAL_OK;
+    SpiStat.dma_transfers++;
+    ret = HAL_SPI_TransmitReceive_DMA(hspi, txdata, rxdata, datalen);
+    ret = WaitTransferDone(hspi, ret, timeout);
+  }
+  else
 #endif /* (DMA_ON_USE == 1) */
+  {
+    ret = HAL_SPI_TransmitReceive(hspi, txdata, rxdata, datalen, timeout);
+    SpiStat.poll_transfers++;
+    if (HAL_OK != ret)
+    {
+      SpiStat.errors++;
+    }
+  }
 
   DEBUG_LOG("\n%s()< %" PRIi32 "\n\n", __FUNCTION__, (int32_t)ret);
 
@@ -378,12 +640,23 @@ static HAL_StatusTypeDef Transmit(SPI_HandleTypeDef *hspi, uint8_t *txdata, uint
 
 
 #if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
-  ret = HAL_SPI_Transmit_DMA(hspi, txdata, datalen);
-  SEM_WAIT(SpiTransferDoneSem, timeout, NULL);
-
-#else
-  ret = HAL_SPI_Transmit(hspi, txdata, datalen, timeout);
+  if (datalen >= MX_WIFI_SPI_DMA_MIN_SIZE)
+  {
+    SpiTransferStatus = HAL_OK;
+    SpiStat.dma_transfers++;
+    ret = HAL_SPI_Transmit_DMA(hspi, txdata, datalen);
+    ret = WaitTransferDone(hspi, ret, timeout);
+  }
+  else
 #endif /* (DMA_ON_USE == 1) */
+  {
+    ret = HAL_SPI_Transmit(hspi, txdata, datalen, timeout);
+    SpiStat.poll_transfers++;
+    if (HAL_OK != ret)
+    {
+      SpiStat.errors++;
+    }
+  }
 
   DEBUG_LOG("\n%s() <%" PRIi32 "\n\n", __FUNCTION__, (int32_t)ret);
 
@@ -398,12 +671,23 @@ static HAL_StatusTypeDef Receive(SPI_HandleTypeDef *hspi, uint8_t *rxdata, uint1
   DEBUG_LOG("\n%s()> %" PRIu32 "\n", __FUNCTION__, (uint32_t)datalen);
 
 #if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
-  ret = HAL_SPI_Receive_DMA(hspi, rxdata, datalen);
-  SEM_WAIT(SpiTransferDoneSem, timeout, NULL);
-
-#else
-  ret = HAL_SPI_Receive(hspi, rxdata, datalen, timeout);
+  if (datalen >= MX_WIFI_SPI_DMA_MIN_SIZE)
+  {
+    SpiTransferStatus = HAL_OK;
+    SpiStat.dma_transfers++;
+    ret = HAL_SPI_Receive_DMA(hspi, rxdata, datalen);
+    ret = WaitTransferDone(hspi, ret, timeout);
+  }
+  else
 #endif /* (DMA_ON_USE == 1) */
+  {
+    ret = HAL_SPI_Receive(hspi, rxdata, datalen, timeout);
+    SpiStat.poll_transfers++;
+    if (HAL_OK != ret)
+    {
+      SpiStat.errors++;
+    }
+  }
 
 #if 0
   for (uint32_t i = 0; i < datalen; i++)
@@ -418,6 +702,223 @@ static HAL_StatusTypeDef Receive(SPI_HandleTypeDef *hspi, uint8_t *rxdata, uint1
 }
 
 
+#if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
+/* Start the DMA transfer of the next non empty segment of the chain, or the     */
+/* reception of the remaining data. Returns false when nothing has been started. */
+/* Called from the SPI thread for the first transfer and from the transfer       */
+/* complete callback for the following ones.                                    */
+static bool TransmitSegmentNext(SPI_HandleTypeDef *hspi)
+{
+  bool started = false;
+
+  while ((SpiTxChain.seg_index < SpiTxChain.seg_count) && (0U == SpiTxChain.seg[SpiTxChain.seg_index].len))
+  {
+    SpiTxChain.seg_index++;
+  }
+
+  if (SpiTxChain.seg_index < SpiTxChain.seg_count)
+  {
+    const MX_WIFI_IO_Segment_t *const seg = &SpiTxChain.seg[SpiTxChain.seg_index];
+
+    if (NULL != SpiTxChain.rxdata)
+    {
+      SpiTransferStatus = HAL_SPI_TransmitReceive_DMA(hspi, (uint8_t *)seg->data,
+                                                      &SpiTxChain.rxdata[SpiTxChain.offset], seg->len);
+    }
+    else
+    {
+      SpiTransferStatus = HAL_SPI_Transmit_DMA(hspi, (uint8_t *)seg->data, seg->len);
+    }
+    SpiTxChain.offset += seg->len;
+    SpiTxChain.seg_index++;
+    SpiStat.dma_transfers++;
+    started = (HAL_OK == SpiTransferStatus);
+  }
+  else if ((NULL != SpiTxChain.rxdata) && (SpiTxChain.rxlen > SpiTxChain.offset))
+  {
+    /* Receive the rest when more data is received than transmitted. */
+    SpiTransferStatus = HAL_SPI_Receive_DMA(hspi, &SpiTxChain.rxdata[SpiTxChain.offset],
+                                            SpiTxChain.rxlen - SpiTxChain.offset);
+    SpiTxChain.offset = SpiTxChain.rxlen;
+    SpiStat.dma_transfers++;
+    started = (HAL_OK == SpiTransferStatus);
+  }
+  else
+  {
+    /* End of the chain. */
+  }
+
+  return started;
+}
+
+
+/* Wait for the end of a DMA transfer started with the given status. On timeout    */
+/* the transfer is aborted so that the SPI and its DMA channels can be reused.     */
+/* The data buffers are in internal SRAM which is not cached on this device, and  */
+/* the SPI DMA channels use byte accesses: no cache maintenance nor alignment is   */
+/* required.                                                                        */
+static HAL_StatusTypeDef WaitTransferDone(SPI_HandleTypeDef *hspi, HAL_StatusTypeDef status, uint32_t timeout)
+{
+  HAL_StatusTypeDef ret = status;
+
+  if (HAL_OK == ret)
+  {
+    if (SEM_WAIT(SpiTransferDoneSem, timeout, NULL) != SEM_OK)
+    {
+      SpiTxChain.active = false;
+      (void)HAL_SPI_Abort(hspi);
+
+      /* Discard a completion signaled while aborting. */
+      (void)SEM_WAIT(SpiTransferDoneSem, 0, NULL);
+
+      SpiStat.timeouts++;
+      ret = HAL_TIMEOUT;
+    }
+    else
+    {
+      ret = SpiTransferStatus;
+    }
+  }
+
+  if (HAL_OK != ret)
+  {
+    SpiStat.errors++;
+    DEBUG_ERROR("SPI DMA transfer failed (%" PRIi32 ")\n", (int32_t)ret);
+  }
+
+  return ret;
+}
+#endif /* (DMA_ON_USE == 1) */
+
+
+/* Transmit the segments one after the other in the current chip select frame, */
+/* receiving at the same time when RX data is expected.                         */
+/* With DMA the transfers are chained from the transfer complete callback so    */
+/* that the SPI thread is woken up only once per frame.                         */
+static HAL_StatusTypeDef TransmitSegments(SPI_HandleTypeDef *hspi, const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count,
+                                          uint8_t *rxdata, uint16_t datalen, uint32_t timeout)
+{
+  HAL_StatusTypeDef ret = HAL_OK;
+
+#if (defined(DMA_ON_USE) && (DMA_ON_USE == 1))
+  SpiTxChain.seg = seg;
+  SpiTxChain.seg_count = seg_count;
+  SpiTxChain.seg_index = 0;
+  SpiTxChain.rxdata = rxdata;
+  SpiTxChain.rxlen = datalen;
+  SpiTxChain.offset = 0;
+  SpiTxChain.active = true;
+  SpiTransferStatus = HAL_OK;
+
+  if (TransmitSegmentNext(hspi))
+  {
+    ret = WaitTransferDone(hspi, HAL_OK, timeout);
+  }
+  else
+  {
+    ret = SpiTransferStatus;
+    if (HAL_OK != ret)
+    {
+      SpiStat.errors++;
+    }
+  }
+
+  SpiTxChain.active = false;
+
+#else
+  uint16_t offset = 0;
+
+  for (uint8_t i = 0; (i < seg_count) && (HAL_OK == ret); i++)
+  {
+    if (seg[i].len > 0U)
+    {
+      if (NULL != rxdata)
+      {
+        ret = TransmitReceive(hspi, (uint8_t *)seg[i].data, &rxdata[offset], seg[i].len, timeout);
+      }
+      else
+      {
+        ret = Transmit(hspi, (uint8_t *)seg[i].data, seg[i].len, timeout);
+      }
+      offset += seg[i].len;
+    }
+  }
+
+  /* Receive the rest when more data is received than transmitted. */
+  if ((HAL_OK == ret) && (NULL != rxdata) && (datalen > offset))
+  {
+    ret = Receive(hspi, &rxdata[offset], datalen - offset, timeout);
+  }
+#endif /* (DMA_ON_USE == 1) */
+
+  return ret;
+}
+
+
+/* Account a completed frame. The handshake phase goes from chip select to the */
+/* start of the data phase: both FLOW waits and the header exchange.          */
+static void FrameDone(uint32_t t_frame, uint32_t t_data, uint16_t tx_len, uint16_t rx_len)
+{
+  LOCK(SpiTxQueueLock);
+
+  SpiStat.frames++;
+  SpiStat.tx_bytes += tx_len;
+  SpiStat.rx_bytes += rx_len;
+
+#if (MX_WIFI_SPI_TIMING == 1)
+  {
+    const uint32_t t_end = SPI_TIMING_GET();
+    const uint32_t handshake = t_data - t_frame;
+    const uint32_t data = t_end - t_data;
+
+    SpiStat.handshake_cycles += handshake;
+    SpiStat.data_cycles += data;
+    if (handshake > SpiStat.handshake_cycles_max)
+    {
+      SpiStat.handshake_cycles_max = handshake;
+    }
+    if (data > SpiStat.data_cycles_max)
+    {
+      SpiStat.data_cycles_max = data;
+    }
+  }
+#else
+  (void)t_frame;
+  (void)t_data;
+#endif /* MX_WIFI_SPI_TIMING */
+
+  UNLOCK(SpiTxQueueLock);
+}
+
+
+/* Enter a state of the SPI link, the time spent in the previous state goes to its */
+/* histogram.                                                                      */
+static void StateEnter(uint8_t state)
+{
+#if (MX_WIFI_SPI_TIMING == 1)
+  const uint32_t now = SPI_TIMING_GET();
+
+  if (SpiState < MX_WIFI_SPI_STATE_COUNT)
+  {
+    const uint32_t cycles_per_us = (SystemCoreClock / 1000000U) + 1U;
+    const uint32_t us = (now - SpiStateStart) / cycles_per_us;
+    uint32_t limit = MX_WIFI_SPI_HIST_BASE_US;
+    uint32_t bucket = 0;
+
+    while ((bucket < (MX_WIFI_SPI_HIST_BUCKETS - 1U)) && (us >= limit))
+    {
+      bucket++;
+      limit <<= 1;
+    }
+    SpiStat.state_hist[SpiState][bucket]++;
+  }
+  SpiStateStart = now;
+#endif /* MX_WIFI_SPI_TIMING */
+
+  SpiState = state;
+}
+
+
 void process_txrx_poll(uint32_t timeout)
 {
   static mx_buf_t *netb = NULL;
@@ -437,13 +938,14 @@ void process_txrx_poll(uint32_t timeout)
       if (true == first_miss)
       {
         first_miss = false;
+        SpiStat.rx_no_buffer++;
         DEBUG_WARNING("Running Out of buffer for RX\n");
       }
     }
   }
 
-  /* Waiting for data to be sent or to be received. */
-  if (SEM_WAIT(SpiTxRxSem, timeout, NULL) == SEM_OK)
+  /* Waiting for data to be sent or to be received, queued frames are sent back to back. */
+  if ((SpiTxQueueCount > 0U) || (SEM_WAIT(SpiTxRxSem, timeout, NULL) == SEM_OK))
   {
     NET_PERF_TASK_TAG(0);
 
@@ -452,11 +954,37 @@ void process_txrx_poll(uint32_t timeout)
       spi_header_t mheader = {0};
       spi_header_t sheader = {0};
       uint8_t *txdata = NULL;
+      MX_WIFI_IO_Segment_t txseg[SPI_TX_SEG_MAX];
+      uint8_t txseg_count = 0;
       bool is_continue = true;
+      uint32_t t_frame;
+      uint32_t t_data = 0;
+      bool txpopped = false;
+
+      /* Take the oldest queued frame, it stays queued until its data phase so that */
+      /* it is sent again when the handshake fails. Cancelled frames are dropped.   */
+      LOCK(SpiTxQueueLock);
+      while ((SpiTxQueueCount > 0U) && (0U == SpiTxQueue[SpiTxQueueHead].seg_count))
+      {
+        SpiTxQueueHead = (SpiTxQueueHead + 1U) % SPI_TX_QUEUE_SIZE;
+        SpiTxQueueCount--;
+        (void)SEM_SIGNAL(SpiTxFreeSem);
+      }
+      if (SpiTxQueueCount > 0U)
+      {
+        const spi_tx_frame_t *const frame = &SpiTxQueue[SpiTxQueueHead];
 
-      DEBUG_LOG("\n%s(): %p\n", __FUNCTION__, SpiTxData);
+        mheader.len = frame->len;
+        txseg_count = frame->seg_count;
+        (void)memcpy(txseg, frame->seg, txseg_count * sizeof(txseg[0]));
+        txdata = (uint8_t *)txseg[0].data;
+        SpiTxActiveTicket = frame->ticket;
+      }
+      UNLOCK(SpiTxQueueLock);
+
+      DEBUG_LOG("\n%s(): %p\n", __FUNCTION__, txdata);
 
-      if (SpiTxData == NULL)
+      if (txdata == NULL)
       {
         if (!MX_WIFI_SPI_IRQ_IS_HIGH())
         {
@@ -474,17 +1002,19 @@ void process_txrx_poll(uint32_t timeout)
 #endif /* MX_WIFI_BARE_OS_H */
         }
       }
-      else
-      {
-        mheader.len = SpiTxLen;
-        txdata = SpiTxData;
-      }
 
       if (is_continue)
       {
         mheader.type = SPI_WRITE;
         mheader.lenx = ~mheader.len;
 
+        /* FLOW edges signaled before the chip select are stale. */
+        while (SEM_WAIT(SpiFlowRiseSem, 0, NULL) == SEM_OK)
+        {
+          SpiStat.flow_stale++;
+        }
+
+        t_frame = SPI_TIMING_GET();
         MX_WIFI_SPI_CS_LOW();
 
         {
@@ -495,6 +1025,8 @@ void process_txrx_poll(uint32_t timeout)
           }
           else
           {
+            StateEnter(MX_WIFI_SPI_STATE_HEADER);
+
             /* Transmit only the header part. */
             if (HAL_OK != TransmitReceive(HSpiMX, (uint8_t *)&mheader, (uint8_t *)&sheader, sizeof(mheader), timeout))
             {
@@ -555,12 +1087,22 @@ void process_txrx_poll(uint32_t timeout)
                       {
                         HAL_StatusTypeDef ret;
 
+                        StateEnter(MX_WIFI_SPI_STATE_DATA);
+                        t_data = SPI_TIMING_GET();
+
                         /* TX with possible RX. */
                         if (NULL != txdata)
                         {
-                          SpiTxData = NULL;
-                          SpiTxLen = 0;
-                          if (NULL != rxdata)
+                          LOCK(SpiTxQueueLock);
+                          SpiTxQueueHead = (SpiTxQueueHead + 1U) % SPI_TX_QUEUE_SIZE;
+                          SpiTxQueueCount--;
+                          UNLOCK(SpiTxQueueLock);
+                          txpopped = true;
+                          if (txseg_count > 1U)
+                          {
+                            ret = TransmitSegments(HSpiMX, txseg, txseg_count, rxdata, datalen, timeout);
+                          }
+                          else if (NULL != rxdata)
                           {
                             ret = TransmitReceive(HSpiMX, txdata, rxdata, datalen, timeout);
                           }
@@ -580,6 +1122,8 @@ void process_txrx_poll(uint32_t timeout)
                         }
                         else
                         {
+                          FrameDone(t_frame, t_data, (NULL != txdata) ? mheader.len : 0U, sheader.len);
+
                           /* Resize the input buffer and send it back to the processing thread. */
                           if (sheader.len > 0)
                           {
@@ -602,8 +1146,18 @@ void process_txrx_poll(uint32_t timeout)
           }
           /* Notify transfer done. */
           MX_WIFI_SPI_CS_HIGH();
+          StateEnter(SPI_STATE_IDLE);
         }
       }
+
+      /* Give the frame back to its sender once sent, it is retried when it is still queued. */
+      LOCK(SpiTxQueueLock);
+      if ((true == txpopped) && (SpiTxActiveTicket != SPI_TX_TICKET_NONE))
+      {
+        (void)SEM_SIGNAL(SpiTxTicket[SpiTxActiveTicket].done);
+      }
+      SpiTxActiveTicket = SPI_TX_TICKET_NONE;
+      UNLOCK(SpiTxQueueLock);
     }
     UNLOCK(SpiTxLock);
   }
@@ -638,9 +1192,21 @@ static int8_t mx_wifi_spi_txrx_start(void)
   int8_t ret = 0;
 
   LOCK_INIT(SpiTxLock);
+  LOCK_INIT(SpiTxQueueLock);
+  SpiTxQueueHead = 0;
+  SpiTxQueueCount = 0;
   SEM_INIT(SpiTxRxSem, 2);
+  SEM_INIT(SpiTxFreeSem, SPI_TX_QUEUE_SIZE);
+  for (uint32_t i = 0; i < SPI_TX_QUEUE_SIZE; i++)
+  {
+    (void)SEM_SIGNAL(SpiTxFreeSem);
+    SEM_INIT(SpiTxTicket[i].done, 1);
+    SpiTxTicket[i].in_use = false;
+  }
+  SpiTxActiveTicket = SPI_TX_TICKET_NONE;
   SEM_INIT(SpiFlowRiseSem, 1);
   SEM_INIT(SpiTransferDoneSem, 1);
+  SPI_TIMING_INIT();
 
 
   if (THREAD_OK != THREAD_INIT(MX_WIFI_TxRxThreadId, mx_wifi_spi_txrx_task, NULL,
@@ -680,7 +1246,14 @@ static int8_t mx_wifi_spi_txrx_stop(void)
   /* Delete the Thread (depends on implementation). */
   THREAD_DEINIT(MX_WIFI_TxRxThreadId);
   SEM_DEINIT(SpiTxRxSem);
+  SEM_DEINIT(SpiTxFreeSem);
+  for (uint32_t i = 0; i < SPI_TX_QUEUE_SIZE; i++)
+  {
+    SEM_DEINIT(SpiTxTicket[i].done);
+  }
   SEM_DEINIT(SpiFlowRiseSem);
+  SEM_DEINIT(SpiTransferDoneSem);
+  LOCK_DEINIT(SpiTxQueueLock);
   LOCK_DEINIT(SpiTxLock);
 
   return 0;
@@ -698,6 +1271,8 @@ int32_t mxwifi_probe(void **ll_drv_context)
                             MX_WIFI_SPI_Write,
                             MX_WIFI_SPI_Read) == MX_WIFI_STATUS_OK)
   {
+    (void)MX_WIFI_RegisterBusIO_SendV(&MxWifiObj, MX_WIFI_SPI_WriteV);
+
     if (NULL != ll_drv_context)
     {
       *ll_drv_context = &MxWifiObj;
@@ -714,4 +1289,16 @@ MX_WIFIObject_t *wifi_obj_get(void)
   return &MxWifiObj;
 }
 
+
+void mx_wifi_spi_get_stat(mx_wifi_spi_stat_t *stat)
+{
+  if (NULL != stat)
+  {
+    /* Same lock as the TX queue and per frame updates, the copy is consistent. */
+    LOCK(SpiTxQueueLock);
+    *stat = SpiStat;
+    UNLOCK(SpiTxQueueLock);
+  }
+}
+
 #endif /* (MX_WIFI_USE_SPI == 1) */
@@ -262,25 +262,25 @@ void process_txrx_poll(uint32_t timeout)
 
     DEBUG_LOG("W:%" PRIu32 " R:%" PRIu32 "\n", write_pos, read_pos);
 
-    if (write_pos != read_pos)
+    /* write_pos pointer may have re-looped, so decode the two contiguous segments. */
+    while (write_pos != read_pos)
     {
-      /* write_pos pointer has re-looped, so send the two segments. */
-      do
+      const uint32_t seg_end = (write_pos > read_pos) ? write_pos : MX_CIRCULAR_UART_RX_BUFFER_SIZE;
+      uint16_t consumed = 0;
+      mx_buf_t *nbuf = slip_input_block(&RxBuffer[read_pos], (uint16_t)(seg_end - read_pos), &consumed);
+
+      if (NULL != nbuf)
+      {
+        DEBUG_PRINT("URX", MX_NET_BUFFER_PAYLOAD(nbuf), MX_NET_BUFFER_GET_PAYLOAD_SIZE(nbuf));
+        mx_wifi_hci_input(nbuf);
+      }
+      read_pos = read_pos + consumed;
+      if (MX_CIRCULAR_UART_RX_BUFFER_SIZE == read_pos)
       {
-        mx_buf_t *nbuf = slip_input_byte(RxBuffer[read_pos]);
-        if (NULL != nbuf)
-        {
-          DEBUG_PRINT("URX", MX_NET_BUFFER_PAYLOAD(nbuf), MX_NET_BUFFER_GET_PAYLOAD_SIZE(nbuf));
-          mx_wifi_hci_input(nbuf);
-        }
-        read_pos = read_pos + 1;
-        if (MX_CIRCULAR_UART_RX_BUFFER_SIZE == read_pos)
-        {
-          read_pos = 0;
-        }
-      } while (read_pos != write_pos);
-      RxBufferReadPos = write_pos;
+        read_pos = 0;
+      }
     }
+    RxBufferReadPos = write_pos;
   }
 }
 
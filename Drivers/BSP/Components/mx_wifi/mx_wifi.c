@@ -102,6 +102,23 @@ MX_WIFI_STATUS_T MX_WIFI_RegisterBusIO(MX_WIFIObject_t *Obj,
 }
 
 
+MX_WIFI_STATUS_T MX_WIFI_RegisterBusIO_SendV(MX_WIFIObject_t *Obj, IO_SendV_Func IO_SendV)
+{
+  MX_WIFI_STATUS_T rc;
+
+  if (NULL == Obj)
+  {
+    rc = MX_WIFI_STATUS_ERROR;
+  }
+  else
+  {
+    Obj->fops.IO_SendV = IO_SendV;
+    rc = MX_WIFI_STATUS_OK;
+  }
+  return rc;
+}
+
+
 MX_WIFI_STATUS_T MX_WIFI_HardResetModule(MX_WIFIObject_t *Obj)
 {
   MX_WIFI_STATUS_T rc = MX_WIFI_STATUS_ERROR;
@@ -192,7 +209,7 @@ MX_WIFI_STATUS_T MX_WIFI_Init(MX_WIFIObject_t *Obj)
       (void)(Obj->fops.IO_Init(MX_WIFI_INIT));
       {
         /* 2. Initialize the WiFi IPC. */
-        if (MIPC_CODE_SUCCESS == mipc_init(Obj->fops.IO_Send))
+        if (MIPC_CODE_SUCCESS == mipc_init(Obj->fops.IO_Send, Obj->fops.IO_SendV))
         {
           /* 2a. Start the thread for RTOS implementation. */
           if (THREAD_OK == THREAD_INIT(MX_WIFI_RecvThreadId, _MX_WIFI_RecvThread, NULL,
@@ -1455,7 +1472,9 @@ int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t
 
   if ((NULL != Obj) && (0 <= SockFd) && (NULL != Buf) && (0 < Len))
   {
-    socket_send_cparams_t *cp = NULL;
+    socket_send_cparams_t cp = {0};
+    /* The data follows the params, it is passed separately to avoid a copy. */
+    const uint16_t cp_size = (uint16_t)(sizeof(cp) - 1);
     socket_send_rparams_t rp = {0};
     uint16_t rp_size = (uint16_t)sizeof(rp);
     size_t data_len = (size_t)Len;
@@ -1470,22 +1489,117 @@ int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t
 
     /* useless: rp.sent = 0; */
 
-    const uint16_t cp_size = (uint16_t)(sizeof(socket_send_cparams_t) - 1 + data_len);
-    cp = (socket_send_cparams_t *)MX_WIFI_MALLOC(cp_size);
-    if (NULL != cp)
+    cp.socket = SockFd;
+    cp.size = data_len;
+    cp.flags = flags;
+    if (MIPC_CODE_SUCCESS == mipc_request_with_data(MIPC_API_SOCKET_SEND_CMD,
+                                                    (uint8_t *)&cp, cp_size,
+                                                    Buf, (uint16_t)data_len,
+                                                    (uint8_t *)&rp, &rp_size,
+                                                    MX_WIFI_CMD_TIMEOUT))
     {
-      cp->socket = SockFd;
-      (void)memcpy(&cp->buffer[0], Buf, data_len);
-      cp->size = data_len;
-      cp->flags = flags;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_SEND_CMD,
-                                            (uint8_t *)cp, cp_size,
-                                            (uint8_t *)&rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+      ret = rp.sent;
+    }
+  }
+
+  return ret;
+}
+
+
+int32_t MX_WIFI_Socket_send_stream(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t *Buf,
+                                   int32_t Len, int32_t flags)
+{
+  int32_t ret = (int32_t)MX_WIFI_STATUS_PARAM_ERROR;
+
+  if ((NULL != Obj) && (0 <= SockFd) && (NULL != Buf) && (0 < Len))
+  {
+    /* Fragments waiting for the module answer, oldest at frag_head. */
+    struct
+    {
+      mipc_req_handle_t handle;
+      socket_send_rparams_t rp;
+      uint16_t rp_size;
+      int32_t len;
+    } frag[MX_WIFI_SEND_WINDOW];
+    const int32_t frag_max = (int32_t)(MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_send_cparams_t) - 1));
+    uint32_t frag_head = 0;
+    uint32_t frag_count = 0;
+    int32_t offset = 0;
+    bool stop = false;   /* no more fragments are started */
+    bool broken = false; /* a fragment was not sent entirely, the stream is corrupted */
+
+    ret = (int32_t)MX_WIFI_STATUS_ERROR;
+
+    while (((offset < Len) && (false == stop)) || (frag_count > 0U))
+    {
+      if ((offset < Len) && (false == stop) && (frag_count < MX_WIFI_SEND_WINDOW))
+      {
+        const uint32_t i = (frag_head + frag_count) % MX_WIFI_SEND_WINDOW;
+        socket_send_cparams_t cp = {0};
+        /* The data follows the params, it is passed separately to avoid a copy. */
+        const uint16_t cp_size = (uint16_t)(sizeof(cp) - 1);
+        int32_t status;
+
+        frag[i].len = ((Len - offset) < frag_max) ? (Len - offset) : frag_max;
+        frag[i].rp.sent = 0;
+        frag[i].rp_size = (uint16_t)sizeof(frag[i].rp);
+        cp.socket = SockFd;
+        cp.size = (size_t)frag[i].len;
+        cp.flags = flags;
+
+        /* With fragments already in flight do not wait for a free request entry, */
+        /* as the entries they hold are only released when they are finished.     */
+        status = mipc_request_start(MIPC_API_SOCKET_SEND_CMD,
+                                    (uint8_t *)&cp, cp_size,
+                                    &Buf[offset], (uint16_t)frag[i].len,
+                                    (uint8_t *)&frag[i].rp, &frag[i].rp_size,
+                                    (frag_count == 0U) ? MX_WIFI_CMD_TIMEOUT : 0U, &frag[i].handle);
+        if (MIPC_CODE_SUCCESS == status)
+        {
+          offset += frag[i].len;
+          frag_count++;
+          continue;
+        }
+        if ((MIPC_CODE_TIMEOUT != status) || (frag_count == 0U))
+        {
+          /* The data sent before is followed by a gap, unless nothing was sent yet. */
+          broken = (offset > 0);
+          stop = true;
+        }
+      }
+
+      if (frag_count > 0U)
       {
-        ret = rp.sent;
+        const uint32_t i = frag_head;
+
+        if (MIPC_CODE_SUCCESS != mipc_request_finish(frag[i].handle, MX_WIFI_CMD_TIMEOUT))
+        {
+          frag[i].rp.sent = (int32_t)MX_WIFI_STATUS_ERROR;
+        }
+        frag_head = (frag_head + 1U) % MX_WIFI_SEND_WINDOW;
+        frag_count--;
+
+        /* The next fragments may already be sent after a short or failed one, the data */
+        /* received by the peer has a gap which no returned length can describe.        */
+        if (frag[i].rp.sent != frag[i].len)
+        {
+          broken = true;
+          stop = true;
+        }
       }
-      MX_WIFI_FREE(cp);
+    }
+
+    if (true == broken)
+    {
+      ret = (int32_t)MX_WIFI_STATUS_IO_ERROR;
+    }
+    else if (offset == Len)
+    {
+      ret = Len;
+    }
+    else
+    {
+      /* Nothing sent, the first fragment could not be started. */
     }
   }
 
@@ -1501,8 +1615,13 @@ int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_
 
   if ((NULL != Obj) && (0 <= SockFd) && (NULL != Buf) && (0 < Len) && (NULL != ToAddr) && (0 < ToAddrLen))
   {
-    socket_sendto_cparams_t *cp = NULL;
+    socket_sendto_cparams_t cp = {0};
+    /* The data follows the params, it is passed separately to avoid a copy. */
+    const uint16_t cp_size = (uint16_t)(sizeof(cp) - 1);
     size_t data_len = (size_t)Len;
+    bool is_to_do_mipc_request = true;
+    socket_sendto_rparams_t rp = {0};
+    uint16_t rp_size = (uint16_t)sizeof(rp);
 
     ret = (int32_t)MX_WIFI_STATUS_ERROR;
 
@@ -1512,48 +1631,36 @@ int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_
       data_len = MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_sendto_cparams_t) - 1);
     }
 
-    const uint16_t cp_size = (uint16_t)(sizeof(socket_sendto_cparams_t) - 1 + data_len);
-
-    cp = (socket_sendto_cparams_t *)MX_WIFI_MALLOC(cp_size);
+    /* useless: rp.sent = 0; */
+    cp.socket = SockFd;
+    cp.size = data_len;
+    cp.flags = Flags;
 
-    if (NULL != cp)
+    if ((ToAddr->sa_family == MX_AF_INET) && (ToAddrLen == sizeof(struct mx_sockaddr_in)))
     {
-      bool is_to_do_mipc_request = true;
-      socket_sendto_rparams_t rp = {0};
-      uint16_t rp_size = (uint16_t)sizeof(rp);
-
-      /* useless: rp.sent = 0; */
-      cp->socket = SockFd;
-      (void)memcpy(&cp->buffer[0], Buf, data_len);
-      cp->size = data_len;
-      cp->flags = Flags;
+      cp.addr = mx_s_addr_in_to_packed(ToAddr);
+    }
+    else if ((ToAddr->sa_family == MX_AF_INET6) && (ToAddrLen == sizeof(struct mx_sockaddr_in6)))
+    {
+      cp.addr = mx_s_addr_in6_to_packed(ToAddr);
+    }
+    else
+    {
+      is_to_do_mipc_request = false;
+    }
 
-      if ((ToAddr->sa_family == MX_AF_INET) && (ToAddrLen == sizeof(struct mx_sockaddr_in)))
-      {
-        cp->addr = mx_s_addr_in_to_packed(ToAddr);
-      }
-      else if ((ToAddr->sa_family == MX_AF_INET6) && (ToAddrLen == sizeof(struct mx_sockaddr_in6)))
-      {
-        cp->addr = mx_s_addr_in6_to_packed(ToAddr);
-      }
-      else
-      {
-        is_to_do_mipc_request = false;
-      }
+    if (is_to_do_mipc_request)
+    {
+      cp.length = (mx_socklen_t)ToAddrLen;
 
-      if (is_to_do_mipc_request)
+      if (MIPC_CODE_SUCCESS == mipc_request_with_data(MIPC_API_SOCKET_SENDTO_CMD,
+                                                      (uint8_t *)&cp, cp_size,
+                                                      Buf, (uint16_t)data_len,
+                                                      (uint8_t *)&rp, &rp_size,
+                                                      MX_WIFI_CMD_TIMEOUT))
       {
-        cp->length = (mx_socklen_t)ToAddrLen;
-
-        if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_SENDTO_CMD,
-                                              (uint8_t *)cp, cp_size,
-                                              (uint8_t *)&rp, &rp_size,
-                                              MX_WIFI_CMD_TIMEOUT))
-        {
-          ret = rp.sent;
-        }
+        ret = rp.sent;
       }
-      MX_WIFI_FREE(cp);
     }
   }
 
@@ -1570,9 +1677,11 @@ int32_t MX_WIFI_Socket_recv(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *Buf,
   {
     socket_recv_cparams_t cp = {0};
     const uint16_t cp_size = (uint16_t)(sizeof(cp));
-    socket_recv_rparams_t *rp = NULL;
+    /* Only the response header is received here, the data goes straight into Buf. */
+    socket_recv_rparams_t rp;
+    uint16_t rp_size = (uint16_t)(sizeof(rp) - 1);
     size_t data_len = (size_t)Len;
-    uint16_t rp_size;
+    uint16_t received_len;
 
     ret = (int32_t)MX_WIFI_STATUS_ERROR;
 
@@ -1582,30 +1691,26 @@ int32_t MX_WIFI_Socket_recv(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *Buf,
       data_len = MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_recv_rparams_t) - 1);
     }
 
-    rp_size = (uint16_t)(sizeof(socket_recv_rparams_t) - 1 + data_len);
-    rp = (socket_recv_rparams_t *)MX_WIFI_MALLOC(rp_size);
-    if (NULL != rp)
+    rp.received = 0;
+    received_len = (uint16_t)data_len;
+    cp.socket = SockFd;
+    cp.size = data_len;
+    cp.flags = flags;
+    if (MIPC_CODE_SUCCESS == mipc_request_recv_data(MIPC_API_SOCKET_RECV_CMD,
+                                                    (uint8_t *)&cp, cp_size,
+                                                    (uint8_t *)&rp, &rp_size,
+                                                    Buf, &received_len,
+                                                    MX_WIFI_CMD_TIMEOUT))
     {
-      rp->received = 0;
-      cp.socket = SockFd;
-      cp.size = data_len;
-      cp.flags = flags;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_RECV_CMD,
-                                            (uint8_t *)&cp, cp_size,
-                                            (uint8_t *)rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+      if (rp.received > (int32_t)received_len)
       {
-        if (rp->received > 0)
-        {
-          const size_t received_len = (size_t)rp->received;
-          if (received_len <= data_len)
-          {
-            (void)memcpy(Buf, &rp->buffer[0], received_len);
-          }
-        }
-        ret = rp->received;
+        /* Response shorter than announced. */
+        ret = (int32_t)MX_WIFI_STATUS_ERROR;
+      }
+      else
+      {
+        ret = rp.received;
       }
-      MX_WIFI_FREE(rp);
     }
   }
 
@@ -1623,8 +1728,11 @@ int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *B
   {
     socket_recvfrom_cparams_t cp = {0};
     const uint16_t cp_size = (uint16_t)(sizeof(cp));
-    socket_recvfrom_rparams_t *rp = NULL;
+    /* Only the response header is received here, the data goes straight into Buf. */
+    socket_recvfrom_rparams_t rp;
+    uint16_t rp_size = (uint16_t)(sizeof(rp) - 1);
     size_t data_len = (size_t)Len;
+    uint16_t received_len;
 
     ret = (int32_t)MX_WIFI_STATUS_OK;
 
@@ -1634,48 +1742,34 @@ int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *B
       data_len = MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(socket_recvfrom_rparams_t) - 1);
     }
 
-    uint16_t rp_size = (uint16_t)(sizeof(socket_recvfrom_rparams_t) - 1 + data_len);
-
-    rp = (socket_recvfrom_rparams_t *)MX_WIFI_MALLOC(rp_size);
-
-    if (NULL != rp)
+    rp.received = 0;
+    received_len = (uint16_t)data_len;
+    cp.socket = SockFd;
+    cp.size = data_len;
+    cp.flags = Flags;
+    if (MIPC_CODE_SUCCESS == mipc_request_recv_data(MIPC_API_SOCKET_RECVFROM_CMD,
+                                                    (uint8_t *)&cp, cp_size,
+                                                    (uint8_t *)&rp, &rp_size,
+                                                    Buf, &received_len,
+                                                    MX_WIFI_CMD_TIMEOUT))
     {
-      rp->received = 0;
-      cp.socket = SockFd;
-      cp.size = data_len;
-      cp.flags = Flags;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_SOCKET_RECVFROM_CMD,
-                                            (uint8_t *)&cp, cp_size,
-                                            (uint8_t *)rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+      if ((rp.received > 0) && (rp.received <= (int32_t)received_len))
       {
-        if (rp->received > 0)
-        {
-          const size_t received_len = (size_t)rp->received;
-
-          if (received_len <= data_len)
-          {
-            const int32_t buf_size = MIN(Len, rp->received);
-            const size_t rp_addr_size = MIN(sizeof(rp->addr), *FromAddrLen);
+        const size_t rp_addr_size = MIN(sizeof(rp.addr), *FromAddrLen);
 
-            (void)memcpy(Buf, rp->buffer, (size_t)buf_size);
-
-            if ((rp->addr.ss_family == MX_AF_INET) && (rp->addr.s2_len == 16) && (*FromAddrLen == sizeof(struct mx_sockaddr_in)))
-            {
-              *((struct mx_sockaddr_in *)((void *)FromAddr)) = mx_s_addr_in_from_packed(&rp->addr);
-            }
-            else if ((rp->addr.ss_family == MX_AF_INET6) && (rp->addr.s2_len == sizeof(struct mx_sockaddr_storage)) && \
-                     (*FromAddrLen == sizeof(struct mx_sockaddr_in6)))
-            {
-              *((struct mx_sockaddr_in6 *)((void *)FromAddr)) = mx_s_addr_in6_from_packed(&rp->addr);
-            }
-
-            *FromAddrLen = rp_addr_size;
-            ret = buf_size;
-          }
+        if ((rp.addr.ss_family == MX_AF_INET) && (rp.addr.s2_len == 16) && (*FromAddrLen == sizeof(struct mx_sockaddr_in)))
+        {
+          *((struct mx_sockaddr_in *)((void *)FromAddr)) = mx_s_addr_in_from_packed(&rp.addr);
+        }
+        else if ((rp.addr.ss_family == MX_AF_INET6) && (rp.addr.s2_len == sizeof(struct mx_sockaddr_storage)) && \
+                 (*FromAddrLen == sizeof(struct mx_sockaddr_in6)))
+        {
+          *((struct mx_sockaddr_in6 *)((void *)FromAddr)) = mx_s_addr_in6_from_packed(&rp.addr);
         }
+
+        *FromAddrLen = rp_addr_size;
+        ret = rp.received;
       }
-      MX_WIFI_FREE(rp);
     }
   }
 
@@ -1744,11 +1838,11 @@ int32_t MX_WIFI_Socket_ping(MX_WIFIObject_t *Obj, const char *hostname,
     if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_WIFI_PING_CMD,
                                           (uint8_t *)&cp, cp_size,
                                           (uint8_t *)rp, &rp_size,
-                                          MX_WIFI_CMD_TIMEOUT))
+                                          MX_WIFI_CMD_TIMEOUT + ((delay > 0) ? ((uint32_t)count * (uint32_t)delay) : 0U)))
     {
       if (rp->num > 0)
       {
-        for (int32_t i = 0; i < rp->num; i++)
+        for (int32_t i = 0; (i < rp->num) && (i < count) && (i < MX_WIFI_PING_MAX); i++)
         {
           response[i] = rp->delay_ms[i];
         }
@@ -1784,11 +1878,11 @@ int32_t MX_WIFI_Socket_ping6(MX_WIFIObject_t *Obj, const mx_char_t *hostname,
     if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_WIFI_PING6_CMD,
                                           (uint8_t *)&cp, cp_size,
                                           (uint8_t *)rp, &rp_size,
-                                          MX_WIFI_CMD_TIMEOUT))
+                                          MX_WIFI_CMD_TIMEOUT + ((delay > 0) ? ((uint32_t)count * (uint32_t)delay) : 0U)))
     {
       if (rp->num > 0)
       {
-        for (int32_t i = 0; i < rp->num; i++)
+        for (int32_t i = 0; (i < rp->num) && (i < count) && (i < MX_WIFI_PING_MAX); i++)
         {
           response[i] = rp->delay_ms[i];
         }
@@ -2441,9 +2535,11 @@ int32_t MX_WIFI_TLS_recv(MX_WIFIObject_t *Obj, mtls_t tls, void *Data, int32_t L
   {
     tls_recv_cparams_t cp = {0};
     const uint16_t cp_size = (uint16_t)(sizeof(cp));
-    tls_recv_rparams_t *rp = NULL;
-    uint16_t rp_size;
+    /* Only the response header is received here, the data goes straight into Data. */
+    tls_recv_rparams_t rp;
+    uint16_t rp_size = (uint16_t)(sizeof(rp) - 1);
     size_t data_len = (size_t)Len;
+    uint16_t received_len;
 
     ret = 0;
 
@@ -2453,29 +2549,25 @@ int32_t MX_WIFI_TLS_recv(MX_WIFIObject_t *Obj, mtls_t tls, void *Data, int32_t L
       data_len = MX_WIFI_IPC_PAYLOAD_SIZE - (sizeof(tls_recv_rparams_t) - 1);
     }
 
-    rp_size = (uint16_t)(sizeof(tls_recv_rparams_t) - 1 + data_len);
-    rp = (tls_recv_rparams_t *)MX_WIFI_MALLOC(rp_size);
-    if (NULL != rp)
+    rp.received = 0;
+    received_len = (uint16_t)data_len;
+    cp.tls = tls;
+    cp.size = data_len;
+    if (MIPC_CODE_SUCCESS == mipc_request_recv_data(MIPC_API_TLS_RECV_CMD,
+                                                    (uint8_t *)&cp, cp_size,
+                                                    (uint8_t *)&rp, &rp_size,
+                                                    Data, &received_len,
+                                                    MX_WIFI_CMD_TIMEOUT))
     {
-      rp->received = 0;
-      cp.tls = tls;
-      cp.size = data_len;
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_TLS_RECV_CMD,
-                                            (uint8_t *)&cp, cp_size,
-                                            (uint8_t *)rp, &rp_size,
-                                            MX_WIFI_CMD_TIMEOUT))
+      if (rp.received > (int32_t)received_len)
       {
-        if (rp->received > 0)
-        {
-          const size_t received_len = (size_t)rp->received;
-          if (received_len <= data_len)
-          {
-            (void)memcpy(Data, &rp->buffer[0], received_len);
-          }
-        }
-        ret = rp->received;
+        /* Response shorter than announced. */
+        ret = (int32_t)MX_WIFI_STATUS_ERROR;
+      }
+      else
+      {
+        ret = rp.received;
       }
-      MX_WIFI_FREE(rp);
     }
   }
 
@@ -2694,58 +2786,59 @@ MX_WIFI_STATUS_T MX_WIFI_Network_bypass_netlink_output(MX_WIFIObject_t *Obj, voi
                                                        int32_t interface)
 {
   MX_WIFI_STATUS_T ret = MX_WIFI_STATUS_ERROR;
-  wifi_bypass_out_cparams_t *cparams = NULL;
-  const uint16_t cparams_size = (uint16_t)(sizeof(wifi_bypass_out_cparams_t) + (size_t)len);
   int32_t status = MIPC_CODE_ERROR;
   uint16_t status_size = (uint16_t)sizeof(status);
 
-  if ((NULL == Obj) || (len <= 0) || (((int32_t)STATION_IDX != interface) && ((int32_t)SOFTAP_IDX != interface)))
+  if ((NULL == Obj) || (NULL == data) || (len <= 0) ||
+      (((int32_t)STATION_IDX != interface) && ((int32_t)SOFTAP_IDX != interface)))
   {
     ret = MX_WIFI_STATUS_PARAM_ERROR;
   }
   else
   {
-    if (cparams_size > MX_WIFI_IPC_PAYLOAD_SIZE)
+    int32_t mipc_ret;
+
+    if ((len + (int32_t)sizeof(wifi_bypass_out_cparams_t)) > MX_WIFI_IPC_PAYLOAD_SIZE)
     {
-      len = MX_WIFI_IPC_PAYLOAD_SIZE - sizeof(wifi_bypass_out_cparams_t);
+      len = MX_WIFI_IPC_PAYLOAD_SIZE - (int32_t)sizeof(wifi_bypass_out_cparams_t);
     }
-#if MX_WIFI_TX_BUFFER_NO_COPY
-    /* structure of data buffer must support head room provision to add information in from of data payload */
-    cparams = (wifi_bypass_out_cparams_t *)((uint8_t *)data - sizeof(wifi_bypass_out_cparams_t));
-#else
-    cparams = (wifi_bypass_out_cparams_t *)MX_WIFI_MALLOC(len + sizeof(wifi_bypass_out_cparams_t));
-#endif /* MX_WIFI_TX_BUFFER_NO_COPY */
 
-    if (NULL != cparams)
+#if MX_WIFI_TX_BUFFER_NO_COPY
     {
+      /* structure of data buffer must support head room provision to add information in from of data payload */
+      wifi_bypass_out_cparams_t *const cparams = \
+        (wifi_bypass_out_cparams_t *)((uint8_t *)data - sizeof(wifi_bypass_out_cparams_t));
+
       cparams->idx = interface;
       cparams->data_len = (uint16_t)len;
 
-#if MX_WIFI_TX_BUFFER_NO_COPY == 0
-      /* copy the whole payload */
-      uint8_t *dst;
-      dst = (uint8_t *)cparams + sizeof(wifi_bypass_out_cparams_t);
-      (void)memcpy(dst, data, len);
-#endif  /* MX_WIFI_TX_BUFFER_NO_COPY */
+      mipc_ret = mipc_request(MIPC_API_WIFI_BYPASS_OUT_CMD,
+                              (uint8_t *)cparams, (uint16_t)(sizeof(wifi_bypass_out_cparams_t) + (size_t)len),
+                              (uint8_t *)&status, &status_size,
+                              MX_WIFI_CMD_TIMEOUT);
+    }
+#else
+    {
+      wifi_bypass_out_cparams_t cparams = {0};
 
-      if (MIPC_CODE_SUCCESS == mipc_request(MIPC_API_WIFI_BYPASS_OUT_CMD,
-                                            (uint8_t *)cparams, cparams_size,
-                                            (uint8_t *)&status, &status_size,
-                                            MX_WIFI_CMD_TIMEOUT))
-      {
-        if (MIPC_CODE_SUCCESS == status)
-        {
-          ret = MX_WIFI_STATUS_OK;
-        }
-      }
-#if MX_WIFI_TX_BUFFER_NO_COPY == 0
-      MX_WIFI_FREE(cparams);
-#endif /* MX_WIFI_TX_BUFFER_NO_COPY */
+      /* The frame is sent from the caller buffer after the parameters, no head room is needed. */
+      cparams.idx = interface;
+      cparams.data_len = (uint16_t)len;
+
+      mipc_ret = mipc_request_with_data(MIPC_API_WIFI_BYPASS_OUT_CMD,
+                                        (uint8_t *)&cparams, (uint16_t)sizeof(cparams),
+                                        (const uint8_t *)data, (uint16_t)len,
+                                        (uint8_t *)&status, &status_size,
+                                        MX_WIFI_CMD_TIMEOUT);
     }
-    else
+#endif /* MX_WIFI_TX_BUFFER_NO_COPY */
+
+    if (MIPC_CODE_SUCCESS == mipc_ret)
     {
-      /*  no memory */
-      DEBUG_LOG("No memory!!!\n");
+      if (MIPC_CODE_SUCCESS == status)
+      {
+        ret = MX_WIFI_STATUS_OK;
+      }
     }
   }
 
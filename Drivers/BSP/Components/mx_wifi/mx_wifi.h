@@ -195,11 +195,22 @@ typedef enum
                                MXOS read security type from scan result. */
 } MX_WIFI_SecurityType_t;
 
+/**
+  * @brief Wi-Fi low level I/O scatter-gather segment
+  */
+typedef struct
+{
+  const uint8_t *data;            /**< Segment data. */
+  uint16_t len;                   /**< Segment length in bytes. */
+} MX_WIFI_IO_Segment_t;
+
 typedef int8_t (*IO_Init_Func)(uint16_t mode);                             /**< I/O interface init function. */
 typedef int8_t (*IO_DeInit_Func)(void);                                    /**< I/O interface deinit function. */
 typedef void (*IO_Delay_Func)(uint32_t ms);                                /**< I/O interface delay function. */
 typedef uint16_t (*IO_Send_Func)(uint8_t *data, uint16_t len);             /**< I/O interface send function. */
 typedef uint16_t (*IO_Receive_Func)(uint8_t *buffer, uint16_t buff_size);  /**< I/O interface receive function. */
+typedef uint16_t (*IO_SendV_Func)(const MX_WIFI_IO_Segment_t *seg,
+                                  uint8_t seg_count);                      /**< I/O interface gather send function. */
 
 /**
   * @brief Wi-Fi low level I/O interface operation handles
@@ -211,6 +222,7 @@ typedef struct
   IO_Delay_Func IO_Delay;         /**< I/O interface delay function. */
   IO_Send_Func IO_Send;           /**< I/O interface send function. */
   IO_Receive_Func IO_Receive;     /**< I/O interface receive function. */
+  IO_SendV_Func IO_SendV;         /**< I/O interface gather send function (optional, NULL if not supported). */
 } MX_WIFI_IO_t;
 
 /**
@@ -371,6 +383,17 @@ typedef struct
 MX_WIFI_STATUS_T MX_WIFI_RegisterBusIO(MX_WIFIObject_t *Obj,
                                        IO_Init_Func IO_Init, IO_DeInit_Func IO_DeInit, IO_Delay_Func IO_Delay,
                                        IO_Send_Func IO_Send, IO_Receive_Func IO_Receive);
+/**
+  * @brief Register optional gather send function of the low level IO interface.
+  *        Segments are sent as a single frame, so the payload does not need to be copied
+  *        behind the command parameters. Segments must stay valid until the answer of the command.
+  * @param Obj wifi object handle.
+  * @param IO_SendV IO gather send function, NULL to disable
+  * @return status code
+  * @retval MX_WIFI_STATUS_OK success
+  * @retval others failure, error code @ref mx_wifi_status_e.
+  */
+MX_WIFI_STATUS_T MX_WIFI_RegisterBusIO_SendV(MX_WIFIObject_t *Obj, IO_SendV_Func IO_SendV);
 /**
   * @brief Reset wifi module by hardware IO. RESET IO set in low level IO configuration.
   * @param Obj wifi object handle.
@@ -475,7 +498,7 @@ MX_WIFI_STATUS_T MX_WIFI_Network_bypass_mode_set(MX_WIFIObject_t *Obj, int32_t e
 /**
   * @brief  Network bypass mode data output
   * @param  Obj: pointer to module handle
-  * @param  data: pbuf payload
+  * @param  data: pbuf payload, with head room for the command parameters when MX_WIFI_TX_BUFFER_NO_COPY is 1
   * @param  len:  payload len
   * @param  interface: STATION_IDX, SOFTAP_IDX
   * @return status code
@@ -988,6 +1011,23 @@ int32_t MX_WIFI_Socket_close(MX_WIFIObject_t *Obj, int32_t SockFd);
 int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t *Buf,
                             int32_t Len, int32_t flags);
 
+/**
+  * @brief  Socket send of a buffer larger than one IPC transfer.
+  * @note   The buffer is sent in fragments, up to MX_WIFI_SEND_WINDOW of them wait for the module
+  *         answer at the same time. As a fragment may already be queued when the previous one
+  *         is sent partially, it must only be used on blocking sockets without send timeout.
+  *         The buffer is sent entirely or the call fails. After MX_WIFI_STATUS_IO_ERROR the data
+  *         received by the peer may have a gap, the connection must be closed.
+  * @param  Obj: pointer to module handle
+  * @param  SockFd: socket fd
+  * @param  Buf: send data buffer
+  * @param  Len: length of send data
+  * @param  flags: zero for MXOS
+  * @retval Len if sent, return < 0 if failed, error code @ref mx_wifi_status_e
+  */
+int32_t MX_WIFI_Socket_send_stream(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t *Buf,
+                                   int32_t Len, int32_t flags);
+
 /**
   * @brief  Socket recv.
   * @param  Obj: pointer to module handle
@@ -1048,6 +1088,7 @@ int32_t MX_WIFI_Socket_gethostbyname(MX_WIFIObject_t *Obj, struct mx_sockaddr *A
   * @param  count: ping max count
   * @param  delay: ping delay in millisecond
   * @param  response: response time array of ping result, max size 10.
+  * @note   All probes are sent within a single request, its timeout is extended by count * delay.
   * @return status code
   * @retval MX_WIFI_STATUS_OK success
   * @retval others failure, error code @ref mx_wifi_status_e.
@@ -1062,6 +1103,7 @@ int32_t MX_WIFI_Socket_ping(MX_WIFIObject_t *Obj, const char *hostname, int32_t
   * @param  count: ping max count
   * @param  delay: ping delay in millisecond
   * @param  response: response time array of ping result, max size 10.
+  * @note   All probes are sent within a single request, its timeout is extended by count * delay.
   * @return status code
   * @retval MX_WIFI_STATUS_OK success
   * @retval others failure, error code @ref mx_wifi_status_e.
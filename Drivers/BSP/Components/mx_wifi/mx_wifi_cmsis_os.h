@@ -41,7 +41,11 @@ extern "C" {
 #define MX_WIFI_FREE free
 #endif /* MX_WIFI_FREE */
 
-#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+#ifndef MX_WIFI_NETWORK_BYPASS_LWIP
+#define MX_WIFI_NETWORK_BYPASS_LWIP (1)
+#endif /* MX_WIFI_NETWORK_BYPASS_LWIP */
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1) && (MX_WIFI_NETWORK_BYPASS_LWIP == 1)
 /* Definition for LwIP usage. */
 
 #include "lwip/pbuf.h"
@@ -79,8 +83,29 @@ static inline mx_buf_t *mx_buf_alloc(uint32_t len)
   return p;
 }
 
+#if (MX_WIFI_RX_BUFFER_POOL == 1)
+/* Statistics of the buffer pool. */
+typedef struct
+{
+  uint32_t count;          /* Number of blocks of the pool. */
+  uint32_t used;           /* Blocks currently allocated. */
+  uint32_t used_max;       /* Maximum number of blocks allocated at the same time. */
+  uint32_t allocs;         /* Buffers allocated from the pool. */
+  uint32_t heap_allocs;    /* Buffers allocated from the heap, pool empty or buffer too big. */
+} mx_buf_pool_stat_t;
+
+mx_buf_t *mx_buf_pool_alloc(uint32_t len);
+void mx_buf_pool_free(mx_buf_t *p);
+void mx_buf_pool_get_stat(mx_buf_pool_stat_t *stat);
+
+#define MX_NET_BUFFER_ALLOC(len)                  mx_buf_pool_alloc(len)
+#define MX_NET_BUFFER_FREE(p)                     mx_buf_pool_free(p)
+
+#else
 #define MX_NET_BUFFER_ALLOC(len)                  mx_buf_alloc(len)
 #define MX_NET_BUFFER_FREE(p)                     MX_WIFI_FREE(p)
+#endif /* MX_WIFI_RX_BUFFER_POOL */
+
 #define MX_NET_BUFFER_HIDE_HEADER(p, n)           (p)->header_len += (n)
 #define MX_NET_BUFFER_PAYLOAD(p)                  &(p)->data[(p)->header_len]
 #define MX_NET_BUFFER_SET_PAYLOAD_SIZE(p, size)   (p)->len = (size)
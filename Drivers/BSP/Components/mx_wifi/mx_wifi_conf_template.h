@@ -39,6 +39,16 @@ extern "C" {
 #define DMA_ON_USE                                  (1)
 #endif /* DMA_ON_USE */
 
+/* SPI transfers shorter than this size are done by polling even when DMA is used. */
+#ifndef MX_WIFI_SPI_DMA_MIN_SIZE
+#define MX_WIFI_SPI_DMA_MIN_SIZE                    (16)
+#endif /* MX_WIFI_SPI_DMA_MIN_SIZE */
+
+/* Measure the handshake and data phases of the SPI frames with the DWT cycle counter. */
+#ifndef MX_WIFI_SPI_TIMING
+#define MX_WIFI_SPI_TIMING                          (0)
+#endif /* MX_WIFI_SPI_TIMING */
+
 /* Do not use RTOS but bare metal approach by default. */
 #ifndef MX_WIFI_USE_CMSIS_OS
 #define MX_WIFI_USE_CMSIS_OS                        (0)
@@ -49,12 +59,32 @@ extern "C" {
 #define MX_WIFI_NETWORK_BYPASS_MODE                 (0)
 #endif /* MX_WIFI_NETWORK_BYPASS_MODE */
 
+/* In bypass mode, use LwIP pbuf as network buffers. Set to 0 to use mx_buf_t buffers (CMSIS WiFi driver). */
+#ifndef MX_WIFI_NETWORK_BYPASS_LWIP
+#define MX_WIFI_NETWORK_BYPASS_LWIP                 (1)
+#endif /* MX_WIFI_NETWORK_BYPASS_LWIP */
+
 
 /* Do not copy TX buffer. */
 #ifndef MX_WIFI_TX_BUFFER_NO_COPY
 #define MX_WIFI_TX_BUFFER_NO_COPY                   (1)
 #endif /* MX_WIFI_TX_BUFFER_NO_COPY */
 
+/* Allocate the mx_buf_t buffers from a static pool of fixed size blocks instead of the heap. */
+/* The heap is still used for bigger buffers and when the pool is empty.                     */
+#ifndef MX_WIFI_RX_BUFFER_POOL
+#define MX_WIFI_RX_BUFFER_POOL                      (1)
+#endif /* MX_WIFI_RX_BUFFER_POOL */
+
+/* Number of blocks of the pool: the buffers queued for the receiving thread, the one being */
+/* filled by the transport and the one being processed.                                     */
+#ifndef MX_WIFI_RX_BUFFER_POOL_COUNT
+#define MX_WIFI_RX_BUFFER_POOL_COUNT                (MX_WIFI_MAX_RX_BUFFER_COUNT + 2)
+#endif /* MX_WIFI_RX_BUFFER_POOL_COUNT */
+
+/* Linker section of the pool, for example to place it in a specific SRAM region. */
+/* #define MX_WIFI_RX_BUFFER_POOL_SECTION              ".mx_wifi_pool" */
+
 
 /* DEBUG LOG */
 /* #define MX_WIFI_API_DEBUG  */
@@ -166,11 +196,29 @@ extern "C" {
 /* This is used to size internal queue, and avoid to block the IP thread if it can still push some buffers       */
 /* Impact on memory foot print is one single void* per place in the queue, but it may lead to over allocation    */
 /* TCP/IP stack (LwIP for instance )                                                                             */
+/* It also sizes the TX queue of the SPI transport, where the sending threads post frames without waiting for     */
+/* the previous ones to be sent.                                                                                 */
 #ifndef MX_WIFI_MAX_TX_BUFFER_COUNT
 #define MX_WIFI_MAX_TX_BUFFER_COUNT                 (4)
 #endif /* MX_WIFI_MAX_TX_BUFFER_COUNT */
 
 
+/* Maximum number of IPC requests that can wait for the module answer at the same time.          */
+/* Requests issued from different threads are sent without waiting for the previous answers, so  */
+/* a slow command (DNS query, blocking receive) does not stall the others. Each place costs one   */
+/* semaphore. Set to 1 to serialize all the requests.                                             */
+#ifndef MX_WIFI_MAX_PENDING_REQUEST_COUNT
+#define MX_WIFI_MAX_PENDING_REQUEST_COUNT           (4)
+#endif /* MX_WIFI_MAX_PENDING_REQUEST_COUNT */
+
+/* Maximum number of fragments of a large send (MX_WIFI_Socket_send_stream) waiting for the module */
+/* answer at the same time. A fragment is sent while the module processes the previous one, instead */
+/* of after its answer. Set to 1 to send the fragments one after the other.                        */
+#ifndef MX_WIFI_SEND_WINDOW
+#define MX_WIFI_SEND_WINDOW                         (2)
+#endif /* MX_WIFI_SEND_WINDOW */
+
+
 /**
   * For the TX buffer, by default no-copy feature is enabled, meaning that
   * the IP buffer are used in the whole process and should come with
@@ -190,6 +238,21 @@ extern "C" {
 #define MX_CIRCULAR_UART_RX_BUFFER_SIZE              (400)
 #endif /* MX_CIRCULAR_UART_RX_BUFFER_SIZE */
 
+/* Size of the buffer used to build the SLIP frame in UART mode, the frame is sent part by part. */
+
+#ifndef MX_WIFI_SLIP_TX_CHUNK_SIZE
+#define MX_WIFI_SLIP_TX_CHUNK_SIZE                   (128)
+#endif /* MX_WIFI_SLIP_TX_CHUNK_SIZE */
+
+/* Number of APIs with request latency statistics (mipc_get_latency_stat), the first APIs used */
+/* get an entry and the requests of the others are only counted.                               */
+#ifndef MX_WIFI_STAT_API_COUNT
+#define MX_WIFI_STAT_API_COUNT                       (16)
+#endif /* MX_WIFI_STAT_API_COUNT */
+
+/* The transport statistics (mipc_get_tx_stat, mipc_get_rx_stat, mipc_get_latency_stat,   */
+/* mx_wifi_spi_get_stat, mx_buf_pool_get_stat) are always counted. MX_STAT_ON only enables */
+/* the buffer accounting debug counters printed by MX_STAT_LOG.                            */
 #ifndef MX_STAT_ON
 #define MX_STAT_ON      0
 #endif /* MX_STAT_ON */
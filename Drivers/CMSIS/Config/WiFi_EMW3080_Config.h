@@ -16,8 +16,8 @@
  * limitations under the License.
  *
  *
- * $Date:        6. December 2024
- * $Revision:    V1.1
+ * $Date:        16. October 2026
+ * $Revision:    V1.2
  *
  * Project:      WiFi Driver Configuration for MXCHIP EMW3080 WiFi Module
  * -------------------------------------------------------------------------- */
@@ -41,7 +41,7 @@
 // Number of sockets supported by Module (default: 4)
 #define WIFI_EMW3080_SOCKETS_NUM           (4)
 
-// Maximum socket transfer buffer (default: 1500)
+// Socket local receive buffer size, stream data is prefetched into it (default: 1500)
 #define WIFI_EMW3080_SOCKETS_RX_BUF_SIZE   (1500)
 
 // Socket access lock timeout (default: 10000 ms)
@@ -56,4 +56,31 @@
 // Interval in milliseconds for emulating blocking sockets (default: 250 ms)
 #define WIFI_EMW3080_SOCKETS_INTERVAL      (250)
 
+// Maximum time in milliseconds module waits for data on single blocking receive (default: 50 ms)
+#define WIFI_EMW3080_SOCKETS_RCV_WAIT      (50)
+
+// Number of received frames queued in bypass mode (default: 4)
+#define WIFI_EMW3080_ETH_RX_QUEUE_SIZE     (4)
+
+// Number of host names in the resolution cache, 0 = cache disabled (default: 4)
+#define WIFI_EMW3080_DNS_CACHE_SIZE        (4)
+
+// Maximum host name length in the resolution cache, longer names are not cached (default: 64)
+#define WIFI_EMW3080_DNS_CACHE_NAME_LEN    (64)
+
+// Time in milliseconds resolved address is valid in the cache (default: 300000 ms)
+#define WIFI_EMW3080_DNS_CACHE_TTL         (300000)
+
+// Time in milliseconds host not found result is valid in the cache (default: 10000 ms)
+#define WIFI_EMW3080_DNS_CACHE_NEG_TTL     (10000)
+
+// Number of networks in the scan result cache, 0 = cache disabled (default: 20)
+#define WIFI_EMW3080_SCAN_CACHE_NUM        (20)
+
+// Time in milliseconds result of the last full scan is valid in the cache (default: 5000 ms)
+#define WIFI_EMW3080_SCAN_CACHE_TIME       (5000)
+
+// Interval in milliseconds of background scan refreshing the cache, 0 = no refresh (default: 0 ms)
+#define WIFI_EMW3080_SCAN_REFRESH_INTERVAL (0)
+
 #endif // WIFI_EMW3080_CONFIG_H__
@@ -16,8 +16,8 @@
  * limitations under the License.
  *
  *
- * $Date:               6. December 2024
- * $Revision:           V1.1
+ * $Date:               16. October 2026
+ * $Revision:           V1.2
  *
  * Driver:              Driver_WiFin (n = WIFI_EMW3080_DRV_NUM value)
  * Project:             WiFi Driver for MXCHIP EMW3080 WiFi Module (SPI variant)
@@ -28,6 +28,17 @@
  * -------------------------------------------------------------------------- */
 
 /* History:
+ *  Version 1.2
+ *    - Blocking receive waits for data in the module instead of polling
+ *    - Stream socket receive prefetches data into local receive buffer
+ *    - Added WiFi_EMW3080_SocketPoll function for probe based polling of multiple sockets
+ *    - Operations on different sockets are protected by separate mutexes and can overlap
+ *    - Added bypass (pass-through) mode for use with a host TCP/IP stack
+ *    - Host name resolution results are cached (WiFi_SocketGetHostByName)
+ *    - Blocking stream socket send is not limited to a single module request
+ *    - Added transport statistics snapshot (WiFi_EMW3080_GetStats)
+ *    - Scan results are cached, added asynchronous and targeted scan (WiFi_EMW3080_ScanStart)
+ *    - Added multiple probe ping with round trip time statistics (WiFi_EMW3080_Ping, WiFi_EMW3080_PingStart)
  *  Version 1.1
  *    - Updated to work with EMW3080B MXCHIP WiFi module firmware v2.3.4 (rc 13)
  *  Version 1.0
@@ -55,6 +66,7 @@
 #include "mx_wifi.h"
 #include "mx_address.h"
 #include "mx_wifi_io.h"
+#include "mx_wifi_ipc.h"
 
 // Check Mx WiFi configuration
 #if (MX_WIFI_USE_SPI == 0)
@@ -64,13 +76,69 @@
 #error This driver requires CMSIS RTOS2 (MX_WIFI_USE_CMSIS_OS in the mx_wifi_conf.h file must be set to 1) !!!
 #endif
 #if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
-#error This driver does not support bypass or pass-through mode (MX_WIFI_NETWORK_BYPASS_MODE in the mx_wifi_conf.h file is ignored) !
+#if (MX_WIFI_NETWORK_BYPASS_LWIP == 1)
+#error Bypass mode of this driver requires mx_buf_t network buffers (MX_WIFI_NETWORK_BYPASS_LWIP in the mx_wifi_conf.h file must be set to 0) !!!
+#endif
+#if (MX_WIFI_TX_BUFFER_NO_COPY == 1)
+#error Bypass mode of this driver sends frames without head room (MX_WIFI_TX_BUFFER_NO_COPY in the mx_wifi_conf.h file must be set to 0) !!!
+#endif
 #endif
 
 // Backward compatibility defines
 #ifndef WIFI_EMW3080_SOCKETS_RCV_RETRIES
 #define WIFI_EMW3080_SOCKETS_RCV_RETRIES       (10)
 #endif
+#ifndef WIFI_EMW3080_SOCKETS_RCV_WAIT
+#define WIFI_EMW3080_SOCKETS_RCV_WAIT          (50)
+#endif
+#ifndef WIFI_EMW3080_ETH_RX_QUEUE_SIZE
+#define WIFI_EMW3080_ETH_RX_QUEUE_SIZE         (4)
+#endif
+#ifndef WIFI_EMW3080_DNS_CACHE_SIZE
+#define WIFI_EMW3080_DNS_CACHE_SIZE            (4)
+#endif
+#ifndef WIFI_EMW3080_DNS_CACHE_NAME_LEN
+#define WIFI_EMW3080_DNS_CACHE_NAME_LEN        (64)
+#endif
+#ifndef WIFI_EMW3080_DNS_CACHE_TTL
+#define WIFI_EMW3080_DNS_CACHE_TTL             (300000)
+#endif
+#ifndef WIFI_EMW3080_DNS_CACHE_NEG_TTL
+#define WIFI_EMW3080_DNS_CACHE_NEG_TTL         (10000)
+#endif
+#ifndef WIFI_EMW3080_SCAN_CACHE_NUM
+#define WIFI_EMW3080_SCAN_CACHE_NUM            (20)
+#endif
+#ifndef WIFI_EMW3080_SCAN_CACHE_TIME
+#define WIFI_EMW3080_SCAN_CACHE_TIME           (5000)
+#endif
+#ifndef WIFI_EMW3080_SCAN_REFRESH_INTERVAL
+#define WIFI_EMW3080_SCAN_REFRESH_INTERVAL     (0)
+#endif
+
+// Host name cache is only used with the Socket interface
+#if ((MX_WIFI_NETWORK_BYPASS_MODE == 0) && (WIFI_EMW3080_DNS_CACHE_SIZE > 0))
+#define DNS_CACHE_ENABLED                      (1)
+#else
+#define DNS_CACHE_ENABLED                      (0)
+#endif
+
+#if (WIFI_EMW3080_SCAN_CACHE_NUM > 0)
+#define SCAN_CACHE_ENABLED                     (1)
+#else
+#define SCAN_CACHE_ENABLED                     (0)
+#endif
+
+// Check driver configuration
+#if (WIFI_EMW3080_SOCKETS_RCV_WAIT >= MX_WIFI_CMD_TIMEOUT)
+#error WIFI_EMW3080_SOCKETS_RCV_WAIT must be lower than MX_WIFI_CMD_TIMEOUT (in the mx_wifi_conf.h file) !!!
+#endif
+#if (WIFI_EMW3080_PING_COUNT_MAX > MX_WIFI_PING_MAX)
+#error WIFI_EMW3080_PING_COUNT_MAX must not be higher than MX_WIFI_PING_MAX (in the mx_wifi.h file) !!!
+#endif
+#if (WIFI_EMW3080_STATS_LAT_BUCKETS != MIPC_LATENCY_HIST_BUCKETS)
+#error WIFI_EMW3080_STATS_LAT_BUCKETS must be equal to MIPC_LATENCY_HIST_BUCKETS (in the mx_wifi_ipc.h file) !!!
+#endif
 
 // Hardware dependent functions --------
 
@@ -102,7 +170,7 @@ void WiFi_EMW3080_Pin_FLOW_Rising_Edge (void) {
 
 // WiFi Driver *****************************************************************
 
-#define ARM_WIFI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,1)         // Driver version
+#define ARM_WIFI_DRV_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,2)         // Driver version
 
 // Driver Version
 static const ARM_DRIVER_VERSION driver_version = { ARM_WIFI_API_VERSION, ARM_WIFI_DRV_VERSION };
@@ -116,11 +184,19 @@ static const ARM_WIFI_CAPABILITIES driver_capabilities = {
   0U,                                   // WiFi Protected Setup (WPS) for Access Point not supported
   0U,                                   // Access Point: event not generated on Station connect
   0U,                                   // Access Point: event not generated on Station disconnect
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+  1U,                                   // Event generated on Ethernet frame reception in bypass mode
+  1U,                                   // Bypass or pass-through mode (Ethernet interface) supported
+  0U,                                   // IP (UDP/TCP) (Socket interface) not supported in bypass mode
+  0U,                                   // IPv6 (Socket interface) not supported
+  0U,                                   // Ping (ICMP) not supported in bypass mode
+#else
   0U,                                   // Event not generated on Ethernet frame reception in bypass mode
   0U,                                   // Bypass or pass-through mode (Ethernet interface) not supported
   1U,                                   // IP (UDP/TCP) (Socket interface) supported
   0U,                                   // IPv6 (Socket interface) not supported
   1U,                                   // Ping (ICMP) supported
+#endif
   0U                                    // Reserved (must be zero)
 };
 
@@ -147,9 +223,12 @@ static const ARM_WIFI_CAPABILITIES driver_capabilities = {
 typedef struct mx_sockaddr_storage      SOCKADDR_STORAGE;
 typedef struct mx_sockaddr_in           SOCKADDR_IN;
 
-// sock_attr access protection mutex
+// sock_attr access protection mutex (operations spanning multiple sockets)
 static osMutexId_t                      mutex_id_sock_attr = NULL;
 
+// Socket access protection mutexes (operations on a single socket)
+static osMutexId_t                      mutex_id_sock[WIFI_EMW3080_SOCKETS_NUM];
+
 // Status change event flags
 static osEventFlagsId_t                 ef_id_sta_status   = NULL;
 
@@ -160,6 +239,12 @@ static ARM_WIFI_SignalEvent_t           signal_event_fn    = NULL;
 static uint8_t                          scan_buf[WIFI_EMW3080_SCAN_BUF_SIZE] __ALIGNED(4);
 static MX_WIFIObject_t                 *ptrMX_WIFIObject   = NULL;
 
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+// Bypass mode received frames queue and frame being read
+static osMessageQueueId_t               mq_id_eth_rx       = NULL;
+static mx_buf_t                        *eth_rx_frame       = NULL;
+#endif
+
 // Socket attributes
 static struct {
   uint8_t  ionbio;
@@ -170,20 +255,157 @@ static struct {
     uint16_t listening  :  1;
     uint16_t connecting :  1;
     uint16_t connected  :  1;
-    uint16_t reserved   : 11;
+    uint16_t accepted   :  1;           // Connection accepted by WiFi_EMW3080_SocketPoll, not taken yet
+    uint16_t reserved   : 10;
   } flags;
   uint32_t rcvtimeo;
   uint32_t sndtimeo;
+  uint32_t rcvwait;                     // Receive timeout configured in the module (0 = unknown)
   uint8_t  local_ip [4];
   uint8_t  remote_ip[4];
   uint16_t local_port;
   uint16_t remote_port;
   uint8_t  rx_ip[4];
   uint16_t rx_port;
+  uint16_t rx_buf_ofs;
   uint16_t rx_buf_available_len;
   uint8_t  rx_buf [WIFI_EMW3080_SOCKETS_RX_BUF_SIZE];
+  int32_t  accept_sock;                 // Accepted socket (flags.accepted = 1)
+  SOCKADDR_STORAGE accept_addr;         // Address of accepted socket (flags.accepted = 1)
 } sock_attr[WIFI_EMW3080_SOCKETS_NUM];
 
+// Socket receive buffer statistics
+static WiFi_EMW3080_SocketRxBufStats_t rx_buf_stats[WIFI_EMW3080_SOCKETS_NUM];
+
+// Socket traffic statistics
+static WiFi_EMW3080_SocketStats_t       sock_stats[WIFI_EMW3080_SOCKETS_NUM];
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 0)
+// Ping thread flags
+#define PING_FLAG_START                 (1U << 0)
+#define PING_FLAG_EXIT                  (1U << 1)
+
+// Background ping request
+static uint8_t                          ping_ip[4];
+static uint32_t                         ping_count         = 0U;
+static uint32_t                         ping_interval      = 0U;
+static uint8_t                          ping_busy          = 0U;        // 1 = ping requested from the ping thread
+
+// Background ping request access protection mutex and ping thread
+static osMutexId_t                      mutex_id_ping      = NULL;
+static osThreadId_t                     thread_id_ping     = NULL;
+
+static const osMutexAttr_t mutex_ping = {
+  "Mutex_ping",                         // Mutex name
+  osMutexPrioInherit,                   // attr_bits
+  NULL,                                 // Memory for control block
+  0U                                    // Size for control block
+};
+
+static const osThreadAttr_t thread_ping = {
+  "Thread_ping",                        // Thread name
+  osThreadJoinable,                     // attr_bits
+  NULL,                                 // Memory for control block
+  0U,                                   // Size for control block
+  NULL,                                 // Memory for stack
+  1024U,                                // Size of stack
+  osPriorityBelowNormal,                // Initial thread priority
+  0U,                                   // TrustZone module identifier
+  0U                                    // Reserved (must be 0)
+};
+#endif
+
+#if (DNS_CACHE_ENABLED == 1)
+// Host name cache refresh thread flags
+#define DNS_FLAG_REFRESH                (1U << 0)
+#define DNS_FLAG_EXIT                   (1U << 1)
+
+// Host name cache entries
+static struct {
+  char     name[WIFI_EMW3080_DNS_CACHE_NAME_LEN];       // Host name (empty string = unused entry)
+  uint8_t  ip[4];                       // Resolved IPv4 address
+  uint8_t  found;                       // 1 = address resolved, 0 = host not found
+  uint8_t  refresh;                     // 1 = refresh requested
+  uint32_t time;                        // Time of resolution (kernel ticks)
+  uint32_t used;                        // Last use sequence number (for least recently used replacement)
+} dns_cache[WIFI_EMW3080_DNS_CACHE_SIZE];
+
+static uint32_t                         dns_cache_seq      = 0U;
+static WiFi_EMW3080_DnsCacheStats_t     dns_cache_stats;
+
+// Host name cache access protection mutex and refresh thread
+static osMutexId_t                      mutex_id_dns       = NULL;
+static osThreadId_t                     thread_id_dns      = NULL;
+
+static const osMutexAttr_t mutex_dns = {
+  "Mutex_dns",                          // Mutex name
+  osMutexPrioInherit,                   // attr_bits
+  NULL,                                 // Memory for control block
+  0U                                    // Size for control block
+};
+
+static const osThreadAttr_t thread_dns = {
+  "Thread_dns",                         // Thread name
+  osThreadJoinable,                     // attr_bits
+  NULL,                                 // Memory for control block
+  0U,                                   // Size for control block
+  NULL,                                 // Memory for stack
+  1024U,                                // Size of stack
+  osPriorityBelowNormal,                // Initial thread priority
+  0U,                                   // TrustZone module identifier
+  0U                                    // Reserved (must be 0)
+};
+#endif
+
+#if (SCAN_CACHE_ENABLED == 1)
+// Scan thread flags
+#define SCAN_FLAG_START                 (1U << 0)
+#define SCAN_FLAG_EXIT                  (1U << 1)
+
+// Scan result cache entries (networks in the order they were first seen)
+static struct {
+  ARM_WIFI_SCAN_INFO_t info;            // Network information
+  uint32_t             time;            // Time the network was last seen (kernel ticks)
+} scan_cache[WIFI_EMW3080_SCAN_CACHE_NUM];
+
+static uint32_t                         scan_cache_num     = 0U;        // Number of used entries
+static uint32_t                         scan_cache_time    = 0U;        // Time of the last full scan (kernel ticks)
+static uint8_t                          scan_cache_valid   = 0U;        // 1 = full scan was done
+static uint8_t                          scan_busy          = 0U;        // 1 = scan requested from the scan thread
+static char                             scan_ssid[33];                  // Requested SSID (empty string = full scan)
+
+// Scan result cache access protection mutex, module scan mutex and scan thread
+static osMutexId_t                      mutex_id_scan      = NULL;
+static osMutexId_t                      mutex_id_scan_run  = NULL;
+static osThreadId_t                     thread_id_scan     = NULL;
+
+static const osMutexAttr_t mutex_scan = {
+  "Mutex_scan",                         // Mutex name
+  osMutexPrioInherit,                   // attr_bits
+  NULL,                                 // Memory for control block
+  0U                                    // Size for control block
+};
+
+static const osMutexAttr_t mutex_scan_run = {
+  "Mutex_scan_run",                     // Mutex name
+  osMutexPrioInherit,                   // attr_bits
+  NULL,                                 // Memory for control block
+  0U                                    // Size for control block
+};
+
+static const osThreadAttr_t thread_scan = {
+  "Thread_scan",                        // Thread name
+  osThreadJoinable,                     // attr_bits
+  NULL,                                 // Memory for control block
+  0U,                                   // Size for control block
+  NULL,                                 // Memory for stack
+  1024U,                                // Size of stack
+  osPriorityBelowNormal,                // Initial thread priority
+  0U,                                   // TrustZone module identifier
+  0U                                    // Reserved (must be 0)
+};
+#endif
+
 // Mutex responsible for protecting sock_attr access 
 static const osMutexAttr_t mutex_sock_attr = {
   "Mutex_sock_attr",                    // Mutex name
@@ -192,6 +414,14 @@ static const osMutexAttr_t mutex_sock_attr = {
   0U                                    // Size for control block
 };
 
+// Mutex responsible for protecting single socket access
+static const osMutexAttr_t mutex_sock = {
+  "Mutex_sock",                         // Mutex name
+  osMutexPrioInherit,                   // attr_bits
+  NULL,                                 // Memory for control block
+  0U                                    // Size for control block
+};
+
 // Helper Functions
 
 // Convert error code: STM32Cube Mx WiFi Driver -> CMSIS WiFi Driver
@@ -311,6 +541,27 @@ static void ResetVariables (void) {
 
   memset((void *)scan_buf,  0, sizeof(scan_buf));
   memset((void *)sock_attr, 0, sizeof(sock_attr));
+  memset((void *)rx_buf_stats, 0, sizeof(rx_buf_stats));
+  memset((void *)sock_stats,   0, sizeof(sock_stats));
+#if (DNS_CACHE_ENABLED == 1)
+  memset((void *)dns_cache, 0, sizeof(dns_cache));
+  memset((void *)&dns_cache_stats, 0, sizeof(dns_cache_stats));
+  dns_cache_seq = 0U;
+#endif
+#if (SCAN_CACHE_ENABLED == 1)
+  memset((void *)scan_cache, 0, sizeof(scan_cache));
+  memset((void *)scan_ssid,  0, sizeof(scan_ssid));
+  scan_cache_num   = 0U;
+  scan_cache_time  = 0U;
+  scan_cache_valid = 0U;
+  scan_busy        = 0U;
+#endif
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 0)
+  memset((void *)ping_ip, 0, sizeof(ping_ip));
+  ping_count    = 0U;
+  ping_interval = 0U;
+  ping_busy     = 0U;
+#endif
 
   // Set default rcvtimeo
   for (int32_t i = 0; i < WIFI_EMW3080_SOCKETS_NUM; i++) {
@@ -319,182 +570,1005 @@ static void ResetVariables (void) {
 }
 
 /**
-  * @brief                   mxchip wifi status change callback
-  * @param  cate             status cate
-  * @param  status           status
-  * @param  arg              user arguments
-  */
-static void mx_wifi_status_changed(uint8_t cate, uint8_t status, void *arg) {
-  (void)arg;
+  \fn            void ScanInfoRepack (ARM_WIFI_SCAN_INFO_t *scan_info, const mwifi_ap_info_t *ap_info)
+  \brief         Repack network information from module scan result.
+  \param[out]    scan_info Pointer to network information
+  \param[in]     ap_info   Pointer to module scan result entry
+*/
+static void ScanInfoRepack (ARM_WIFI_SCAN_INFO_t *scan_info, const mwifi_ap_info_t *ap_info) {
+  uint32_t ssid_len;
 
-  if (cate == (uint8_t)MC_STATION) {
-    if (ef_id_sta_status != NULL) {
-      (void)osEventFlagsSet(ef_id_sta_status, status);
-    }
+  ssid_len = sizeof(scan_info->ssid);
+  if (ssid_len > sizeof(ap_info->ssid)) {
+    ssid_len = sizeof(ap_info->ssid);
   }
+
+  // Repack SSID
+  memcpy((void *)scan_info->ssid, (const void *)ap_info->ssid, ssid_len); 
+
+  // Repack BSSID
+  memcpy((void *)scan_info->bssid, (const void *)ap_info->bssid, 6); 
+
+  // Repack Security type
+  scan_info->security = ConvertSecurityTypeMxToCmsis(ap_info->security);
+
+  // Repack Channel
+  scan_info->ch = (uint8_t)ap_info->channel;
+
+  // Repack RSSI
+  scan_info->rssi = (uint8_t)ap_info->rssi;
 }
 
-// Driver Functions
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 0)
+/**
+  \fn            void SetModuleRcvWait (int32_t socket, uint32_t wait)
+  \brief         Set time the module waits for data on a single receive request.
+  \detail        Module receive timeout is only updated if it differs from the one already set.
+                 Function must be called with socket access protection mutex acquired.
+  \param[in]     socket   Socket identification number
+  \param[in]     wait     Time in milliseconds the module waits for data
+*/
+static void SetModuleRcvWait (int32_t socket, uint32_t wait) {
+
+  if (sock_attr[socket].rcvwait != wait) {
+    if (MX_WIFI_Socket_setsockopt(ptrMX_WIFIObject, socket, MX_SOL_SOCKET, (int32_t)MX_SO_RCVTIMEO, &wait, 4) == MX_WIFI_STATUS_OK) {
+      sock_attr[socket].rcvwait = wait;
+    } else {
+      sock_attr[socket].rcvwait = 0U;
+    }
+  }
+}
 
 /**
-  \fn            ARM_DRIVER_VERSION WiFi_GetVersion (void)
-  \brief         Get driver version.
-  \return        ARM_DRIVER_VERSION
+  \fn            uint32_t RxBufRead (int32_t socket, uint8_t *buf, uint32_t len)
+  \brief         Read data from socket local receive buffer.
+  \detail        Stream socket keeps data that was not read for subsequent reads, 
+                 for datagram socket the rest of the datagram is discarded.
+                 Function must be called with socket access protection mutex acquired.
+  \param[in]     socket   Socket identification number
+  \param[out]    buf      Pointer to buffer where data should be stored
+  \param[in]     len      Length of buffer (in bytes)
+  \return        number of bytes read
 */
-static ARM_DRIVER_VERSION WiFi_GetVersion (void) {
-  return driver_version;
+static uint32_t RxBufRead (int32_t socket, uint8_t *buf, uint32_t len) {
+  uint32_t len_to_copy;
+
+  len_to_copy = sock_attr[socket].rx_buf_available_len;
+  if (len_to_copy > len) {
+    len_to_copy = len;
+  }
+  memcpy(buf, &sock_attr[socket].rx_buf[sock_attr[socket].rx_buf_ofs], len_to_copy);
+
+  if (sock_attr[socket].type == ARM_SOCKET_SOCK_STREAM) {
+    sock_attr[socket].rx_buf_ofs           += (uint16_t)len_to_copy;
+    sock_attr[socket].rx_buf_available_len -= (uint16_t)len_to_copy;
+  } else {
+    sock_attr[socket].rx_buf_available_len  = 0U;
+  }
+  if (sock_attr[socket].rx_buf_available_len == 0U) {
+    sock_attr[socket].rx_buf_ofs = 0U;
+  }
+
+  return len_to_copy;
 }
 
 /**
-  \fn            ARM_WIFI_CAPABILITIES WiFi_GetCapabilities (void)
-  \brief         Get driver capabilities.
-  \return        ARM_WIFI_CAPABILITIES
+  \fn            int32_t RxBufFill (int32_t socket)
+  \brief         Receive data from the module into empty socket local receive buffer.
+  \detail        Module waits for data up to the receive timeout set with SetModuleRcvWait.
+                 Function must be called with socket access protection mutex acquired.
+  \param[in]     socket   Socket identification number
+  \return        number of bytes received (>=0) or CMSIS socket error code
 */
-static ARM_WIFI_CAPABILITIES WiFi_GetCapabilities (void) { 
-  return driver_capabilities;
+static int32_t RxBufFill (int32_t socket) {
+  SOCKADDR_STORAGE addr;
+  int32_t  addr_len = (int32_t)sizeof(addr);
+  int32_t  rc;
+
+  if (sock_attr[socket].type == ARM_SOCKET_SOCK_STREAM) {
+    rc = MX_WIFI_Socket_recv(ptrMX_WIFIObject, socket, (uint8_t *)sock_attr[socket].rx_buf, WIFI_EMW3080_SOCKETS_RX_BUF_SIZE, 0);
+  } else {
+    rc = MX_WIFI_Socket_recvfrom(ptrMX_WIFIObject, socket, (uint8_t *)sock_attr[socket].rx_buf, WIFI_EMW3080_SOCKETS_RX_BUF_SIZE, 0, (struct mx_sockaddr *)&addr, (uint32_t *)&addr_len);
+    if (rc > 0) {
+      // Store remote IP address and port of the datagram
+      const SOCKADDR_IN *sa = (SOCKADDR_IN *)&addr;
+      if ((sa->sin_family == (uint8_t)MX_AF_INET) && (sizeof(sa->sin_addr) >= 4U)) {
+        memcpy(sock_attr[socket].rx_ip, &sa->sin_addr, 4);
+        sock_attr[socket].rx_port = ntohs (sa->sin_port);
+      }
+    }
+  }
+  if (rc > 0) {
+    sock_attr[socket].rx_buf_ofs           = 0U;
+    sock_attr[socket].rx_buf_available_len = (uint16_t)rc;
+  } else if (rc < 0) {
+    rc = ConvertSocketErrorCodeMxToCmsis(rc);
+  }
+
+  return rc;
 }
 
 /**
-  \fn            int32_t WiFi_Initialize (ARM_WIFI_SignalEvent_t cb_event)
-  \brief         Initialize WiFi Module.
-  \param[in]     cb_event Pointer to ARM_WIFI_SignalEvent_t
+  \fn            int32_t PingRun (const uint8_t *ip, uint32_t count, uint32_t interval, WiFi_EMW3080_PingStats_t *stats)
+  \brief         Probe remote host with Ping probes sent by the module within a single request.
+  \param[in]     ip       Pointer to remote host IPv4 address
+  \param[in]     count    Number of probes (1 .. WIFI_EMW3080_PING_COUNT_MAX)
+  \param[in]     interval Interval between probes (in ms)
+  \param[out]    stats    Pointer to structure where round trip time statistics are returned
   \return        execution status
-                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_OK                : Operation successful (at least one probe answered)
                    - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_TIMEOUT     : Timeout occurred (no probe answered)
 */
-static int32_t WiFi_Initialize (ARM_WIFI_SignalEvent_t cb_event) {
-  int32_t ret, ret_mx;
-
-  driver_initialized = 0U;
-  signal_event_fn = cb_event;           // Update pointer to callback function
+static int32_t PingRun (const uint8_t *ip, uint32_t count, uint32_t interval, WiFi_EMW3080_PingStats_t *stats) {
+  char     str_addr[16];
+  int32_t  response[WIFI_EMW3080_PING_COUNT_MAX];
+  uint32_t i, rtt, rtt_prev, rtt_sum, rtt_diff;
+  int32_t  rc, str_rc;
 
-  ret = ARM_DRIVER_OK;
+  memset((void *)stats, 0, sizeof(WiFi_EMW3080_PingStats_t));
+  stats->sent = count;
 
-  if (mxwifi_probe((void **)&ptrMX_WIFIObject) != 0) {
-    ret = ARM_DRIVER_ERROR;
+  str_rc = snprintf(str_addr, 16, "%i.%i.%i.%i", ip[0], ip[1], ip[2], ip[3]);
+  if ((str_rc < 0) || (str_rc > 15)) {
+    return ARM_DRIVER_ERROR;
   }
 
-  if (ret == ARM_DRIVER_OK) {
-    if (ptrMX_WIFIObject->Runtime.interfaces == 0U) {
-      /* WiFi module hardware reboot */
-      ret_mx = MX_WIFI_HardResetModule(ptrMX_WIFIObject);
-      if (ret_mx != MX_WIFI_STATUS_OK) {
-        ret = ConvertErrorCodeMxToCmsis(ret_mx);
-      }
-    }
+  // Probes without response time are not answered
+  for (i = 0U; i < count; i++) {
+    response[i] = -1;
   }
 
-  if (ret == ARM_DRIVER_OK) {
-    /* Init the WiFi module */
-    ret_mx = MX_WIFI_Init(ptrMX_WIFIObject);
-    if (ret_mx != MX_WIFI_STATUS_OK) {
-      ret = ConvertErrorCodeMxToCmsis(ret_mx);
-    }
+  rc = MX_WIFI_Socket_ping(ptrMX_WIFIObject, (const char *)str_addr, (int32_t)count, (int32_t)interval, response);
+  if (rc == MX_WIFI_STATUS_ERROR) {
+    // Module reports error if no probe was answered
+    return ARM_DRIVER_ERROR_TIMEOUT;
   }
-
-  if (ret == ARM_DRIVER_OK) {
-    /* Initialize default network settings */
-    ptrMX_WIFIObject->NetSettings.DHCP_IsEnabled = 1U;
-
-    ResetVariables();
+  if (rc != MX_WIFI_STATUS_OK) {
+    return ConvertErrorCodeMxToCmsis(rc);
   }
 
-  if (ret == ARM_DRIVER_OK) {
-    if (mutex_id_sock_attr == NULL) {
-      mutex_id_sock_attr = osMutexNew(&mutex_sock_attr);
-      if (mutex_id_sock_attr == NULL) {
-        ret = ARM_DRIVER_ERROR;
-      }
+  rtt_prev = 0U;
+  rtt_sum  = 0U;
+  rtt_diff = 0U;
+  for (i = 0U; i < count; i++) {
+    if (response[i] < 0) {
+      continue;
     }
-  }
-
-  if (ret == ARM_DRIVER_OK) {
-    if (ef_id_sta_status == NULL) {
-      ef_id_sta_status = osEventFlagsNew(NULL);
-      if (ef_id_sta_status == NULL) {
-        ret = ARM_DRIVER_ERROR;
-      }
+    rtt = (uint32_t)response[i];
+    if ((stats->received == 0U) || (rtt < stats->rtt_min)) {
+      stats->rtt_min = rtt;
+    }
+    if (rtt > stats->rtt_max) {
+      stats->rtt_max = rtt;
+    }
+    if (stats->received != 0U) {
+      rtt_diff += (rtt > rtt_prev) ? (rtt - rtt_prev) : (rtt_prev - rtt);
     }
+    rtt_prev = rtt;
+    rtt_sum += rtt;
+    stats->received++;
   }
 
-  if (ret == ARM_DRIVER_OK) {
-    /* DHCP is enabled by default */
-    ptrMX_WIFIObject->NetSettings.DHCP_IsEnabled = 1U;
+  if (stats->received == 0U) {
+    return ARM_DRIVER_ERROR_TIMEOUT;
   }
 
-  if (ret == ARM_DRIVER_OK) {
-    driver_initialized = 1U;
+  stats->rtt_avg = rtt_sum / stats->received;
+  if (stats->received > 1U) {
+    stats->jitter = rtt_diff / (stats->received - 1U);
   }
 
-  return ret;
+  return ARM_DRIVER_OK;
 }
 
 /**
-  \fn            int32_t WiFi_Uninitialize (void)
-  \brief         De-initialize WiFi Module.
-  \return        execution status
-                   - ARM_DRIVER_OK                : Operation successful
-                   - ARM_DRIVER_ERROR             : Operation failed
+  \fn            void PingThread (void *arg)
+  \brief         Ping thread.
+  \detail        Executes pings started by WiFi_EMW3080_PingStart and signals their completion
+                 with WIFI_EMW3080_EVENT_PING_DONE event.
 */
-static int32_t WiFi_Uninitialize (void) {
-  int32_t ret, ret_mx;
+static __NO_RETURN void PingThread (void *arg) {
+  WiFi_EMW3080_PingStats_t stats;
+  uint8_t  ip[4];
+  uint32_t flags, count, interval;
 
-  ret = ARM_DRIVER_OK;
+  (void)arg;
 
-  if (mutex_id_sock_attr != NULL) {
-    if (osMutexDelete(mutex_id_sock_attr) == osOK) {
-      mutex_id_sock_attr = NULL;
-    } else {
-      ret = ARM_DRIVER_ERROR;
+  for (;;) {
+    flags = osThreadFlagsWait(PING_FLAG_START | PING_FLAG_EXIT, osFlagsWaitAny, osWaitForever);
+    if ((flags & osFlagsError) != 0U) {
+      continue;
+    }
+    if ((flags & PING_FLAG_EXIT) != 0U) {
+      break;
     }
-  }
 
-  if (ef_id_sta_status != NULL) {
-    if (osEventFlagsDelete(ef_id_sta_status) == osOK) {
-      ef_id_sta_status = NULL;
-    } else {
-      ret = ARM_DRIVER_ERROR;
+    if (osMutexAcquire(mutex_id_ping, osWaitForever) != osOK) {
+      continue;
     }
-  }
+    memcpy(ip, ping_ip, 4U);
+    count    = ping_count;
+    interval = ping_interval;
+    (void)osMutexRelease(mutex_id_ping);
 
-  if (ret == ARM_DRIVER_OK) {
-    ret_mx = MX_WIFI_DeInit(ptrMX_WIFIObject);
-    if (ret_mx == 0) {
-      ptrMX_WIFIObject = NULL;
-    } else {
-      ret = ConvertErrorCodeMxToCmsis(ret_mx);
+    (void)PingRun(ip, count, interval, &stats);
+
+    if (osMutexAcquire(mutex_id_ping, osWaitForever) == osOK) {
+      ping_busy = 0U;
+      (void)osMutexRelease(mutex_id_ping);
     }
-  }
 
-  if (ret == ARM_DRIVER_OK) {
-    driver_initialized = 0U;
-    ResetVariables();
+    if (signal_event_fn != NULL) {
+      signal_event_fn(WIFI_EMW3080_EVENT_PING_DONE, (void *)&stats);
+    }
   }
 
-  return ret;
+  osThreadExit();
 }
+#endif
 
+#if (DNS_CACHE_ENABLED == 1)
 /**
-  \fn            int32_t WiFi_PowerControl (ARM_POWER_STATE state)
-  \brief         Control WiFi Module Power.
-  \param[in]     state     Power state
-                   - ARM_POWER_OFF                : Power off: no operation possible
-                   - ARM_POWER_LOW                : Low-power mode: sleep or deep-sleep depending on ARM_WIFI_LP_TIMER option set
-                   - ARM_POWER_FULL               : Power on: full operation at maximum performance
-  \return        execution status
-                   - ARM_DRIVER_OK                : Operation successful
-                   - ARM_DRIVER_ERROR             : Operation failed
-                   - ARM_DRIVER_ERROR_UNSUPPORTED : Operation not supported
-                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid state)
+  \fn            int32_t DnsResolve (const char *name, uint8_t *ip)
+  \brief         Resolve host name by the module.
+  \param[in]     name     Host name
+  \param[out]    ip       Pointer to buffer where resolved IPv4 address is returned
+  \return        status information
+                   - 0                            : Operation successful
+                   - ARM_SOCKET_EHOSTNOTFOUND     : Host not found
+                   - other negative value         : Module request failed
 */
-static int32_t WiFi_PowerControl (ARM_POWER_STATE state) {
-  int32_t ret, ret_mx;
-
-  if (driver_initialized == 0U) {
-    return ARM_DRIVER_ERROR;
-  }
+static int32_t DnsResolve (const char *name, uint8_t *ip) {
+  SOCKADDR_STORAGE addr;
+  int32_t rc;
 
-  ret = ARM_DRIVER_OK;
+  rc = MX_WIFI_Socket_gethostbyname(ptrMX_WIFIObject, (struct mx_sockaddr *)&addr, (char *)name);
+  if (rc < 0) {
+    if (rc == MX_WIFI_STATUS_ERROR) {
+      // Consider MX_WIFI_STATUS_ERROR means that host was not found
+      return ARM_SOCKET_EHOSTNOTFOUND;
+    }
+    return ConvertSocketErrorCodeMxToCmsis(rc);
+  }
+  if (addr.ss_family != (uint8_t)MX_AF_INET) {
+    return ARM_SOCKET_ERROR;
+  }
+  memcpy(ip, &((SOCKADDR_IN *)&addr)->sin_addr, 4U);
+
+  return 0;
+}
+
+/**
+  \fn            int32_t DnsCacheFind (const char *name)
+  \brief         Find host name in the cache.
+  \detail        Function must be called with host name cache mutex acquired.
+  \param[in]     name     Host name
+  \return        cache entry index or -1 if host name is not cached
+*/
+static int32_t DnsCacheFind (const char *name) {
+  int32_t i;
+
+  for (i = 0; i < WIFI_EMW3080_DNS_CACHE_SIZE; i++) {
+    if ((dns_cache[i].name[0] != '\0') && (strcmp(dns_cache[i].name, name) == 0)) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/**
+  \fn            void DnsCacheStore (const char *name, const uint8_t *ip, uint8_t found)
+  \brief         Store resolution result into the cache.
+  \detail        Existing entry is updated, otherwise unused or least recently used entry is replaced.
+                 Function must be called with host name cache mutex acquired.
+  \param[in]     name     Host name
+  \param[in]     ip       Resolved IPv4 address (ignored if host was not found)
+  \param[in]     found    1 = address resolved, 0 = host not found
+*/
+static void DnsCacheStore (const char *name, const uint8_t *ip, uint8_t found) {
+  int32_t i, idx;
+
+  idx = DnsCacheFind(name);
+  if (idx < 0) {
+    idx = 0;
+    for (i = 0; i < WIFI_EMW3080_DNS_CACHE_SIZE; i++) {
+      if (dns_cache[i].name[0] == '\0') {
+        idx = i;
+        break;
+      }
+      if ((dns_cache_seq - dns_cache[i].used) > (dns_cache_seq - dns_cache[idx].used)) {
+        idx = i;
+      }
+    }
+    if (dns_cache[idx].name[0] != '\0') {
+      dns_cache_stats.evictions++;
+    }
+    strcpy(dns_cache[idx].name, name);
+    dns_cache[idx].used = ++dns_cache_seq;
+  }
+
+  if (found != 0U) {
+    memcpy(dns_cache[idx].ip, ip, 4U);
+  }
+  dns_cache[idx].found   = found;
+  dns_cache[idx].refresh = 0U;
+  dns_cache[idx].time    = osKernelGetTickCount();
+}
+
+/**
+  \fn            void DnsCacheClear (void)
+  \brief         Remove all host names from the cache.
+*/
+static void DnsCacheClear (void) {
+
+  if (osMutexAcquire(mutex_id_dns, osWaitForever) == osOK) {
+    memset((void *)dns_cache, 0, sizeof(dns_cache));
+    (void)osMutexRelease(mutex_id_dns);
+  }
+}
+
+/**
+  \fn            void DnsRefreshThread (void *arg)
+  \brief         Host name cache refresh thread.
+  \detail        Resolves host names of expired cache entries that are still in use, so that
+                 lookups of cached host names do not wait for the module.
+*/
+static __NO_RETURN void DnsRefreshThread (void *arg) {
+  char     name[WIFI_EMW3080_DNS_CACHE_NAME_LEN];
+  uint8_t  ip[4];
+  uint32_t flags;
+  int32_t  i, rc;
+
+  (void)arg;
+
+  for (;;) {
+    flags = osThreadFlagsWait(DNS_FLAG_REFRESH | DNS_FLAG_EXIT, osFlagsWaitAny, osWaitForever);
+    if ((flags & osFlagsError) != 0U) {
+      continue;
+    }
+    if ((flags & DNS_FLAG_EXIT) != 0U) {
+      break;
+    }
+
+    // Refresh all entries with pending request
+    for (;;) {
+      name[0] = '\0';
+      if (osMutexAcquire(mutex_id_dns, osWaitForever) == osOK) {
+        for (i = 0; i < WIFI_EMW3080_DNS_CACHE_SIZE; i++) {
+          if ((dns_cache[i].name[0] != '\0') && (dns_cache[i].refresh != 0U)) {
+            dns_cache[i].refresh = 0U;
+            strcpy(name, dns_cache[i].name);
+            break;
+          }
+        }
+        (void)osMutexRelease(mutex_id_dns);
+      }
+      if (name[0] == '\0') {
+        break;
+      }
+
+      rc = DnsResolve(name, ip);
+
+      if (osMutexAcquire(mutex_id_dns, osWaitForever) == osOK) {
+        dns_cache_stats.refreshes++;
+        // Entry may have been replaced in the meantime, then the result is not stored
+        if (DnsCacheFind(name) >= 0) {
+          if (rc == 0) {
+            DnsCacheStore(name, ip, 1U);
+          } else if (rc == ARM_SOCKET_EHOSTNOTFOUND) {
+            DnsCacheStore(name, NULL, 0U);
+          } else {
+            // Module request failed, stale address is kept until it expires
+          }
+        }
+        (void)osMutexRelease(mutex_id_dns);
+      }
+    }
+  }
+
+  osThreadExit();
+}
+#endif
+
+#if (SCAN_CACHE_ENABLED == 1)
+/**
+  \fn            void ScanCacheUpdate (const mwifi_ap_info_t *ap_info, int32_t ap_num, uint8_t full)
+  \brief         Store module scan result into the cache.
+  \detail        Full scan result replaces the cached networks (networks that do not fit are dropped),
+                 targeted scan result updates cached networks with the same BSSID or adds them,
+                 replacing the network not seen for the longest time when the cache is full.
+  \param[in]     ap_info  Pointer to module scan result entries
+  \param[in]     ap_num   Number of module scan result entries
+  \param[in]     full     1 = full scan result, 0 = targeted scan result
+*/
+static void ScanCacheUpdate (const mwifi_ap_info_t *ap_info, int32_t ap_num, uint8_t full) {
+  uint32_t now, idx, i;
+  int32_t  n;
+
+  if (osMutexAcquire(mutex_id_scan, osWaitForever) != osOK) {
+    return;
+  }
+
+  now = osKernelGetTickCount();
+  if (full != 0U) {
+    scan_cache_num = 0U;
+  }
+
+  for (n = 0; n < ap_num; n++) {
+    for (idx = 0U; idx < scan_cache_num; idx++) {
+      if (memcmp(scan_cache[idx].info.bssid, ap_info[n].bssid, 6) == 0) {
+        break;
+      }
+    }
+    if (idx == scan_cache_num) {
+      if (scan_cache_num < WIFI_EMW3080_SCAN_CACHE_NUM) {
+        scan_cache_num++;
+      } else if (full != 0U) {
+        break;
+      } else {
+        idx = 0U;
+        for (i = 1U; i < scan_cache_num; i++) {
+          if ((now - scan_cache[i].time) > (now - scan_cache[idx].time)) {
+            idx = i;
+          }
+        }
+      }
+    }
+    ScanInfoRepack(&scan_cache[idx].info, &ap_info[n]);
+    scan_cache[idx].time = now;
+  }
+
+  if (full != 0U) {
+    scan_cache_time  = now;
+    scan_cache_valid = 1U;
+  }
+
+  (void)osMutexRelease(mutex_id_scan);
+}
+
+/**
+  \fn            int32_t ScanCacheGet (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num, uint32_t max_age)
+  \brief         Get cached networks if the last full scan is recent.
+  \param[out]    scan_info Pointer to array of ARM_WIFI_SCAN_INFO_t structures where networks are returned
+  \param[in]     max_num   Maximum number of networks to return
+  \param[in]     max_age   Maximum time since the last full scan (in ms)
+  \return        number of networks returned or -1 if the cache does not hold a recent full scan result
+*/
+static int32_t ScanCacheGet (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num, uint32_t max_age) {
+  uint32_t i;
+  int32_t  ret;
+
+  ret = -1;
+
+  if (osMutexAcquire(mutex_id_scan, osWaitForever) == osOK) {
+    if ((scan_cache_valid != 0U) && ((osKernelGetTickCount() - scan_cache_time) < max_age)) {
+      for (i = 0U; (i < scan_cache_num) && (i < max_num); i++) {
+        scan_info[i] = scan_cache[i].info;
+      }
+      ret = (int32_t)i;
+    }
+    (void)osMutexRelease(mutex_id_scan);
+  }
+
+  return ret;
+}
+
+/**
+  \fn            int32_t ScanRun (const char *ssid)
+  \brief         Scan for networks by the module and store the result into the cache.
+  \detail        Module scans are serialized, as the module keeps only the result of the last scan.
+  \param[in]     ssid     SSID of network to actively scan for (empty string = full passive scan)
+  \return        number of networks found or ARM_DRIVER_ERROR
+*/
+static int32_t ScanRun (const char *ssid) {
+  int32_t ret, ret_mx, len;
+  int8_t  ap_num;
+
+  if (osMutexAcquire(mutex_id_scan_run, osWaitForever) != osOK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  ret = ARM_DRIVER_ERROR;
+  len = (int32_t)strlen(ssid);
+
+  if (len == 0) {
+    ret_mx = MX_WIFI_Scan(ptrMX_WIFIObject, MC_SCAN_PASSIVE, NULL, 0);
+  } else {
+    ret_mx = MX_WIFI_Scan(ptrMX_WIFIObject, MC_SCAN_ACTIVE, (char *)ssid, len);
+  }
+
+  if (ret_mx == MX_WIFI_STATUS_OK) {
+    ap_num = MX_WIFI_Get_scan_result(ptrMX_WIFIObject, scan_buf, (uint8_t)(sizeof(scan_buf) / sizeof(mwifi_ap_info_t)));
+    if (ap_num >= 0) {
+      ScanCacheUpdate((const mwifi_ap_info_t *)scan_buf, ap_num, (len == 0) ? 1U : 0U);
+      ret = ap_num;
+    }
+  }
+
+  (void)osMutexRelease(mutex_id_scan_run);
+
+  return ret;
+}
+
+/**
+  \fn            void ScanThread (void *arg)
+  \brief         Scan thread.
+  \detail        Executes scans started by WiFi_EMW3080_ScanStart and periodic background full scans,
+                 and signals their completion with WIFI_EMW3080_EVENT_SCAN_DONE event.
+*/
+static __NO_RETURN void ScanThread (void *arg) {
+  char     ssid[33];
+  uint32_t flags, timeout;
+  int32_t  rc;
+
+  (void)arg;
+
+  if (WIFI_EMW3080_SCAN_REFRESH_INTERVAL > 0) {
+    timeout = (uint32_t)WIFI_EMW3080_SCAN_REFRESH_INTERVAL;
+  } else {
+    timeout = osWaitForever;
+  }
+
+  for (;;) {
+    flags = osThreadFlagsWait(SCAN_FLAG_START | SCAN_FLAG_EXIT, osFlagsWaitAny, timeout);
+    if (flags == osFlagsErrorTimeout) {
+      // Background refresh, skipped if a full scan was done within the refresh interval
+      if (ScanCacheGet(NULL, 0U, timeout) >= 0) {
+        continue;
+      }
+      ssid[0] = '\0';
+    } else if ((flags & osFlagsError) != 0U) {
+      continue;
+    } else if ((flags & SCAN_FLAG_EXIT) != 0U) {
+      break;
+    } else {
+      ssid[0] = '\0';
+      if (osMutexAcquire(mutex_id_scan, osWaitForever) == osOK) {
+        strcpy(ssid, scan_ssid);
+        (void)osMutexRelease(mutex_id_scan);
+      }
+    }
+
+    rc = ScanRun(ssid);
+
+    if (flags != osFlagsErrorTimeout) {
+      if (osMutexAcquire(mutex_id_scan, osWaitForever) == osOK) {
+        scan_busy = 0U;
+        (void)osMutexRelease(mutex_id_scan);
+      }
+    }
+
+    if (signal_event_fn != NULL) {
+      signal_event_fn(WIFI_EMW3080_EVENT_SCAN_DONE, (void *)&rc);
+    }
+  }
+
+  osThreadExit();
+}
+#endif
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+/**
+  \fn            void EthRxFlush (void)
+  \brief         Release all received frames that were not read.
+*/
+static void EthRxFlush (void) {
+  mx_buf_t *frame;
+
+  if (eth_rx_frame != NULL) {
+    MX_NET_BUFFER_FREE(eth_rx_frame);
+    eth_rx_frame = NULL;
+  }
+  if (mq_id_eth_rx != NULL) {
+    while (osMessageQueueGet(mq_id_eth_rx, &frame, NULL, 0U) == osOK) {
+      MX_NET_BUFFER_FREE(frame);
+    }
+  }
+}
+
+/**
+  \fn            mx_buf_t *EthRxFrame (void)
+  \brief         Get the frame to be read, without removing it.
+  \return        pointer to frame buffer or NULL if no frame was received
+*/
+static mx_buf_t *EthRxFrame (void) {
+
+  if (eth_rx_frame == NULL) {
+    if (osMessageQueueGet(mq_id_eth_rx, &eth_rx_frame, NULL, 0U) != osOK) {
+      eth_rx_frame = NULL;
+    }
+  }
+
+  return eth_rx_frame;
+}
+
+/**
+  \fn            void mx_wifi_netlink_input (mx_buf_t *netbuf, void *user_args)
+  \brief         Bypass mode frame reception callback.
+  \detail        Called from the Mx WiFi receive thread with the frame in the network buffer
+                 payload (module header hidden). The buffer is queued as received and is
+                 released when the frame is read.
+  \param[in]     netbuf     Network buffer containing the frame
+  \param[in]     user_args  Pointer to module interface index
+*/
+static void mx_wifi_netlink_input (mx_buf_t *netbuf, void *user_args) {
+  uint32_t interface;
+
+  if ((*(uint32_t *)user_args != (uint32_t)STATION_IDX) ||
+      (osMessageQueuePut(mq_id_eth_rx, &netbuf, 0U, 0U) != osOK)) {
+    // Only Station is supported, frame is dropped also if the queue is full
+    MX_NET_BUFFER_FREE(netbuf);
+    return;
+  }
+
+  if (signal_event_fn != NULL) {
+    interface = 0U;
+    signal_event_fn(ARM_WIFI_EVENT_ETH_RX_FRAME, &interface);
+  }
+}
+#endif
+
+/**
+  * @brief                   mxchip wifi status change callback
+  * @param  cate             status cate
+  * @param  status           status
+  * @param  arg              user arguments
+  */
+static void mx_wifi_status_changed(uint8_t cate, uint8_t status, void *arg) {
+  (void)arg;
+
+  if (cate == (uint8_t)MC_STATION) {
+    if (ef_id_sta_status != NULL) {
+      (void)osEventFlagsSet(ef_id_sta_status, status);
+    }
+  }
+}
+
+// Driver Functions
+
+/**
+  \fn            ARM_DRIVER_VERSION WiFi_GetVersion (void)
+  \brief         Get driver version.
+  \return        ARM_DRIVER_VERSION
+*/
+static ARM_DRIVER_VERSION WiFi_GetVersion (void) {
+  return driver_version;
+}
+
+/**
+  \fn            ARM_WIFI_CAPABILITIES WiFi_GetCapabilities (void)
+  \brief         Get driver capabilities.
+  \return        ARM_WIFI_CAPABILITIES
+*/
+static ARM_WIFI_CAPABILITIES WiFi_GetCapabilities (void) { 
+  return driver_capabilities;
+}
+
+/**
+  \fn            int32_t WiFi_Initialize (ARM_WIFI_SignalEvent_t cb_event)
+  \brief         Initialize WiFi Module.
+  \param[in]     cb_event Pointer to ARM_WIFI_SignalEvent_t
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+*/
+static int32_t WiFi_Initialize (ARM_WIFI_SignalEvent_t cb_event) {
+  int32_t ret, ret_mx, i;
+
+  driver_initialized = 0U;
+  signal_event_fn = cb_event;           // Update pointer to callback function
+
+  ret = ARM_DRIVER_OK;
+
+  if (mxwifi_probe((void **)&ptrMX_WIFIObject) != 0) {
+    ret = ARM_DRIVER_ERROR;
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (ptrMX_WIFIObject->Runtime.interfaces == 0U) {
+      /* WiFi module hardware reboot */
+      ret_mx = MX_WIFI_HardResetModule(ptrMX_WIFIObject);
+      if (ret_mx != MX_WIFI_STATUS_OK) {
+        ret = ConvertErrorCodeMxToCmsis(ret_mx);
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    /* Init the WiFi module */
+    ret_mx = MX_WIFI_Init(ptrMX_WIFIObject);
+    if (ret_mx != MX_WIFI_STATUS_OK) {
+      ret = ConvertErrorCodeMxToCmsis(ret_mx);
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    /* Initialize default network settings */
+    ptrMX_WIFIObject->NetSettings.DHCP_IsEnabled = 1U;
+
+    ResetVariables();
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (mutex_id_sock_attr == NULL) {
+      mutex_id_sock_attr = osMutexNew(&mutex_sock_attr);
+      if (mutex_id_sock_attr == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    for (i = 0; i < WIFI_EMW3080_SOCKETS_NUM; i++) {
+      if (mutex_id_sock[i] == NULL) {
+        mutex_id_sock[i] = osMutexNew(&mutex_sock);
+        if (mutex_id_sock[i] == NULL) {
+          ret = ARM_DRIVER_ERROR;
+          break;
+        }
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (ef_id_sta_status == NULL) {
+      ef_id_sta_status = osEventFlagsNew(NULL);
+      if (ef_id_sta_status == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+#if (DNS_CACHE_ENABLED == 1)
+  if (ret == ARM_DRIVER_OK) {
+    if (mutex_id_dns == NULL) {
+      mutex_id_dns = osMutexNew(&mutex_dns);
+      if (mutex_id_dns == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (thread_id_dns == NULL) {
+      thread_id_dns = osThreadNew(DnsRefreshThread, NULL, &thread_dns);
+      if (thread_id_dns == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+#endif
+
+#if (SCAN_CACHE_ENABLED == 1)
+  if (ret == ARM_DRIVER_OK) {
+    if (mutex_id_scan == NULL) {
+      mutex_id_scan = osMutexNew(&mutex_scan);
+      if (mutex_id_scan == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (mutex_id_scan_run == NULL) {
+      mutex_id_scan_run = osMutexNew(&mutex_scan_run);
+      if (mutex_id_scan_run == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (thread_id_scan == NULL) {
+      thread_id_scan = osThreadNew(ScanThread, NULL, &thread_scan);
+      if (thread_id_scan == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+#endif
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 0)
+  if (ret == ARM_DRIVER_OK) {
+    if (mutex_id_ping == NULL) {
+      mutex_id_ping = osMutexNew(&mutex_ping);
+      if (mutex_id_ping == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    if (thread_id_ping == NULL) {
+      thread_id_ping = osThreadNew(PingThread, NULL, &thread_ping);
+      if (thread_id_ping == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+#endif
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+  if (ret == ARM_DRIVER_OK) {
+    if (mq_id_eth_rx == NULL) {
+      mq_id_eth_rx = osMessageQueueNew(WIFI_EMW3080_ETH_RX_QUEUE_SIZE, sizeof(mx_buf_t *), NULL);
+      if (mq_id_eth_rx == NULL) {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+#endif
+
+  if (ret == ARM_DRIVER_OK) {
+    /* DHCP is enabled by default */
+    ptrMX_WIFIObject->NetSettings.DHCP_IsEnabled = 1U;
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    driver_initialized = 1U;
+  }
+
+  return ret;
+}
+
+/**
+  \fn            int32_t WiFi_Uninitialize (void)
+  \brief         De-initialize WiFi Module.
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+*/
+static int32_t WiFi_Uninitialize (void) {
+  int32_t ret, ret_mx, i;
+
+  ret = ARM_DRIVER_OK;
+
+  if (mutex_id_sock_attr != NULL) {
+    if (osMutexDelete(mutex_id_sock_attr) == osOK) {
+      mutex_id_sock_attr = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  for (i = 0; i < WIFI_EMW3080_SOCKETS_NUM; i++) {
+    if (mutex_id_sock[i] != NULL) {
+      if (osMutexDelete(mutex_id_sock[i]) == osOK) {
+        mutex_id_sock[i] = NULL;
+      } else {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+
+  if (ef_id_sta_status != NULL) {
+    if (osEventFlagsDelete(ef_id_sta_status) == osOK) {
+      ef_id_sta_status = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+#if (DNS_CACHE_ENABLED == 1)
+  if (thread_id_dns != NULL) {
+    // Thread exits after completing refresh in progress
+    (void)osThreadFlagsSet(thread_id_dns, DNS_FLAG_EXIT);
+    if (osThreadJoin(thread_id_dns) == osOK) {
+      thread_id_dns = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  if ((thread_id_dns == NULL) && (mutex_id_dns != NULL)) {
+    if (osMutexDelete(mutex_id_dns) == osOK) {
+      mutex_id_dns = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+#endif
+
+#if (SCAN_CACHE_ENABLED == 1)
+  if (thread_id_scan != NULL) {
+    // Thread exits after completing scan in progress
+    (void)osThreadFlagsSet(thread_id_scan, SCAN_FLAG_EXIT);
+    if (osThreadJoin(thread_id_scan) == osOK) {
+      thread_id_scan = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  if (thread_id_scan == NULL) {
+    if (mutex_id_scan != NULL) {
+      if (osMutexDelete(mutex_id_scan) == osOK) {
+        mutex_id_scan = NULL;
+      } else {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+    if (mutex_id_scan_run != NULL) {
+      if (osMutexDelete(mutex_id_scan_run) == osOK) {
+        mutex_id_scan_run = NULL;
+      } else {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+  }
+#endif
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 0)
+  if (thread_id_ping != NULL) {
+    // Thread exits after completing ping in progress
+    (void)osThreadFlagsSet(thread_id_ping, PING_FLAG_EXIT);
+    if (osThreadJoin(thread_id_ping) == osOK) {
+      thread_id_ping = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  if ((thread_id_ping == NULL) && (mutex_id_ping != NULL)) {
+    if (osMutexDelete(mutex_id_ping) == osOK) {
+      mutex_id_ping = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+#endif
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+  if (mq_id_eth_rx != NULL) {
+    EthRxFlush();
+    if (osMessageQueueDelete(mq_id_eth_rx) == osOK) {
+      mq_id_eth_rx = NULL;
+    } else {
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+#endif
+
+  if (ret == ARM_DRIVER_OK) {
+    ret_mx = MX_WIFI_DeInit(ptrMX_WIFIObject);
+    if (ret_mx == 0) {
+      ptrMX_WIFIObject = NULL;
+    } else {
+      ret = ConvertErrorCodeMxToCmsis(ret_mx);
+    }
+  }
+
+  if (ret == ARM_DRIVER_OK) {
+    driver_initialized = 0U;
+    ResetVariables();
+  }
+
+  return ret;
+}
+
+/**
+  \fn            int32_t WiFi_PowerControl (ARM_POWER_STATE state)
+  \brief         Control WiFi Module Power.
+  \param[in]     state     Power state
+                   - ARM_POWER_OFF                : Power off: no operation possible
+                   - ARM_POWER_LOW                : Low-power mode: sleep or deep-sleep depending on ARM_WIFI_LP_TIMER option set
+                   - ARM_POWER_FULL               : Power on: full operation at maximum performance
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_UNSUPPORTED : Operation not supported
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid state)
+*/
+static int32_t WiFi_PowerControl (ARM_POWER_STATE state) {
+  int32_t ret, ret_mx;
+
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  ret = ARM_DRIVER_OK;
 
   switch (state) {
     case ARM_POWER_OFF:
@@ -778,6 +1852,9 @@ static int32_t WiFi_GetOption (uint32_t interface, uint32_t option, void *data,
 /**
   \fn            int32_t WiFi_Scan (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num)
   \brief         Scan for available networks in range.
+  \detail        Result of a full scan done within WIFI_EMW3080_SCAN_CACHE_TIME is returned from the cache
+                 (also when done in background or started by WiFi_EMW3080_ScanStart), otherwise
+                 the function waits for a full scan by the module.
   \param[out]    scan_info Pointer to array of ARM_WIFI_SCAN_INFO_t structures where available Scan Information will be returned
   \param[in]     max_num   Maximum number of Network Information structures to return
   \return        number of ARM_WIFI_SCAN_INFO_t structures returned or error code
@@ -787,9 +1864,10 @@ static int32_t WiFi_GetOption (uint32_t interface, uint32_t option, void *data,
 */
 static int32_t WiFi_Scan (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num) {
   int32_t ret;
+#if (SCAN_CACHE_ENABLED == 0)
   int8_t  i, ap_num;
-  uint32_t ssid_len;
   const mwifi_ap_info_t *ptr_ap_info;
+#endif
 
   if ((scan_info == NULL) || (max_num == 0U)) {
     return ARM_DRIVER_ERROR_PARAMETER;
@@ -798,6 +1876,16 @@ static int32_t WiFi_Scan (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num) {
     return ARM_DRIVER_ERROR;
   }
 
+#if (SCAN_CACHE_ENABLED == 1)
+  ret = ScanCacheGet(scan_info, max_num, (uint32_t)WIFI_EMW3080_SCAN_CACHE_TIME);
+  if (ret < 0) {
+    if (ScanRun("") < 0) {
+      ret = ARM_DRIVER_ERROR;
+    } else {
+      ret = ScanCacheGet(scan_info, max_num, osWaitForever);
+    }
+  }
+#else
   ret = ARM_DRIVER_OK;
   ap_num = 0;
 
@@ -821,30 +1909,13 @@ static int32_t WiFi_Scan (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num) {
     // Repack scan results from scan_buf into scan_info
     ptr_ap_info = (mwifi_ap_info_t *)scan_buf;
 
-    ssid_len = sizeof(scan_info[0].ssid);
-    if (ssid_len > sizeof(ptr_ap_info[0].ssid)) {
-      ssid_len = sizeof(ptr_ap_info[0].ssid);
-    }
-
     for (i = 0; i < ap_num; i++) {
-      // Repack SSID
-      memcpy((void *)scan_info[i].ssid, (const void *)ptr_ap_info[i].ssid, ssid_len); 
-
-      // Repack BSSID
-      memcpy((void *)scan_info[i].bssid, (const void *)ptr_ap_info[i].bssid, 6); 
-
-      // Repack Security type
-      scan_info[i].security = ConvertSecurityTypeMxToCmsis(ptr_ap_info[i].security);
-
-      // Repack Channel
-      scan_info[i].ch = (uint8_t)ptr_ap_info[i].channel;
-
-      // Repack RSSI
-      scan_info[i].rssi = (uint8_t)ptr_ap_info[i].rssi;
+      ScanInfoRepack(&scan_info[i], &ptr_ap_info[i]);
     }
 
     ret = ap_num;
   }
+#endif
 
   return ret;
 }
@@ -909,6 +1980,7 @@ static int32_t WiFi_Activate (uint32_t interface, const ARM_WIFI_CONFIG_t *confi
     }
   }   
 
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 0)
   /* Get IP */
   if (ret == ARM_DRIVER_OK) {
     for (tout = 0U; tout < 60U; tout++) {
@@ -922,6 +1994,11 @@ static int32_t WiFi_Activate (uint32_t interface, const ARM_WIFI_CONFIG_t *confi
   if (ret_mx != MX_WIFI_STATUS_OK) {
     ret = ConvertErrorCodeMxToCmsis(ret_mx);
   }
+#else
+  // In bypass mode the IP address is configured by the host network stack
+  (void)tout;
+  (void)local_ip;
+#endif
 
   return ret;
 }
@@ -953,6 +2030,11 @@ static int32_t WiFi_Deactivate (uint32_t interface) {
     ret = ConvertErrorCodeMxToCmsis(ret_mx);
   }
 
+#if (DNS_CACHE_ENABLED == 1)
+  // Cached host names may resolve differently on the next network
+  DnsCacheClear();
+#endif
+
   // Un-register status change callback
   if (ret == ARM_DRIVER_OK) {
     ret_mx = MX_WIFI_UnRegisterStatusCallback_if(ptrMX_WIFIObject, (mwifi_if_t)MC_STATION);
@@ -965,36 +2047,186 @@ static int32_t WiFi_Deactivate (uint32_t interface) {
 }
 
 /**
-  \fn            uint32_t WiFi_IsConnected (void)
-  \brief         Get station connection status.
-  \return        station connection status
-                   - value != 0: Station connected
-                   - value = 0: Station not connected
+  \fn            uint32_t WiFi_IsConnected (void)
+  \brief         Get station connection status.
+  \return        station connection status
+                   - value != 0: Station connected
+                   - value = 0: Station not connected
+*/
+static uint32_t WiFi_IsConnected (void) {
+
+  if (driver_initialized == 0U) {
+    return 0U;
+  }
+
+  return ((uint32_t)MX_WIFI_IsConnected(ptrMX_WIFIObject));
+}
+
+/**
+  \fn            int32_t WiFi_GetNetInfo (ARM_WIFI_NET_INFO_t *net_info)
+  \brief         Get station Network Information.
+  \param[out]    net_info  Pointer to ARM_WIFI_NET_INFO_t structure where station Network Information will be returned
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed (station not connected)
+                   - ARM_DRIVER_ERROR_UNSUPPORTED : Operation not supported
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid interface or NULL net_info pointer)
+*/
+static int32_t WiFi_GetNetInfo (ARM_WIFI_NET_INFO_t *net_info) {
+  (void)net_info;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+/**
+  \fn            int32_t WiFi_BypassControl (uint32_t interface, uint32_t mode)
+  \brief         Enable or disable bypass (pass-through) mode. Transmit and receive Ethernet frames (IP layer bypassed and WiFi/Ethernet translation).
+  \param[in]     interface Interface (0 = Station, 1 = Access Point)
+  \param[in]     mode
+                   - value = 1: all packets bypass internal IP stack
+                   - value = 0: all packets processed by internal IP stack
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid interface or mode)
+*/
+static int32_t WiFi_BypassControl (uint32_t interface, uint32_t mode) {
+  int32_t ret, ret_mx;
+
+  if (interface != 0U) {
+    // Access Point not supported
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (mode > 1U) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  ret = ARM_DRIVER_OK;
+
+  if (mode != 0U) {
+    ret_mx = MX_WIFI_Network_bypass_mode_set(ptrMX_WIFIObject, 1, mx_wifi_netlink_input, NULL);
+  } else {
+    ret_mx = MX_WIFI_Network_bypass_mode_set(ptrMX_WIFIObject, 0, NULL, NULL);
+  }
+  if (ret_mx != MX_WIFI_STATUS_OK) {
+    ret = ConvertErrorCodeMxToCmsis(ret_mx);
+  }
+
+  if ((ret == ARM_DRIVER_OK) && (mode == 0U)) {
+    EthRxFlush();
+  }
+
+  return ret;
+}
+
+/**
+  \fn            int32_t WiFi_EthSendFrame (uint32_t interface, const uint8_t *frame, uint32_t len)
+  \brief         Send Ethernet frame (in bypass mode only).
+  \detail        Frame is sent from the caller buffer, it is not copied.
+  \param[in]     interface Interface (0 = Station, 1 = Access Point)
+  \param[in]     frame    Pointer to frame buffer
+  \param[in]     len      Frame length in bytes
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid interface, NULL frame pointer or invalid length)
+*/
+static int32_t WiFi_EthSendFrame (uint32_t interface, const uint8_t *frame, uint32_t len) {
+  int32_t ret, ret_mx;
+
+  if (interface != 0U) {
+    // Access Point not supported
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if ((frame == NULL) || (len == 0U) || (len > (uint32_t)(MX_WIFI_MTU_SIZE + MX_WIFI_PBUF_LINK_HLEN))) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  ret = ARM_DRIVER_OK;
+
+  ret_mx = MX_WIFI_Network_bypass_netlink_output(ptrMX_WIFIObject, (void *)frame, (int32_t)len, (int32_t)STATION_IDX);
+  if (ret_mx != MX_WIFI_STATUS_OK) {
+    ret = ConvertErrorCodeMxToCmsis(ret_mx);
+  }
+
+  return ret;
+}
+
+/**
+  \fn            int32_t WiFi_EthReadFrame (uint32_t interface, uint8_t *frame, uint32_t len)
+  \brief         Read data of received Ethernet frame (in bypass mode only).
+  \param[in]     interface Interface (0 = Station, 1 = Access Point)
+  \param[in]     frame    Pointer to frame buffer for data to read into (NULL to drop the frame)
+  \param[in]     len      Frame buffer length in bytes
+  \return        number of data bytes read or execution status
+                   - value >= 0: number of data bytes read
+                   - value < 0: error occurred
+                     - ARM_DRIVER_ERROR             : Operation failed (frame bigger than buffer, frame is dropped)
+                     - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid interface)
+*/
+static int32_t WiFi_EthReadFrame (uint32_t interface, uint8_t *frame, uint32_t len) {
+  mx_buf_t *rx_frame;
+  uint32_t  rx_len;
+  int32_t   ret;
+
+  if (interface != 0U) {
+    // Access Point not supported
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  ret = 0;
+
+  rx_frame = EthRxFrame();
+  if (rx_frame != NULL) {
+    rx_len = MX_NET_BUFFER_GET_PAYLOAD_SIZE(rx_frame);
+    if (frame != NULL) {
+      if (rx_len <= len) {
+        memcpy(frame, MX_NET_BUFFER_PAYLOAD(rx_frame), rx_len);
+        ret = (int32_t)rx_len;
+      } else {
+        ret = ARM_DRIVER_ERROR;
+      }
+    }
+    eth_rx_frame = NULL;
+    MX_NET_BUFFER_FREE(rx_frame);
+  }
+
+  return ret;
+}
+
+/**
+  \fn            uint32_t WiFi_EthGetRxFrameSize (uint32_t interface)
+  \brief         Get size of received Ethernet frame (in bypass mode only).
+  \param[in]     interface Interface (0 = Station, 1 = Access Point)
+  \return        number of bytes in received frame
 */
-static uint32_t WiFi_IsConnected (void) {
+static uint32_t WiFi_EthGetRxFrameSize (uint32_t interface) {
+  mx_buf_t *rx_frame;
 
-  if (driver_initialized == 0U) {
+  if ((interface != 0U) || (driver_initialized == 0U)) {
     return 0U;
   }
 
-  return ((uint32_t)MX_WIFI_IsConnected(ptrMX_WIFIObject));
-}
-
-/**
-  \fn            int32_t WiFi_GetNetInfo (ARM_WIFI_NET_INFO_t *net_info)
-  \brief         Get station Network Information.
-  \param[out]    net_info  Pointer to ARM_WIFI_NET_INFO_t structure where station Network Information will be returned
-  \return        execution status
-                   - ARM_DRIVER_OK                : Operation successful
-                   - ARM_DRIVER_ERROR             : Operation failed (station not connected)
-                   - ARM_DRIVER_ERROR_UNSUPPORTED : Operation not supported
-                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (invalid interface or NULL net_info pointer)
-*/
-static int32_t WiFi_GetNetInfo (ARM_WIFI_NET_INFO_t *net_info) {
-  (void)net_info;
+  rx_frame = EthRxFrame();
+  if (rx_frame == NULL) {
+    return 0U;
+  }
 
-  return ARM_DRIVER_ERROR_UNSUPPORTED;
+  return MX_NET_BUFFER_GET_PAYLOAD_SIZE(rx_frame);
 }
+#endif
+
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 0)
 
 /**
   \fn            int32_t WiFi_SocketCreate (int32_t af, int32_t type, int32_t protocol)
@@ -1057,31 +2289,34 @@ static int32_t WiFi_SocketCreate (int32_t af, int32_t type, int32_t protocol) {
       return ARM_SOCKET_EINVAL;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
-
-    rc = MX_WIFI_Socket_create(ptrMX_WIFIObject, mx_domain, mx_type, mx_protocol);
-    if ((rc >= 0) && (rc < WIFI_EMW3080_SOCKETS_NUM)) {         // If create has succeeded and socket number is valid
+  // Socket number is allocated by the module, only new socket access has to be protected
+  rc = MX_WIFI_Socket_create(ptrMX_WIFIObject, mx_domain, mx_type, mx_protocol);
+  if ((rc >= 0) && (rc < WIFI_EMW3080_SOCKETS_NUM)) {           // If create has succeeded and socket number is valid
+    if (osMutexAcquire(mutex_id_sock[rc], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
       memset (&sock_attr[rc], 0, sizeof(sock_attr[0]));
       sock_attr[rc].type = (int8_t)type;
       sock_attr[rc].flags.created = 1U;
       sock_attr[rc].rcvtimeo = (uint32_t)WIFI_EMW3080_SOCKETS_RCVTIMEO;
 
-      // Set default receive timeout for socket to 1 ms, since blocking mode will be emulated by 
-      // periodically polling until timeout, so SPI is not blocked for long time
+      // Set default receive timeout for socket to 1 ms, blocking receive extends it 
+      // up to WIFI_EMW3080_SOCKETS_RCV_WAIT, so SPI is not blocked for long time
       val = 1;
-      (void)MX_WIFI_Socket_setsockopt(ptrMX_WIFIObject, rc, MX_SOL_SOCKET, (int32_t)MX_SO_RCVTIMEO, &val, 4);
-    } else if (rc >= WIFI_EMW3080_SOCKETS_NUM) {                // If create has succeeded but socket number is too high
-      (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc);
-      rc = ARM_SOCKET_ENOMEM;
-    } else {                                                    // If create has failed
-      rc = ConvertSocketErrorCodeMxToCmsis(rc);
-    }
+      if (MX_WIFI_Socket_setsockopt(ptrMX_WIFIObject, rc, MX_SOL_SOCKET, (int32_t)MX_SO_RCVTIMEO, &val, 4) == MX_WIFI_STATUS_OK) {
+        sock_attr[rc].rcvwait = val;
+      }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+      if (osMutexRelease(mutex_id_sock[rc]) != osOK) {
+        rc = ARM_SOCKET_ERROR;
+      }
+    } else {
+      (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc);
       rc = ARM_SOCKET_ERROR;
     }
-  } else {
-    rc = ARM_SOCKET_ERROR;
+  } else if (rc >= WIFI_EMW3080_SOCKETS_NUM) {                  // If create has succeeded but socket number is too high
+    (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc);
+    rc = ARM_SOCKET_ENOMEM;
+  } else {                                                      // If create has failed
+    rc = ConvertSocketErrorCodeMxToCmsis(rc);
   }
 
   return rc;
@@ -1131,7 +2366,7 @@ static int32_t WiFi_SocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_l
       return ARM_SOCKET_EINVAL;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status and IP
     if (sock_attr[socket].flags.created == 0U) {
@@ -1141,7 +2376,10 @@ static int32_t WiFi_SocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_l
     } else if ((sock_attr[socket].flags.bound == 1U) && 
                (memcmp(sock_attr[socket].local_ip, ip, 4) == 0)) {      // If attempt to bind to already bound address
       rc = ARM_SOCKET_EINVAL;
+    } else if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) != osOK) {
+      rc = ARM_SOCKET_ERROR;
     } else {
+      // Addresses of other sockets are checked, so binding is serialized across sockets
 
       rc = 0;
       for (int32_t i = 0; i < WIFI_EMW3080_SOCKETS_NUM; i++) {
@@ -1166,9 +2404,13 @@ static int32_t WiFi_SocketBind (int32_t socket, const uint8_t *ip, uint32_t ip_l
           rc = ConvertSocketErrorCodeMxToCmsis(rc);
         }
       }
+
+      if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+        rc = ARM_SOCKET_ERROR;
+      }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -1203,7 +2445,7 @@ static int32_t WiFi_SocketListen (int32_t socket, int32_t backlog) {
     return ARM_SOCKET_ESOCK;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket type and status
     if (sock_attr[socket].type == ARM_SOCKET_SOCK_DGRAM) {
@@ -1224,7 +2466,7 @@ static int32_t WiFi_SocketListen (int32_t socket, int32_t backlog) {
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -1268,7 +2510,7 @@ static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len,
     return ARM_SOCKET_ESOCK;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket type and status
     if (sock_attr[socket].type == ARM_SOCKET_SOCK_DGRAM) {
@@ -1279,7 +2521,7 @@ static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len,
       rc = 0;
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -1294,9 +2536,17 @@ static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len,
     }
 
     do {
-      if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
-        rc = MX_WIFI_Socket_accept(ptrMX_WIFIObject, socket, (struct mx_sockaddr *)&addr, (uint32_t *)&addr_len);
-        if ((rc >= 0) && (rc < WIFI_EMW3080_SOCKETS_NUM)) {       // If accept has succeeded and socket number is valid
+      if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+        if (sock_attr[socket].flags.accepted != 0U) {
+          // Connection already accepted by WiFi_EMW3080_SocketPoll
+          sock_attr[socket].flags.accepted = 0U;
+          rc   = sock_attr[socket].accept_sock;
+          addr = sock_attr[socket].accept_addr;
+        } else {
+          rc = MX_WIFI_Socket_accept(ptrMX_WIFIObject, socket, (struct mx_sockaddr *)&addr, (uint32_t *)&addr_len);
+        }
+        if ((rc >= 0) && (rc < WIFI_EMW3080_SOCKETS_NUM) &&       // If accept has succeeded and socket number is valid
+            (osMutexAcquire(mutex_id_sock[rc], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK)) {
           // Inherit listening socket's settings
           memset (&sock_attr[rc], 0, sizeof(sock_attr[0]));
           sock_attr[rc].ionbio   = sock_attr[socket].ionbio;
@@ -1323,14 +2573,18 @@ static int32_t WiFi_SocketAccept (int32_t socket, uint8_t *ip, uint32_t *ip_len,
               *port   = ntohs (sa->sin_port);
             }
           }
-        } else if (rc >= WIFI_EMW3080_SOCKETS_NUM) {              // If accept has succeeded but socket number is too high
+
+          if (osMutexRelease(mutex_id_sock[rc]) != osOK) {
+            rc = ARM_SOCKET_ERROR;
+          }
+        } else if (rc >= 0) {                                     // If accept has succeeded but socket cannot be used
           (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc);
           rc = ARM_SOCKET_ERROR;
         } else {                                                  // If accept has failed
           rc = 0;
         }
 
-        if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+        if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
           rc = ARM_SOCKET_ERROR;
         }
       } else {
@@ -1405,7 +2659,7 @@ static int32_t WiFi_SocketConnect (int32_t socket, const uint8_t *ip, uint32_t i
 
   rc = 0;
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -1433,7 +2687,7 @@ static int32_t WiFi_SocketConnect (int32_t socket, const uint8_t *ip, uint32_t i
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -1461,12 +2715,12 @@ static int32_t WiFi_SocketConnect (int32_t socket, const uint8_t *ip, uint32_t i
                    - ARM_SOCKET_ERROR             : Unspecified error
 */
 static int32_t WiFi_SocketRecv (int32_t socket, void *buf, uint32_t len) {
-  int32_t  rc, rc_;
-  uint32_t to;
-  uint32_t ofs = 0U;
+  int32_t  rc;
+  uint32_t to, wait, start, elapsed;
   uint32_t retry;
   uint8_t  forever = 0U;
   uint8_t  nb;
+  uint8_t  prefetch;
 
   if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
@@ -1491,35 +2745,32 @@ static int32_t WiFi_SocketRecv (int32_t socket, void *buf, uint32_t len) {
     }
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
       rc = ARM_SOCKET_ESOCK;
     } else if ((sock_attr[socket].type == ARM_SOCKET_SOCK_STREAM) && (sock_attr[socket].flags.connected == 0U)) {
       rc = ARM_SOCKET_ENOTCONN;
+    } else if ((len != 0U) && (sock_attr[socket].rx_buf_available_len != 0U)) {
+      // Serve request from data already received in local buffer
+      rc = (int32_t)RxBufRead(socket, (uint8_t *)buf, len);
+      rx_buf_stats[socket].hits++;
+      sock_stats[socket].rx_bytes += (uint32_t)rc;
     } else {
-      // Check and handle if there is data already received in local buffer (on previous call with len = 0)
-      if ((len != 0U) && (sock_attr[socket].rx_buf_available_len == 1U)) {
-        *((uint8_t *)buf) = sock_attr[socket].rx_buf[0];
-        sock_attr[socket].rx_buf_available_len = 0U;
-        ofs = 1U;
-        rc = 1;
-      } else {
-        ofs = 0U;
-        rc = 0;
-      }
+      rc = 0;
+      rx_buf_stats[socket].misses++;
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
     rc = ARM_SOCKET_ERROR;
   }
 
-  if ((rc == 0) || ((rc == 1) && (len > 1))) {
-    if (sock_attr[socket].ionbio == 0U) {       // If socket is in blocking mode (emulate by polling until timeout)
+  if (rc == 0) {
+    if (sock_attr[socket].ionbio == 0U) {       // If socket is in blocking mode (module waits for data until timeout)
       nb = 0U;
       to = sock_attr[socket].rcvtimeo;
       if (to == 0U) {
@@ -1532,53 +2783,68 @@ static int32_t WiFi_SocketRecv (int32_t socket, void *buf, uint32_t len) {
       to = 0U;
     }
 
+    // Receive into local buffer when checking for data or when stream data is requested 
+    // in chunks smaller than local buffer, otherwise receive directly into user buffer
+    if ((len == 0U) || ((sock_attr[socket].type == ARM_SOCKET_SOCK_STREAM) && (len < (uint32_t)WIFI_EMW3080_SOCKETS_RX_BUF_SIZE))) {
+      prefetch = 1U;
+    } else {
+      prefetch = 0U;
+    }
+
     retry = (uint32_t)WIFI_EMW3080_SOCKETS_RCV_RETRIES;
     do {
-      if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
-        if (len == 0U) {                        // if len = 0, try to receive 1 byte to local buffer
-          rc = MX_WIFI_Socket_recv(ptrMX_WIFIObject, socket, (uint8_t *)sock_attr[socket].rx_buf, 1, 0);
-          if (rc > 0) {                         // If 1 byte was received
+      if (nb == 0U) {                           // Module returns as soon as data arrives or wait expires
+        if ((forever != 0U) || (to > (uint32_t)WIFI_EMW3080_SOCKETS_RCV_WAIT)) {
+          wait = (uint32_t)WIFI_EMW3080_SOCKETS_RCV_WAIT;
+        } else {
+          wait = to;
+        }
+      } else {
+        wait = 1U;
+      }
+      start = osKernelGetTickCount();
+
+      if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+        SetModuleRcvWait(socket, wait);
+        if (prefetch != 0U) {                   // Receive as much as available into local buffer
+          rc = MX_WIFI_Socket_recv(ptrMX_WIFIObject, socket, (uint8_t *)sock_attr[socket].rx_buf, WIFI_EMW3080_SOCKETS_RX_BUF_SIZE, 0);
+          if (rc > 0) {
+            sock_attr[socket].rx_buf_ofs           = 0U;
             sock_attr[socket].rx_buf_available_len = (uint16_t)rc;
-          } else {
-            if (retry > 0U) {
-              retry = retry - 1U;
-              rc = 0;
-            } else {
-              rc = ConvertSocketErrorCodeMxToCmsis(rc);
+            if (len != 0U) {
+              rc = (int32_t)RxBufRead(socket, (uint8_t *)buf, len);
             }
           }
-        } else {                                // if len != 0, try to receive into buffer provided as function parameter
-          rc_ = MX_WIFI_Socket_recv(ptrMX_WIFIObject, socket, ((uint8_t *)buf)+ofs, (int32_t)(len-ofs), 0);
-          if (rc_ > 0) {
-            rc += rc_;
+        } else {                                // Receive directly into buffer provided as function parameter
+          rc = MX_WIFI_Socket_recv(ptrMX_WIFIObject, socket, (uint8_t *)buf, (int32_t)len, 0);
+        }
+        if (rc < 0) {
+          if (retry > 0U) {
+            retry = retry - 1U;
+            rc = 0;
           } else {
-            rc = rc_;
-          }
-          if (rc < 0) {
-            if (retry > 0U) {
-              retry = retry - 1U;
-              rc = 0;
-            } else {
-              rc = ConvertSocketErrorCodeMxToCmsis(rc);
-            }
+            rc = ConvertSocketErrorCodeMxToCmsis(rc);
           }
+        } else if ((rc > 0) && (len != 0U)) {
+          sock_stats[socket].rx_bytes += (uint32_t)rc;
         }
 
-        if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+        if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
           rc = ARM_SOCKET_ERROR;
         }
       } else {
         rc = ARM_SOCKET_ERROR;
       }
 
-      if (rc == 0) {
-        if ((to >=  (uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL) || (forever != 0U)) {
-          (void)osDelay((uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL);
-          if (to >= (uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL) {
-            to -=   (uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL;
-          }
+      if ((rc == 0) && (nb == 0U)) {
+        elapsed = osKernelGetTickCount() - start;
+        if (elapsed < wait) {                   // If module returned before wait expired without data
+          (void)osDelay(wait - elapsed);
+          elapsed = wait;
+        }
+        if (to > elapsed) {
+          to -= elapsed;
         } else {
-          (void)osDelay(to);
           to = 0U;
         }
       }
@@ -1620,7 +2886,7 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
   SOCKADDR_STORAGE addr;
   int32_t  addr_len = (int32_t)sizeof(addr);
   int32_t  rc;
-  uint32_t to;
+  uint32_t to, wait, start, elapsed;
   uint32_t len_to_copy;
   uint8_t  forever = 0U;
   uint8_t  nb;
@@ -1648,7 +2914,7 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
     }
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -1658,12 +2924,8 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
     } else {
       // Check and handle if data was already received in local buffer (on previous call with len = 0)
       if ((len != 0U) && (sock_attr[socket].rx_buf_available_len != 0U)) {
-        len_to_copy = len;
-        if (len_to_copy > sock_attr[socket].rx_buf_available_len) {
-          len_to_copy = sock_attr[socket].rx_buf_available_len;
-        }
-        memcpy(buf, sock_attr[socket].rx_buf, len_to_copy);
-        sock_attr[socket].rx_buf_available_len = 0U;
+        len_to_copy = RxBufRead(socket, (uint8_t *)buf, len);
+        rx_buf_stats[socket].hits++;
         if ((ip != NULL) && (ip_len != NULL)) {
           memcpy(ip, sock_attr[socket].rx_ip, 4);
           *ip_len = 4;
@@ -1672,12 +2934,14 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
           *port   = sock_attr[socket].rx_port;
         }
         rc = (int32_t)len_to_copy;
+        sock_stats[socket].rx_bytes += (uint32_t)rc;
       } else {
         rc = 0;
+        rx_buf_stats[socket].misses++;
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -1685,7 +2949,7 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
   }
 
   if (rc == 0) {
-    if (sock_attr[socket].ionbio == 0U) {       // If socket is in blocking mode (emulate by polling until timeout)
+    if (sock_attr[socket].ionbio == 0U) {       // If socket is in blocking mode (module waits for data until timeout)
       nb = 0U;
       to = sock_attr[socket].rcvtimeo;
       if (to == 0U) {
@@ -1699,11 +2963,24 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
     }
 
     do {
-      if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+      if (nb == 0U) {                           // Module returns as soon as data arrives or wait expires
+        if ((forever != 0U) || (to > (uint32_t)WIFI_EMW3080_SOCKETS_RCV_WAIT)) {
+          wait = (uint32_t)WIFI_EMW3080_SOCKETS_RCV_WAIT;
+        } else {
+          wait = to;
+        }
+      } else {
+        wait = 1U;
+      }
+      start = osKernelGetTickCount();
+
+      if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+        SetModuleRcvWait(socket, wait);
         if (len == 0U) {                        // if len = 0, try to receive to local buffer
           rc = MX_WIFI_Socket_recvfrom(ptrMX_WIFIObject, socket, (uint8_t *)sock_attr[socket].rx_buf, WIFI_EMW3080_SOCKETS_RX_BUF_SIZE, 0, (struct mx_sockaddr *)&addr, (uint32_t *)&addr_len);
           if (rc > 0) {                         // If something was received
             // Store remote IP address and port, data is received int local buffer
+            sock_attr[socket].rx_buf_ofs           = 0U;
             sock_attr[socket].rx_buf_available_len = (uint16_t)rc;
             const SOCKADDR_IN *sa = (SOCKADDR_IN *)&addr;
             if ((sa->sin_family == (uint8_t)MX_AF_INET) && (sizeof(sa->sin_addr) >= 4U)) {
@@ -1716,6 +2993,7 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
         } else {                                // if len != 0, try to receive into buffer provided as function parameter
           rc = MX_WIFI_Socket_recvfrom(ptrMX_WIFIObject, socket, (uint8_t *)buf, (int32_t)len, 0, (struct mx_sockaddr *)&addr, (uint32_t *)&addr_len);
           if (rc > 0) {                         // If something was received
+            sock_stats[socket].rx_bytes += (uint32_t)rc;
             // Store remote IP address and port, data is already in buffer
             if ((ip != NULL) && (ip_len != NULL)) {
               const SOCKADDR_IN *sa = (SOCKADDR_IN *)&addr;
@@ -1732,21 +3010,22 @@ static int32_t WiFi_SocketRecvFrom (int32_t socket, void *buf, uint32_t len, uin
           }
         }
 
-        if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+        if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
           rc = ARM_SOCKET_ERROR;
         }
       } else {
         rc = ARM_SOCKET_ERROR;
       }
 
-      if (rc == 0) {
-        if ((to >=  (uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL) || (forever != 0U)) {
-          (void)osDelay((uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL);
-          if (to >= (uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL) {
-            to -=   (uint32_t)WIFI_EMW3080_SOCKETS_INTERVAL;
-          }
+      if ((rc == 0) && (nb == 0U)) {
+        elapsed = osKernelGetTickCount() - start;
+        if (elapsed < wait) {                   // If module returned before wait expired without data
+          (void)osDelay(wait - elapsed);
+          elapsed = wait;
+        }
+        if (to > elapsed) {
+          to -= elapsed;
         } else {
-          (void)osDelay(to);
           to = 0U;
         }
       }
@@ -1798,7 +3077,7 @@ static int32_t WiFi_SocketSend (int32_t socket, const void *buf, uint32_t len) {
     return 0;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -1807,21 +3086,31 @@ static int32_t WiFi_SocketSend (int32_t socket, const void *buf, uint32_t len) {
       rc = ARM_SOCKET_ENOTCONN;
     } else {
 
-      for (retry = 3U; retry != 0U; retry--) {
-        rc = MX_WIFI_Socket_send(ptrMX_WIFIObject, socket, (uint8_t *)buf, (int32_t)len, 0);
-        if (rc > 0) {
-          break;
+      if ((sock_attr[socket].type   == ARM_SOCKET_SOCK_STREAM) &&
+          (sock_attr[socket].ionbio == 0U) && (sock_attr[socket].sndtimeo == 0U)) {
+        // Blocking stream socket sends all data or fails, so large data can be sent
+        // in several fragments at once instead of one module request at a time.
+        // Not retried: fragments after a failed one may already be sent.
+        rc = MX_WIFI_Socket_send_stream(ptrMX_WIFIObject, socket, (const uint8_t *)buf, (int32_t)len, 0);
+      } else {
+        for (retry = 3U; retry != 0U; retry--) {
+          rc = MX_WIFI_Socket_send(ptrMX_WIFIObject, socket, (const uint8_t *)buf, (int32_t)len, 0);
+          if (rc > 0) {
+            break;
+          }
+          (void)osDelay(10U);
         }
-        (void)osDelay(10U);
       }
       if (rc < 0) {
         sock_attr[socket].flags.connecting = 0U;
         sock_attr[socket].flags.connected  = 0U;
         rc = ARM_SOCKET_ECONNRESET;
+      } else {
+        sock_stats[socket].tx_bytes += (uint32_t)rc;
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -1892,7 +3181,7 @@ static int32_t WiFi_SocketSendTo (int32_t socket, const void *buf, uint32_t len,
     addr_len = 0;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -1910,10 +3199,12 @@ static int32_t WiFi_SocketSendTo (int32_t socket, const void *buf, uint32_t len,
         sock_attr[socket].flags.connecting = 0U;
         sock_attr[socket].flags.connected  = 0U;
         rc = ARM_SOCKET_ECONNRESET;
+      } else {
+        sock_stats[socket].tx_bytes += (uint32_t)rc;
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -1952,7 +3243,7 @@ static int32_t WiFi_SocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip
     return ARM_SOCKET_ESOCK;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -1983,7 +3274,7 @@ static int32_t WiFi_SocketGetSockName (int32_t socket, uint8_t *ip, uint32_t *ip
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -2023,7 +3314,7 @@ static int32_t WiFi_SocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip
     return ARM_SOCKET_ESOCK;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -2052,7 +3343,7 @@ static int32_t WiFi_SocketGetPeerName (int32_t socket, uint8_t *ip, uint32_t *ip
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -2101,7 +3392,7 @@ static int32_t WiFi_SocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val,
     len = 4U;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -2148,7 +3439,7 @@ static int32_t WiFi_SocketGetOpt (int32_t socket, int32_t opt_id, void *opt_val,
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -2187,7 +3478,7 @@ static int32_t WiFi_SocketSetOpt (int32_t socket, int32_t opt_id, const void *op
     return ARM_SOCKET_EINVAL;
   }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
 
     // Check socket status
     if (sock_attr[socket].flags.created == 0U) {
@@ -2229,7 +3520,58 @@ static int32_t WiFi_SocketSetOpt (int32_t socket, int32_t opt_id, const void *op
       }
     }
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
+      rc = ARM_SOCKET_ERROR;
+    }
+  } else {
+    rc = ARM_SOCKET_ERROR;
+  }
+
+  return rc;
+}
+
+/**
+  \fn            int32_t WiFi_SocketClose (int32_t socket)
+  \brief         Close and release a socket.
+  \param[in]     socket   Socket identification number
+  \return        status information
+                   - 0                            : Operation successful
+                   - ARM_SOCKET_ESOCK             : Invalid socket
+                   - ARM_SOCKET_EAGAIN            : Operation would block (may be called again)
+                   - ARM_SOCKET_ERROR             : Unspecified error
+*/
+static int32_t WiFi_SocketClose (int32_t socket) {
+  int32_t rc;
+
+  if (driver_initialized == 0U) {
+    return ARM_SOCKET_ERROR;
+  }
+
+  // Check parameters
+  if ((socket < 0) || (socket >= WIFI_EMW3080_SOCKETS_NUM)) {
+    return ARM_SOCKET_ESOCK;
+  }
+
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+
+    // Check socket status
+    if (sock_attr[socket].flags.created == 0U) {
+      rc = ARM_SOCKET_ESOCK;
+    } else {
+      if (sock_attr[socket].flags.accepted != 0U) {
+        // Connection accepted by WiFi_EMW3080_SocketPoll and never taken
+        (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, sock_attr[socket].accept_sock);
+        sock_attr[socket].flags.accepted = 0U;
+      }
+      rc = MX_WIFI_Socket_close(ptrMX_WIFIObject, socket);
+      if (rc == 0) {                                              // If close has succeeded
+        memset (&sock_attr[socket], 0, sizeof(sock_attr[0]));
+      } else if (rc < 0) {                                        // If close has failed
+        rc = ConvertSocketErrorCodeMxToCmsis(rc);
+      }
+    }
+
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -2240,16 +3582,181 @@ static int32_t WiFi_SocketSetOpt (int32_t socket, int32_t opt_id, const void *op
 }
 
 /**
-  \fn            int32_t WiFi_SocketClose (int32_t socket)
-  \brief         Close and release a socket.
+  \fn            int32_t WiFi_SocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len)
+  \brief         Retrieve host IP address from host name.
+  \param[in]     name     Host name
+  \param[in]     af       Address family
+  \param[out]    ip       Pointer to buffer where resolved IP address shall be returned
+  \param[in,out] ip_len   Pointer to length of 'ip'
+                   - length of supplied 'ip' on input
+                   - length of stored 'ip' on output
+  \return        status information
+                   - 0                            : Operation successful
+                   - ARM_SOCKET_EINVAL            : Invalid argument
+                   - ARM_SOCKET_ENOTSUP           : Operation not supported
+                   - ARM_SOCKET_ETIMEDOUT         : Operation timed out
+                   - ARM_SOCKET_EHOSTNOTFOUND     : Host not found
+                   - ARM_SOCKET_ERROR             : Unspecified error
+*/
+static int32_t WiFi_SocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len) {
+#if (DNS_CACHE_ENABLED == 1)
+  uint32_t age;
+  int32_t  idx;
+  uint8_t  cacheable;
+#else
+  SOCKADDR_STORAGE addr;
+#endif
+  int32_t  rc;
+
+  if (driver_initialized == 0U) {
+    return ARM_SOCKET_ERROR;
+  }
+
+  // Check parameters
+  if ((name == NULL) || (ip == NULL) || (ip_len == NULL)) {
+    return ARM_SOCKET_EINVAL;
+  }
+  switch (af) {
+    case ARM_SOCKET_AF_INET:
+      if (*ip_len < 4U) {
+        return ARM_SOCKET_EINVAL;
+      }
+      break;
+    default:
+      return ARM_SOCKET_EINVAL;
+  }
+
+#if (DNS_CACHE_ENABLED == 1)
+  cacheable = (strlen(name) < WIFI_EMW3080_DNS_CACHE_NAME_LEN) ? 1U : 0U;
+
+  // Look up host name in the cache
+  if ((cacheable != 0U) && (osMutexAcquire(mutex_id_dns, osWaitForever) == osOK)) {
+    rc  = 1;                            // Not served from the cache
+    idx = DnsCacheFind(name);
+    if (idx >= 0) {
+      age = osKernelGetTickCount() - dns_cache[idx].time;
+      if (dns_cache[idx].found != 0U) {
+        if (age < (uint32_t)(2 * WIFI_EMW3080_DNS_CACHE_TTL)) {
+          memcpy(ip, dns_cache[idx].ip, 4U);
+          *ip_len = 4U;
+          rc = 0;
+          if (age < (uint32_t)WIFI_EMW3080_DNS_CACHE_TTL) {
+            dns_cache_stats.hits++;
+          } else {
+            // Expired entry is used while it is being refreshed in the background
+            dns_cache_stats.stale_hits++;
+            if (dns_cache[idx].refresh == 0U) {
+              dns_cache[idx].refresh = 1U;
+              (void)osThreadFlagsSet(thread_id_dns, DNS_FLAG_REFRESH);
+            }
+          }
+        }
+      } else {
+        if (age < (uint32_t)WIFI_EMW3080_DNS_CACHE_NEG_TTL) {
+          dns_cache_stats.negative_hits++;
+          rc = ARM_SOCKET_EHOSTNOTFOUND;
+        }
+      }
+      if (rc <= 0) {
+        dns_cache[idx].used = ++dns_cache_seq;
+      }
+    }
+    if (rc > 0) {
+      dns_cache_stats.misses++;
+    }
+    (void)osMutexRelease(mutex_id_dns);
+    if (rc <= 0) {
+      return rc;
+    }
+  }
+
+  // Resolve hostname
+  rc = DnsResolve(name, ip);
+
+  // Cache resolved address or host not found result
+  if ((cacheable != 0U) && ((rc == 0) || (rc == ARM_SOCKET_EHOSTNOTFOUND))) {
+    if (osMutexAcquire(mutex_id_dns, osWaitForever) == osOK) {
+      DnsCacheStore(name, ip, (rc == 0) ? 1U : 0U);
+      (void)osMutexRelease(mutex_id_dns);
+    }
+  }
+
+  if (rc == 0) {
+    *ip_len = 4U;
+  }
+
+  return rc;
+#else
+  // Resolve hostname
+  rc = MX_WIFI_Socket_gethostbyname(ptrMX_WIFIObject, (struct mx_sockaddr *)&addr, (char *)name);
+  if (rc < 0) {
+    if (rc == MX_WIFI_STATUS_ERROR) {
+      // Consider MX_WIFI_STATUS_ERROR means that host was not found
+      return ARM_SOCKET_EHOSTNOTFOUND;
+    } else {
+      rc = ConvertSocketErrorCodeMxToCmsis(rc);
+      return rc;
+    }
+  }
+
+  // Copy resolved IP address
+  if (addr.ss_family == (uint8_t)MX_AF_INET) {
+    const SOCKADDR_IN *sa = (SOCKADDR_IN *)&addr;
+    if (*ip_len >= sizeof(sa->sin_addr)) {
+      memcpy(ip, &sa->sin_addr, sizeof(sa->sin_addr));
+      *ip_len = sizeof(sa->sin_addr);
+    }
+  }
+
+  return 0;
+#endif
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_GetHostByNameCacheStats (WiFi_EMW3080_DnsCacheStats_t *stats)
+  \brief         Retrieve host name cache statistics.
+  \param[out]    stats    Pointer to structure where statistics shall be returned
+  \return        status information
+                   - 0                            : Operation successful
+                   - ARM_SOCKET_EINVAL            : Invalid argument
+                   - ARM_SOCKET_ENOTSUP           : Operation not supported (host name cache disabled)
+                   - ARM_SOCKET_ERROR             : Unspecified error
+*/
+int32_t WiFi_EMW3080_GetHostByNameCacheStats (WiFi_EMW3080_DnsCacheStats_t *stats) {
+
+  if (driver_initialized == 0U) {
+    return ARM_SOCKET_ERROR;
+  }
+  if (stats == NULL) {
+    return ARM_SOCKET_EINVAL;
+  }
+
+#if (DNS_CACHE_ENABLED == 1)
+  if (osMutexAcquire(mutex_id_dns, osWaitForever) != osOK) {
+    return ARM_SOCKET_ERROR;
+  }
+  *stats = dns_cache_stats;
+  (void)osMutexRelease(mutex_id_dns);
+
+  return 0;
+#else
+  return ARM_SOCKET_ENOTSUP;
+#endif
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_SocketGetRxBufStats (int32_t socket, WiFi_EMW3080_SocketRxBufStats_t *stats)
+  \brief         Get socket local receive buffer statistics.
+  \detail        Statistics are accumulated per socket number since driver initialization.
   \param[in]     socket   Socket identification number
+  \param[out]    stats    Pointer to structure where statistics shall be returned
   \return        status information
                    - 0                            : Operation successful
                    - ARM_SOCKET_ESOCK             : Invalid socket
-                   - ARM_SOCKET_EAGAIN            : Operation would block (may be called again)
+                   - ARM_SOCKET_EINVAL            : Invalid argument (pointer to structure)
                    - ARM_SOCKET_ERROR             : Unspecified error
 */
-static int32_t WiFi_SocketClose (int32_t socket) {
+int32_t WiFi_EMW3080_SocketGetRxBufStats (int32_t socket, WiFi_EMW3080_SocketRxBufStats_t *stats) {
   int32_t rc;
 
   if (driver_initialized == 0U) {
@@ -2260,22 +3767,15 @@ static int32_t WiFi_SocketClose (int32_t socket) {
   if ((socket < 0) || (socket >= WIFI_EMW3080_SOCKETS_NUM)) {
     return ARM_SOCKET_ESOCK;
   }
+  if (stats == NULL) {
+    return ARM_SOCKET_EINVAL;
+  }
 
-  if (osMutexAcquire(mutex_id_sock_attr, WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
-
-    // Check socket status
-    if (sock_attr[socket].flags.created == 0U) {
-      rc = ARM_SOCKET_ESOCK;
-    } else {
-      rc = MX_WIFI_Socket_close(ptrMX_WIFIObject, socket);
-      if (rc == 0) {                                              // If close has succeeded
-        memset (&sock_attr[socket], 0, sizeof(sock_attr[0]));
-      } else if (rc < 0) {                                        // If close has failed
-        rc = ConvertSocketErrorCodeMxToCmsis(rc);
-      }
-    }
+  if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+    *stats = rx_buf_stats[socket];
+    rc = 0;
 
-    if (osMutexRelease(mutex_id_sock_attr) != osOK) {
+    if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
       rc = ARM_SOCKET_ERROR;
     }
   } else {
@@ -2286,66 +3786,171 @@ static int32_t WiFi_SocketClose (int32_t socket) {
 }
 
 /**
-  \fn            int32_t WiFi_SocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len)
-  \brief         Retrieve host IP address from host name.
-  \param[in]     name     Host name
-  \param[in]     af       Address family
-  \param[out]    ip       Pointer to buffer where resolved IP address shall be returned
-  \param[in,out] ip_len   Pointer to length of 'ip'
-                   - length of supplied 'ip' on input
-                   - length of stored 'ip' on output
+  \fn            int32_t WiFi_EMW3080_SocketPoll (WiFi_EMW3080_SocketPollFd_t *fds, uint32_t nfds, uint32_t timeout)
+  \brief         Poll multiple sockets for events by probing them one after the other.
+  \detail        The module provides no socket select, so this is not an event wait: 
+                 data already received into local receive buffer is reported without a module request, 
+                 other sockets are probed by receiving into their local receive buffer and listening 
+                 sockets by accepting a connection, which is then returned by the next WiFi_SocketAccept. 
+                 Probes are done with only the socket access protection mutex acquired.
+  \param[in,out] fds      Array of structures specifying sockets, requested and returned events
+  \param[in]     nfds     Number of entries in 'fds' array
+  \param[in]     timeout  Timeout in milliseconds (0 = return immediately, osWaitForever = wait forever)
   \return        status information
-                   - 0                            : Operation successful
-                   - ARM_SOCKET_EINVAL            : Invalid argument
-                   - ARM_SOCKET_ENOTSUP           : Operation not supported
-                   - ARM_SOCKET_ETIMEDOUT         : Operation timed out
-                   - ARM_SOCKET_EHOSTNOTFOUND     : Host not found
+                   - number of sockets with returned events (>=0), 0 if timeout expired
+                   - ARM_SOCKET_ESOCK             : Invalid socket
+                   - ARM_SOCKET_EINVAL            : Invalid argument (pointer to array or number of entries)
                    - ARM_SOCKET_ERROR             : Unspecified error
 */
-static int32_t WiFi_SocketGetHostByName (const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len) {
-  SOCKADDR_STORAGE addr;
-  int32_t rc;
+int32_t WiFi_EMW3080_SocketPoll (WiFi_EMW3080_SocketPollFd_t *fds, uint32_t nfds, uint32_t timeout) {
+  int32_t  rc, rc_mx, socket, addr_len;
+  uint32_t i, to, wait, probe_wait, start, elapsed;
+  uint32_t probe, probe_num;
+  uint8_t  forever;
 
   if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
   }
 
   // Check parameters
-  if ((name == NULL) || (ip == NULL) || (ip_len == NULL)) {
+  if ((fds == NULL) || (nfds == 0U) || (nfds > (uint32_t)WIFI_EMW3080_SOCKETS_NUM)) {
     return ARM_SOCKET_EINVAL;
   }
-  switch (af) {
-    case ARM_SOCKET_AF_INET:
-      if (*ip_len < 4U) {
-        return ARM_SOCKET_EINVAL;
-      }
-      break;
-    default:
-      return ARM_SOCKET_EINVAL;
+  for (i = 0U; i < nfds; i++) {
+    if ((fds[i].socket < 0) || (fds[i].socket >= WIFI_EMW3080_SOCKETS_NUM)) {
+      return ARM_SOCKET_ESOCK;
+    }
+    fds[i].revents = 0U;
   }
 
-  // Resolve hostname
-  rc = MX_WIFI_Socket_gethostbyname(ptrMX_WIFIObject, (struct mx_sockaddr *)&addr, (char *)name);
-  if (rc < 0) {
-    if (rc == MX_WIFI_STATUS_ERROR) {
-      // Consider MX_WIFI_STATUS_ERROR means that host was not found
-      return ARM_SOCKET_EHOSTNOTFOUND;
+  if (timeout == osWaitForever) {
+    forever = 1U;
+    to      = 0U;
+  } else {
+    forever = 0U;
+    to      = timeout;
+  }
+
+  do {
+    if ((forever != 0U) || (to > (uint32_t)WIFI_EMW3080_SOCKETS_RCV_WAIT)) {
+      wait = (uint32_t)WIFI_EMW3080_SOCKETS_RCV_WAIT;
     } else {
-      rc = ConvertSocketErrorCodeMxToCmsis(rc);
-      return rc;
+      wait = to;
     }
-  }
+    start     = osKernelGetTickCount();
+    probe     = 0U;
+    probe_num = 0U;
 
-  // Copy resolved IP address
-  if (addr.ss_family == (uint8_t)MX_AF_INET) {
-    const SOCKADDR_IN *sa = (SOCKADDR_IN *)&addr;
-    if (*ip_len >= sizeof(sa->sin_addr)) {
-      memcpy(ip, &sa->sin_addr, sizeof(sa->sin_addr));
-      *ip_len = sizeof(sa->sin_addr);
+    rc = 0;
+
+    // Check socket status and data in local receive buffer (attributes are only read without
+    // socket mutexes, so blocking operations do not delay polling, probes check them again)
+    for (i = 0U; i < nfds; i++) {
+      socket = fds[i].socket;
+      if (sock_attr[socket].flags.created == 0U) {
+        fds[i].revents = WIFI_EMW3080_POLLERR;
+      } else if (sock_attr[socket].flags.listening != 0U) {
+        if ((fds[i].events & WIFI_EMW3080_POLLIN) != 0U) {
+          if (sock_attr[socket].flags.accepted != 0U) {
+            fds[i].revents |= WIFI_EMW3080_POLLIN;
+          } else {
+            probe |= (1UL << i);
+            probe_num++;
+          }
+        }
+      } else if ((sock_attr[socket].type == ARM_SOCKET_SOCK_STREAM) && (sock_attr[socket].flags.connected == 0U)) {
+        // Not connected stream socket has no event
+      } else {
+        if ((fds[i].events & WIFI_EMW3080_POLLIN) != 0U) {
+          if (sock_attr[socket].rx_buf_available_len != 0U) {
+            fds[i].revents |= WIFI_EMW3080_POLLIN;
+          } else {
+            probe |= (1UL << i);
+            probe_num++;
+          }
+        }
+        if ((fds[i].events & WIFI_EMW3080_POLLOUT) != 0U) {
+          fds[i].revents |= WIFI_EMW3080_POLLOUT;
+        }
+      }
+      if (fds[i].revents != 0U) {
+        rc++;
+      }
     }
-  }
 
-  return 0;
+    // Probe the other sockets, the wait is shared between the receive probes
+    if ((rc == 0) && (probe_num != 0U)) {
+      probe_wait = wait / probe_num;
+      if (probe_wait == 0U) {
+        probe_wait = 1U;
+      }
+      for (i = 0U; i < nfds; i++) {
+        if ((probe & (1UL << i)) == 0U) {
+          continue;
+        }
+        socket = fds[i].socket;
+        if (osMutexAcquire(mutex_id_sock[socket], WIFI_EMW3080_SOCKETS_TIMEOUT) == osOK) {
+          if (sock_attr[socket].flags.created == 0U) {
+            fds[i].revents |= WIFI_EMW3080_POLLERR;
+          } else if (sock_attr[socket].flags.listening != 0U) {
+            if (sock_attr[socket].flags.accepted == 0U) {
+              // Accept probe, the module returns at once if no connection is pending
+              addr_len = (int32_t)sizeof(sock_attr[socket].accept_addr);
+              rc_mx = MX_WIFI_Socket_accept(ptrMX_WIFIObject, socket, (struct mx_sockaddr *)&sock_attr[socket].accept_addr, (uint32_t *)&addr_len);
+              if ((rc_mx >= 0) && (rc_mx < WIFI_EMW3080_SOCKETS_NUM)) {
+                sock_attr[socket].accept_sock    = rc_mx;
+                sock_attr[socket].flags.accepted = 1U;
+              } else if (rc_mx >= 0) {
+                // Accepted socket cannot be used
+                (void)MX_WIFI_Socket_close(ptrMX_WIFIObject, rc_mx);
+              } else {
+                // No connection pending
+              }
+            }
+            if (sock_attr[socket].flags.accepted != 0U) {
+              fds[i].revents |= WIFI_EMW3080_POLLIN;
+            }
+          } else if (sock_attr[socket].rx_buf_available_len != 0U) {
+            // Data received meanwhile by a receive call
+            fds[i].revents |= WIFI_EMW3080_POLLIN;
+          } else {
+            SetModuleRcvWait(socket, probe_wait);
+            rc_mx = RxBufFill(socket);
+            if (rc_mx > 0) {
+              fds[i].revents |= WIFI_EMW3080_POLLIN;
+            } else if (rc_mx < 0) {
+              fds[i].revents |= WIFI_EMW3080_POLLERR;
+            } else {
+              // No data received
+            }
+          }
+          if (osMutexRelease(mutex_id_sock[socket]) != osOK) {
+            rc = ARM_SOCKET_ERROR;
+            break;
+          }
+        }
+        if (fds[i].revents != 0U) {
+          rc++;
+        }
+      }
+    }
+
+    if (rc == 0) {
+      elapsed = osKernelGetTickCount() - start;
+      if ((elapsed < wait) && ((forever != 0U) || (to > elapsed))) {
+        // If module returned before wait expired without events
+        (void)osDelay(wait - elapsed);
+        elapsed = wait;
+      }
+      if (to > elapsed) {
+        to -= elapsed;
+      } else {
+        to = 0U;
+      }
+    }
+  } while (((to != 0U) || (forever != 0U)) && (rc == 0));
+
+  return rc;
 }
 
 /**
@@ -2361,9 +3966,7 @@ static int32_t WiFi_SocketGetHostByName (const char *name, int32_t af, uint8_t *
                    - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (NULL ip pointer or ip_len different than 4 or 16)
 */
 static int32_t WiFi_Ping (const uint8_t *ip, uint32_t ip_len) {
-  char str_addr[16];
-  int32_t response_time;
-  int32_t rc, str_rc;
+  WiFi_EMW3080_PingStats_t stats;
 
   if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
@@ -2374,15 +3977,318 @@ static int32_t WiFi_Ping (const uint8_t *ip, uint32_t ip_len) {
     return ARM_DRIVER_ERROR_PARAMETER;
   }
 
-  str_rc = snprintf(str_addr, 16, "%i.%i.%i.%i", ip[0], ip[1], ip[2], ip[3]);
-  if ((str_rc < 0) || (str_rc > 15)) {
+  return PingRun(ip, 1U, 0U, &stats);
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_Ping (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval, WiFi_EMW3080_PingStats_t *stats)
+  \brief         Probe remote host with multiple Ping probes and return round trip time statistics.
+  \detail        All probes are sent by the module within a single request, which does not block
+                 other module requests while waiting for the answers.
+  \param[in]     ip       Pointer to remote host IP address
+  \param[in]     ip_len   Length of 'ip' address in bytes
+  \param[in]     count    Number of probes (1 .. WIFI_EMW3080_PING_COUNT_MAX)
+  \param[in]     interval Interval between probes (0 .. WIFI_EMW3080_PING_INTERVAL_MAX ms)
+  \param[out]    stats    Pointer to structure where round trip time statistics are returned
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful (at least one probe answered)
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_TIMEOUT     : Timeout occurred (no probe answered)
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (NULL ip or stats pointer, ip_len different than 4,
+                                                    invalid count or interval)
+*/
+int32_t WiFi_EMW3080_Ping (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval, WiFi_EMW3080_PingStats_t *stats) {
+
+  // Check parameters
+  if ((ip == NULL) || (ip_len != 4U) || (stats == NULL) ||
+      (count == 0U) || (count > WIFI_EMW3080_PING_COUNT_MAX) || (interval > WIFI_EMW3080_PING_INTERVAL_MAX)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  return PingRun(ip, count, interval, stats);
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_PingStart (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval)
+  \brief         Start probing remote host with multiple Ping probes, without waiting for the answers.
+  \detail        Completion is signaled with WIFI_EMW3080_EVENT_PING_DONE event, with the round trip time statistics.
+  \param[in]     ip       Pointer to remote host IP address
+  \param[in]     ip_len   Length of 'ip' address in bytes
+  \param[in]     count    Number of probes (1 .. WIFI_EMW3080_PING_COUNT_MAX)
+  \param[in]     interval Interval between probes (0 .. WIFI_EMW3080_PING_INTERVAL_MAX ms)
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful (ping started)
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_BUSY        : Ping started earlier is not completed yet
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (NULL ip pointer, ip_len different than 4,
+                                                    invalid count or interval)
+*/
+int32_t WiFi_EMW3080_PingStart (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval) {
+  int32_t ret;
+
+  // Check parameters
+  if ((ip == NULL) || (ip_len != 4U) ||
+      (count == 0U) || (count > WIFI_EMW3080_PING_COUNT_MAX) || (interval > WIFI_EMW3080_PING_INTERVAL_MAX)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (osMutexAcquire(mutex_id_ping, osWaitForever) != osOK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (ping_busy != 0U) {
+    ret = ARM_DRIVER_ERROR_BUSY;
+  } else {
+    memcpy(ping_ip, ip, 4U);
+    ping_count    = count;
+    ping_interval = interval;
+    ping_busy     = 1U;
+    ret = ARM_DRIVER_OK;
+    if ((osThreadFlagsSet(thread_id_ping, PING_FLAG_START) & osFlagsError) != 0U) {
+      ping_busy = 0U;
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  (void)osMutexRelease(mutex_id_ping);
+
+  return ret;
+}
+
+#else // (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+
+// Socket interface is not available in bypass mode
+
+int32_t WiFi_EMW3080_SocketGetRxBufStats (int32_t socket, WiFi_EMW3080_SocketRxBufStats_t *stats) {
+  (void)socket;
+  (void)stats;
+
+  return ARM_SOCKET_ENOTSUP;
+}
+
+int32_t WiFi_EMW3080_SocketPoll (WiFi_EMW3080_SocketPollFd_t *fds, uint32_t nfds, uint32_t timeout) {
+  (void)fds;
+  (void)nfds;
+  (void)timeout;
+
+  return ARM_SOCKET_ENOTSUP;
+}
+
+int32_t WiFi_EMW3080_GetHostByNameCacheStats (WiFi_EMW3080_DnsCacheStats_t *stats) {
+  (void)stats;
+
+  return ARM_SOCKET_ENOTSUP;
+}
+
+int32_t WiFi_EMW3080_Ping (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval, WiFi_EMW3080_PingStats_t *stats) {
+  (void)ip;
+  (void)ip_len;
+  (void)count;
+  (void)interval;
+  (void)stats;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+int32_t WiFi_EMW3080_PingStart (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval) {
+  (void)ip;
+  (void)ip_len;
+  (void)count;
+  (void)interval;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+#endif
+
+#if (SCAN_CACHE_ENABLED == 1)
+/**
+  \fn            int32_t WiFi_EMW3080_ScanStart (const char *ssid)
+  \brief         Start scan for networks in range, without waiting for the scan to complete.
+  \detail        Scan completion is signaled with WIFI_EMW3080_EVENT_SCAN_DONE event and
+                 the networks found are retrieved from the cache with WiFi_EMW3080_ScanGetResult.
+                 Full scan is passive and replaces the cached networks, targeted scan actively probes
+                 for a single network, which is faster, and only updates the cached networks.
+  \param[in]     ssid     Pointer to SSID of network to scan for (NULL = full scan)
+  \return        execution status
+                   - ARM_DRIVER_OK                : Operation successful (scan started)
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_BUSY        : Scan started earlier is not completed yet
+                   - ARM_DRIVER_ERROR_UNSUPPORTED : Operation not supported (scan result cache disabled)
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (empty SSID or SSID longer than 32 characters)
+*/
+int32_t WiFi_EMW3080_ScanStart (const char *ssid) {
+  size_t  len;
+  int32_t ret;
+
+  len = 0U;
+  if (ssid != NULL) {
+    len = strlen(ssid);
+    if ((len == 0U) || (len >= sizeof(scan_ssid))) {
+      return ARM_DRIVER_ERROR_PARAMETER;
+    }
+  }
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (osMutexAcquire(mutex_id_scan, osWaitForever) != osOK) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  if (scan_busy != 0U) {
+    ret = ARM_DRIVER_ERROR_BUSY;
+  } else {
+    memcpy(scan_ssid, (len != 0U) ? ssid : "", len + 1U);
+    scan_busy = 1U;
+    ret = ARM_DRIVER_OK;
+    if ((osThreadFlagsSet(thread_id_scan, SCAN_FLAG_START) & osFlagsError) != 0U) {
+      scan_busy = 0U;
+      ret = ARM_DRIVER_ERROR;
+    }
+  }
+
+  (void)osMutexRelease(mutex_id_scan);
+
+  return ret;
+}
+
+/**
+  \fn            int32_t WiFi_EMW3080_ScanGetResult (WiFi_EMW3080_ScanResult_t result[], uint32_t max_num)
+  \brief         Get networks from the scan result cache, without a module request.
+  \param[out]    result    Pointer to array of WiFi_EMW3080_ScanResult_t structures where networks will be returned
+  \param[in]     max_num   Maximum number of networks to return
+  \return        number of WiFi_EMW3080_ScanResult_t structures returned or error code
+                   - value >= 0                   : Number of WiFi_EMW3080_ScanResult_t structures returned
+                   - ARM_DRIVER_ERROR             : Operation failed
+                   - ARM_DRIVER_ERROR_UNSUPPORTED : Operation not supported (scan result cache disabled)
+                   - ARM_DRIVER_ERROR_PARAMETER   : Parameter error (NULL result pointer or max_num equal to 0)
+*/
+int32_t WiFi_EMW3080_ScanGetResult (WiFi_EMW3080_ScanResult_t result[], uint32_t max_num) {
+  uint32_t now, i;
+  int32_t  ret;
+
+  if ((result == NULL) || (max_num == 0U)) {
+    return ARM_DRIVER_ERROR_PARAMETER;
+  }
+  if (driver_initialized == 0U) {
+    return ARM_DRIVER_ERROR;
+  }
+
+  ret = ARM_DRIVER_ERROR;
+
+  if (osMutexAcquire(mutex_id_scan, osWaitForever) == osOK) {
+    now = osKernelGetTickCount();
+    for (i = 0U; (i < scan_cache_num) && (i < max_num); i++) {
+      result[i].info = scan_cache[i].info;
+      result[i].age  = now - scan_cache[i].time;
+    }
+    ret = (int32_t)i;
+    (void)osMutexRelease(mutex_id_scan);
+  }
+
+  return ret;
+}
+#else
+// Scan result cache is disabled (WIFI_EMW3080_SCAN_CACHE_NUM = 0)
+
+int32_t WiFi_EMW3080_ScanStart (const char *ssid) {
+  (void)ssid;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+
+int32_t WiFi_EMW3080_ScanGetResult (WiFi_EMW3080_ScanResult_t result[], uint32_t max_num) {
+  (void)result;
+  (void)max_num;
+
+  return ARM_DRIVER_ERROR_UNSUPPORTED;
+}
+#endif
+
+/**
+  \fn            int32_t WiFi_EMW3080_GetStats (WiFi_EMW3080_Stats_t *stats)
+  \brief         Take a snapshot of the transport statistics.
+  \detail        Counters are accumulated since driver initialization, rates (for example 
+                 SPI bytes per second) are computed from two snapshots and their timestamps.
+  \param[out]    stats    Pointer to structure where statistics shall be returned
+  \return        status information
+                   - 0                            : Operation successful
+                   - ARM_SOCKET_EINVAL            : Invalid argument
+                   - ARM_SOCKET_ERROR             : Unspecified error
+*/
+int32_t WiFi_EMW3080_GetStats (WiFi_EMW3080_Stats_t *stats) {
+  mipc_tx_stat_t      tx_stat;
+  mipc_rx_stat_t      rx_stat;
+  mipc_latency_stat_t lat_stat;
+  mx_wifi_spi_stat_t  spi_stat;
+#if (MX_WIFI_RX_BUFFER_POOL == 1)
+  mx_buf_pool_stat_t  pool_stat;
+#endif
+  uint32_t            i, n;
+
+  if (driver_initialized == 0U) {
     return ARM_SOCKET_ERROR;
   }
+  if (stats == NULL) {
+    return ARM_SOCKET_EINVAL;
+  }
+
+  memset((void *)stats, 0, sizeof(WiFi_EMW3080_Stats_t));
+  stats->version   = WIFI_EMW3080_STATS_VERSION;
+  stats->size      = sizeof(WiFi_EMW3080_Stats_t);
+  stats->timestamp = osKernelGetTickCount();
+  stats->tick_freq = osKernelGetTickFreq();
+
+  mipc_get_tx_stat(&tx_stat);
+  mipc_get_rx_stat(&rx_stat);
+  stats->requests      = tx_stat.requests;
+  stats->responses     = rx_stat.responses;
+  stats->api_untracked = mipc_get_latency_untracked();
+
+  n = 0U;
+  for (i = 0U; i < (uint32_t)MX_WIFI_STAT_API_COUNT; i++) {
+    if (mipc_get_latency_stat(i, &lat_stat) == 0) {
+      if (n < WIFI_EMW3080_STATS_API_NUM) {
+        stats->api[n].api_id     = lat_stat.api_id;
+        stats->api[n].count      = lat_stat.count;
+        stats->api[n].timeouts   = lat_stat.timeouts;
+        stats->api[n].time_total = lat_stat.total_ms;
+        stats->api[n].time_max   = lat_stat.max_ms;
+        memcpy(stats->api[n].hist, lat_stat.hist, sizeof(stats->api[0].hist));
+        n++;
+      } else {
+        stats->api_untracked += lat_stat.count + lat_stat.timeouts;
+      }
+    }
+  }
 
-  rc = MX_WIFI_Socket_ping(ptrMX_WIFIObject, (const char *)str_addr, 1, 0, &response_time);
-  rc = ConvertSocketErrorCodeMxToCmsis(rc);
+  mx_wifi_spi_get_stat(&spi_stat);
+  stats->spi_frames         = spi_stat.frames;
+  stats->spi_tx_bytes       = spi_stat.tx_bytes;
+  stats->spi_rx_bytes       = spi_stat.rx_bytes;
+  stats->spi_errors         = spi_stat.errors;
+  stats->flow_waits         = spi_stat.flow_waits;
+  stats->flow_timeouts      = spi_stat.flow_timeouts;
+  stats->flow_wait_time     = spi_stat.flow_wait_ms;
+  stats->flow_wait_max      = spi_stat.flow_wait_ms_max;
+  stats->tx_queue_wait_time = spi_stat.tx_wait_ms;
+  stats->rx_buf_starved     = spi_stat.rx_no_buffer;
+
+#if (MX_WIFI_RX_BUFFER_POOL == 1)
+  mx_buf_pool_get_stat(&pool_stat);
+  stats->rx_buf_used_max    = pool_stat.used_max;
+  stats->rx_buf_heap_allocs = pool_stat.heap_allocs;
+#endif
 
-  return rc;
+  memcpy(stats->socket, sock_stats, sizeof(stats->socket));
+
+  return 0;
 }
 
 
@@ -2402,6 +4308,28 @@ ARM_DRIVER_WIFI ARM_Driver_WiFi_(WIFI_EMW3080_DRV_NUM) = {
   WiFi_Deactivate,
   WiFi_IsConnected,
   WiFi_GetNetInfo,
+#if (MX_WIFI_NETWORK_BYPASS_MODE == 1)
+  WiFi_BypassControl,
+  WiFi_EthSendFrame,
+  WiFi_EthReadFrame,
+  WiFi_EthGetRxFrameSize,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL,
+  NULL
+#else
   NULL,
   NULL,
   NULL,
@@ -2422,4 +4350,5 @@ ARM_DRIVER_WIFI ARM_Driver_WiFi_(WIFI_EMW3080_DRV_NUM) = {
   WiFi_SocketClose,
   WiFi_SocketGetHostByName,
   WiFi_Ping
+#endif
 };
@@ -16,7 +16,7 @@
  * limitations under the License.
  *
  *
- * $Date:        24. March 2022
+ * $Date:        16. October 2026
  *
  * Project:      WiFi Driver Header for MXCHIP EMW3080 WiFi Module 
  *               (SPI variant)
@@ -34,6 +34,124 @@
 extern void WiFi_EMW3080_Pin_NOTIFY_Rising_Edge (void);
 extern void WiFi_EMW3080_Pin_FLOW_Rising_Edge   (void);
 
+// Driver specific extensions
+
+// Socket local receive buffer statistics
+typedef struct {
+  uint32_t hits;                        // Receive calls served from local receive buffer
+  uint32_t misses;                      // Receive calls that required receive request to the module
+} WiFi_EMW3080_SocketRxBufStats_t;
+
+extern int32_t WiFi_EMW3080_SocketGetRxBufStats (int32_t socket, WiFi_EMW3080_SocketRxBufStats_t *stats);
+
+// Socket poll events
+#define WIFI_EMW3080_POLLIN             (1U << 0)       // Data is available to be read (or connection to be accepted)
+#define WIFI_EMW3080_POLLOUT            (1U << 1)       // Data can be sent
+#define WIFI_EMW3080_POLLERR            (1U << 2)       // Socket error (always reported, only in returned events)
+
+// Socket poll entry
+typedef struct {
+  int32_t  socket;                      // Socket identification number
+  uint16_t events;                      // Requested events
+  uint16_t revents;                     // Returned events
+} WiFi_EMW3080_SocketPollFd_t;
+
+extern int32_t WiFi_EMW3080_SocketPoll (WiFi_EMW3080_SocketPollFd_t *fds, uint32_t nfds, uint32_t timeout);
+
+// Host name cache statistics
+typedef struct {
+  uint32_t hits;                        // Lookups served from the cache
+  uint32_t stale_hits;                  // Lookups served from the cache with expired address (refreshed in background)
+  uint32_t negative_hits;               // Lookups served from the cache with host not found result
+  uint32_t misses;                      // Lookups that required resolution by the module
+  uint32_t refreshes;                   // Background refreshes of expired addresses
+  uint32_t evictions;                   // Cached host names replaced by other host names
+} WiFi_EMW3080_DnsCacheStats_t;
+
+extern int32_t WiFi_EMW3080_GetHostByNameCacheStats (WiFi_EMW3080_DnsCacheStats_t *stats);
+
+// Scan completed event (scan started by WiFi_EMW3080_ScanStart or background refresh),
+// arg points to int32_t result: number of networks found or ARM_DRIVER_ERROR
+#define WIFI_EMW3080_EVENT_SCAN_DONE    (1UL << 16)
+
+// Cached scan result
+typedef struct {
+  ARM_WIFI_SCAN_INFO_t info;            // Network information
+  uint32_t             age;             // Time since the network was last seen (in ms)
+} WiFi_EMW3080_ScanResult_t;
+
+extern int32_t WiFi_EMW3080_ScanStart     (const char *ssid);
+extern int32_t WiFi_EMW3080_ScanGetResult (WiFi_EMW3080_ScanResult_t result[], uint32_t max_num);
+
+// Ping limits
+#define WIFI_EMW3080_PING_COUNT_MAX     10U     // Maximum number of probes of a single ping
+#define WIFI_EMW3080_PING_INTERVAL_MAX  10000U  // Maximum interval between probes (in ms)
+
+// Ping completed event (ping started by WiFi_EMW3080_PingStart),
+// arg points to WiFi_EMW3080_PingStats_t result (received = 0 if ping failed)
+#define WIFI_EMW3080_EVENT_PING_DONE    (1UL << 17)
+
+// Ping round trip time statistics
+typedef struct {
+  uint32_t sent;                        // Probes sent
+  uint32_t received;                    // Probes answered (lost = sent - received)
+  uint32_t rtt_min;                     // Minimum round trip time (in ms)
+  uint32_t rtt_avg;                     // Average round trip time (in ms)
+  uint32_t rtt_max;                     // Maximum round trip time (in ms)
+  uint32_t jitter;                      // Average difference between consecutive round trip times (in ms)
+} WiFi_EMW3080_PingStats_t;
+
+extern int32_t WiFi_EMW3080_Ping      (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval, WiFi_EMW3080_PingStats_t *stats);
+extern int32_t WiFi_EMW3080_PingStart (const uint8_t *ip, uint32_t ip_len, uint32_t count, uint32_t interval);
+
+// Transport statistics
+#define WIFI_EMW3080_STATS_VERSION      1U      // Layout version of WiFi_EMW3080_Stats_t
+#define WIFI_EMW3080_STATS_API_NUM      16U     // Number of module APIs with request latency statistics
+#define WIFI_EMW3080_STATS_LAT_BUCKETS  12U     // Latency histogram buckets: < 1 ms, < 2 ms, < 4 ms, ..., >= 1024 ms
+
+// Module request latency statistics of one module API
+typedef struct {
+  uint32_t api_id;                      // Module API identifier (0 = entry not used)
+  uint32_t count;                       // Answered requests
+  uint32_t timeouts;                    // Requests without answer
+  uint32_t time_total;                  // Sum of answer latencies (in ms)
+  uint32_t time_max;                    // Maximum answer latency (in ms)
+  uint32_t hist[WIFI_EMW3080_STATS_LAT_BUCKETS];        // Answer latency histogram
+} WiFi_EMW3080_ApiStats_t;
+
+// Socket traffic statistics
+typedef struct {
+  uint32_t tx_bytes;                    // Bytes sent
+  uint32_t rx_bytes;                    // Bytes received
+} WiFi_EMW3080_SocketStats_t;
+
+// Transport statistics snapshot (counters accumulated since driver initialization)
+typedef struct {
+  uint32_t version;                     // Layout version (WIFI_EMW3080_STATS_VERSION)
+  uint32_t size;                        // Structure size (in bytes)
+  uint32_t timestamp;                   // Kernel tick count when the snapshot was taken
+  uint32_t tick_freq;                   // Kernel tick frequency (in Hz)
+  uint32_t requests;                    // Requests sent to the module
+  uint32_t responses;                   // Answers received from the module
+  uint32_t api_untracked;               // Requests of module APIs without latency statistics entry
+  uint32_t spi_frames;                  // Completed SPI frames
+  uint32_t spi_tx_bytes;                // SPI data bytes sent
+  uint32_t spi_rx_bytes;                // SPI data bytes received
+  uint32_t spi_errors;                  // Failed SPI transfers
+  uint32_t flow_waits;                  // Waits for the module FLOW signal
+  uint32_t flow_timeouts;               // Waits for the module FLOW signal that timed out
+  uint32_t flow_wait_time;              // Time spent waiting for the module FLOW signal (in ms)
+  uint32_t flow_wait_max;               // Maximum wait for the module FLOW signal (in ms)
+  uint32_t tx_queue_wait_time;          // Time spent waiting for free place in the SPI transmit queue (in ms)
+  uint32_t rx_buf_starved;              // Times the SPI link waited for a free receive buffer
+  uint32_t rx_buf_used_max;             // Maximum receive pool buffers in use at the same time
+  uint32_t rx_buf_heap_allocs;          // Receive buffers allocated from the heap instead of the pool
+  WiFi_EMW3080_ApiStats_t    api   [WIFI_EMW3080_STATS_API_NUM];        // Request latency per module API
+  WiFi_EMW3080_SocketStats_t socket[WIFI_EMW3080_SOCKETS_NUM];          // Traffic per socket number
+} WiFi_EMW3080_Stats_t;
+
+extern int32_t WiFi_EMW3080_GetStats (WiFi_EMW3080_Stats_t *stats);
+
 // Structure exported by the driver Driver_WiFin (default: Driver_WiFi0)
 
 extern ARM_DRIVER_WIFI ARM_Driver_WiFi_(WIFI_EMW3080_DRV_NUM);
@@ -20,6 +20,7 @@
 /* Includes ------------------------------------------------------------------*/
 #include "b_u585i_iot02a_motion_sensors.h"
 #include "b_u585i_iot02a_bus.h"
+#include <string.h>
 
 /** @addtogroup BSP
   * @{
@@ -40,6 +41,15 @@
 #define GYRO_ID     0U
 #define ACCELERO_ID 1U
 #define MAGNETO_ID  2U
+
+/* ISM330DHCX FIFO */
+#define FIFO_WORD_SIZE        7U      /* Tag byte followed by 3 axes */
+#define FIFO_DIFF_MASK        0x03FFU /* Number of unread words in FIFO_STATUS1/2 */
+#define FIFO_OVR_MASK         0x48U   /* over_run_latched and fifo_ovr_ia in FIFO_STATUS2 */
+#define FIFO_WTM_MASK         0x80U   /* fifo_wtm_ia in FIFO_STATUS2 */
+#define FIFO_TH_ROUTE         0x08U   /* int1_fifo_th in INT1_CTRL, int2_fifo_th in INT2_CTRL */
+#define FIFO_RATE_PERIOD      1000U   /* Sustained rate measurement period in ms */
+#define FIFO_MAX_BURSTS       ((FIFO_DIFF_MASK / MOTION_SENSOR_FIFO_BLOCK_WORDS) + 1U)
 /**
   * @}
   */
@@ -57,12 +67,50 @@ MOTION_SENSOR_FuncDrv_t   *Motion_Sensor_FuncDrv[MOTION_SENSOR_INSTANCES_NBR][MO
   * @}
   */
 
+/** @defgroup B_U585I_IOT02A_MOTION_SENSORS_Private_Types MOTION SENSORS Private Types
+  * @{
+  */
+typedef struct
+{
+  uint8_t                   Started;
+  uint8_t                   IntPin;
+  volatile uint8_t          IrqPending;
+  volatile uint32_t         IrqTick;
+  volatile uint32_t         Head;      /* Blocks written by the drain */
+  volatile uint32_t         Tail;      /* Blocks released by the application */
+  uint8_t                   Overrun;   /* Overrun flags set at the previous FIFO status read */
+  uint32_t                  Sequence;
+  uint32_t                  RateTick;
+  uint32_t                  RateAcc;
+  uint32_t                  RateGyro;
+  MOTION_SENSOR_FifoStats_t Stats;
+} MOTION_SENSOR_Fifo_t;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_MOTION_SENSORS_Private_Variables MOTION SENSORS Private Variables
+  * @{
+  */
+static MOTION_SENSOR_Fifo_t      MotionSensorFifo;
+static MOTION_SENSOR_FifoBlock_t MotionSensorFifoBlock[MOTION_SENSOR_FIFO_BLOCKS_NBR];
+static uint8_t                   MotionSensorFifoBurst[MOTION_SENSOR_FIFO_BLOCK_WORDS * FIFO_WORD_SIZE];
+static EXTI_HandleTypeDef        hmotion_exti;
+/**
+  * @}
+  */
+
 /** @defgroup B_U585I_IOT02A_MOTION_SENSORS_Private_Function_Prototypes MOTION SENSORS Private Function Prototypes
   * @{
   */
 /* Components probe functions prototypes */
 static int32_t ISM330DHCX_Probe(uint32_t Functions);
 static int32_t IIS2MDC_Probe(uint32_t Functions);
+/* FIFO streaming functions prototypes */
+static int32_t MOTION_SENSOR_FIFO_Setup(ISM330DHCX_Object_t *pObj, const MOTION_SENSOR_FifoConfig_t *pConfig);
+static int32_t MOTION_SENSOR_FIFO_Route(ISM330DHCX_Object_t *pObj, uint8_t IntPin, uint8_t Enable);
+static void    MOTION_SENSOR_FIFO_Decode(uint16_t Words, MOTION_SENSOR_FifoBlock_t *pBlock);
+static void    MOTION_SENSOR_FIFO_EXTI_Callback(void);
 /**
   * @}
   */
@@ -582,6 +630,426 @@ int32_t BSP_MOTION_SENSOR_SetFullScale(uint32_t Instance, uint32_t Function, int
 
   return status;
 }
+
+/**
+  * @brief  Start the FIFO streaming of the motion sensor.
+  * @param  Instance Motion sensor instance (only instance 0 is supported).
+  * @param  pConfig Pointer to the FIFO streaming configuration.
+  * @note   Accelerometer and/or gyroscope must be enabled, with an output data rate
+  *         at least equal to their batch data rate, for samples to enter the FIFO.
+  * @note   The FIFO runs in continuous mode and its watermark interrupt is routed to
+  *         the selected pin. When INT1 is selected, the EXTI line of the pin is
+  *         configured and BSP_MOTION_SENSOR_FIFO_IRQHandler() must be called from
+  *         the EXTI11 interrupt handler. INT2 is not connected to the MCU on this board.
+  * @note   The FIFO is drained over I2C2 in words of 7 bytes. Accelerometer and gyroscope
+  *         both batched at 6667 Hz need about 840 kbit/s on the bus: I2C2 must then run at
+  *         1 MHz (BUS_I2C2_FREQUENCY), at 400 kHz or below the batch data rates must be
+  *         lowered, otherwise the FIFO overruns whatever the watermark.
+  * @retval BSP status.
+  */
+int32_t BSP_MOTION_SENSOR_FIFO_Start(uint32_t Instance, const MOTION_SENSOR_FifoConfig_t *pConfig)
+{
+  int32_t status = BSP_ERROR_NONE;
+  ISM330DHCX_Object_t *pObj;
+  GPIO_InitTypeDef gpio_init_structure;
+
+  if ((Instance >= MOTION_SENSOR_INSTANCES_NBR) || (pConfig == NULL))
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != 0U)
+  {
+    status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if ((pConfig->Watermark == 0U) || (pConfig->Watermark > MOTION_SENSOR_FIFO_BLOCK_WORDS)
+           || ((pConfig->IntPin != MOTION_SENSOR_FIFO_INT1) && (pConfig->IntPin != MOTION_SENSOR_FIFO_INT2))
+           || ((pConfig->AccBdr <= 0.0f) && (pConfig->GyroBdr <= 0.0f)))
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Motion_Sensor_Ctx[Instance].Functions == 0U)
+  {
+    status = BSP_ERROR_NO_INIT;
+  }
+  else if (MotionSensorFifo.Started != 0U)
+  {
+    status = BSP_ERROR_BUSY;
+  }
+  else
+  {
+    pObj = (ISM330DHCX_Object_t *)Motion_Sensor_CompObj[Instance];
+
+    /* Reset the streaming context and the block ring */
+    (void)memset(&MotionSensorFifo, 0, sizeof(MotionSensorFifo));
+    MotionSensorFifo.IntPin   = pConfig->IntPin;
+    MotionSensorFifo.RateTick = HAL_GetTick();
+
+    if (MOTION_SENSOR_FIFO_Setup(pObj, pConfig) != ISM330DHCX_OK)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      /* Arm the EXTI before the FIFO starts filling, the rising edge of the watermark cannot be missed */
+      if (pConfig->IntPin == MOTION_SENSOR_FIFO_INT1)
+      {
+        /* Configure INT1 pin as input with external interrupt */
+        MOTION_SENSOR_INT1_GPIO_CLK_ENABLE();
+        gpio_init_structure.Pin   = MOTION_SENSOR_INT1_PIN;
+        gpio_init_structure.Mode  = GPIO_MODE_IT_RISING;
+        gpio_init_structure.Pull  = GPIO_NOPULL;
+        gpio_init_structure.Speed = GPIO_SPEED_FREQ_LOW;
+        HAL_GPIO_Init(MOTION_SENSOR_INT1_GPIO_PORT, &gpio_init_structure);
+
+        (void)HAL_EXTI_GetHandle(&hmotion_exti, MOTION_SENSOR_INT1_EXTI_LINE);
+        (void)HAL_EXTI_RegisterCallback(&hmotion_exti, HAL_EXTI_COMMON_CB_ID, MOTION_SENSOR_FIFO_EXTI_Callback);
+
+        HAL_NVIC_SetPriority(MOTION_SENSOR_INT1_EXTI_IRQn, BSP_MOTION_SENSOR_IT_PRIORITY, 0x00);
+        HAL_NVIC_EnableIRQ(MOTION_SENSOR_INT1_EXTI_IRQn);
+      }
+      MotionSensorFifo.Started = 1U;
+
+      /* Start the FIFO in continuous mode */
+      if (ISM330DHCX_FIFO_Set_Mode(pObj, (uint8_t)ISM330DHCX_STREAM_MODE) != ISM330DHCX_OK)
+      {
+        if (pConfig->IntPin == MOTION_SENSOR_FIFO_INT1)
+        {
+          HAL_NVIC_DisableIRQ(MOTION_SENSOR_INT1_EXTI_IRQn);
+        }
+        MotionSensorFifo.Started = 0U;
+        status = BSP_ERROR_COMPONENT_FAILURE;
+      }
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the FIFO streaming of the motion sensor.
+  * @param  Instance Motion sensor instance (only instance 0 is supported).
+  * @note   Blocks not yet released by the application are discarded.
+  * @retval BSP status.
+  */
+int32_t BSP_MOTION_SENSOR_FIFO_Stop(uint32_t Instance)
+{
+  int32_t status = BSP_ERROR_NONE;
+  ISM330DHCX_Object_t *pObj;
+  GPIO_InitTypeDef gpio_init_structure;
+
+  if (Instance >= MOTION_SENSOR_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != 0U)
+  {
+    status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if (MotionSensorFifo.Started == 0U)
+  {
+    /* Nothing to do (not started) */
+  }
+  else
+  {
+    pObj = (ISM330DHCX_Object_t *)Motion_Sensor_CompObj[Instance];
+
+    if (MotionSensorFifo.IntPin == MOTION_SENSOR_FIFO_INT1)
+    {
+      /* Restore INT1 pin as simple input */
+      HAL_NVIC_DisableIRQ(MOTION_SENSOR_INT1_EXTI_IRQn);
+      gpio_init_structure.Pin   = MOTION_SENSOR_INT1_PIN;
+      gpio_init_structure.Mode  = GPIO_MODE_INPUT;
+      gpio_init_structure.Pull  = GPIO_NOPULL;
+      gpio_init_structure.Speed = GPIO_SPEED_FREQ_LOW;
+      HAL_GPIO_Init(MOTION_SENSOR_INT1_GPIO_PORT, &gpio_init_structure);
+    }
+    MotionSensorFifo.Started = 0U;
+    MotionSensorFifo.Tail    = MotionSensorFifo.Head;
+
+    /* Disable the watermark interrupt and flush the FIFO */
+    if (MOTION_SENSOR_FIFO_Route(pObj, MotionSensorFifo.IntPin, 0U) != ISM330DHCX_OK)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else if (ISM330DHCX_FIFO_Set_Mode(pObj, (uint8_t)ISM330DHCX_BYPASS_MODE) != ISM330DHCX_OK)
+    {
+      status = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      /* Nothing else to do */
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Drain the FIFO of the motion sensor into the block ring.
+  * @param  Instance Motion sensor instance (only instance 0 is supported).
+  * @note   This function must be called from thread context, typically after
+  *         BSP_MOTION_SENSOR_FIFO_Callback() has signaled a watermark event.
+  *         The FIFO is emptied with one burst read per block of at most
+  *         MOTION_SENSOR_FIFO_BLOCK_WORDS words. When the block ring is full,
+  *         the samples are read and discarded so that the FIFO never stalls.
+  * @note   The watermark interrupt is a level caught on its rising edge. When the
+  *         FIFO is still at or above its watermark after the drain, no new edge
+  *         comes and BSP_MOTION_SENSOR_FIFO_Callback() is called again from here.
+  * @retval BSP status.
+  */
+int32_t BSP_MOTION_SENSOR_FIFO_Drain(uint32_t Instance)
+{
+  int32_t status = BSP_ERROR_NONE;
+  ISM330DHCX_Object_t *pObj;
+  MOTION_SENSOR_FifoBlock_t *pBlock;
+  uint8_t  fifo_status[2];
+  uint16_t level;
+  uint16_t words;
+  uint32_t bursts = 0U;
+  uint32_t tick;
+  uint32_t elapsed;
+
+  if (Instance >= MOTION_SENSOR_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != 0U)
+  {
+    status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if (MotionSensorFifo.Started == 0U)
+  {
+    status = BSP_ERROR_NO_INIT;
+  }
+  else
+  {
+    pObj = (ISM330DHCX_Object_t *)Motion_Sensor_CompObj[Instance];
+
+    /* Timestamp the data with the watermark event if any */
+    tick = HAL_GetTick();
+    if (MotionSensorFifo.IrqPending != 0U)
+    {
+      MotionSensorFifo.IrqPending = 0U;
+      tick = MotionSensorFifo.IrqTick;
+    }
+
+    do
+    {
+      /* Read the FIFO level and overrun flags */
+      if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_FIFO_STATUS1, fifo_status, 2) != ISM330DHCX_OK)
+      {
+        status = BSP_ERROR_COMPONENT_FAILURE;
+        break;
+      }
+      /* The flags stay set until the FIFO is drained, count each overrun once */
+      if ((fifo_status[1] & FIFO_OVR_MASK) != 0U)
+      {
+        if (MotionSensorFifo.Overrun == 0U)
+        {
+          MotionSensorFifo.Stats.Overruns++;
+        }
+        MotionSensorFifo.Overrun = 1U;
+      }
+      else
+      {
+        MotionSensorFifo.Overrun = 0U;
+      }
+      level = (uint16_t)((((uint16_t)fifo_status[1] << 8) | fifo_status[0]) & FIFO_DIFF_MASK);
+      if (level == 0U)
+      {
+        break;
+      }
+      words = (level > MOTION_SENSOR_FIFO_BLOCK_WORDS) ? (uint16_t)MOTION_SENSOR_FIFO_BLOCK_WORDS : level;
+
+      /* Read all words in one burst */
+      if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_FIFO_DATA_OUT_TAG, MotionSensorFifoBurst,
+                              (uint16_t)(words * FIFO_WORD_SIZE)) != ISM330DHCX_OK)
+      {
+        status = BSP_ERROR_COMPONENT_FAILURE;
+        break;
+      }
+      MotionSensorFifo.Stats.Bursts++;
+      bursts++;
+
+      if ((MotionSensorFifo.Head - MotionSensorFifo.Tail) < MOTION_SENSOR_FIFO_BLOCKS_NBR)
+      {
+        pBlock = &MotionSensorFifoBlock[MotionSensorFifo.Head % MOTION_SENSOR_FIFO_BLOCKS_NBR];
+        pBlock->Timestamp = tick;
+        pBlock->Sequence  = MotionSensorFifo.Sequence;
+        MotionSensorFifo.Sequence++;
+        MOTION_SENSOR_FIFO_Decode(words, pBlock);
+        MotionSensorFifo.Head++;
+      }
+      else
+      {
+        MOTION_SENSOR_FIFO_Decode(words, NULL);
+      }
+      tick = HAL_GetTick();
+    } while ((level > words) && (bursts < FIFO_MAX_BURSTS));
+
+    /* Check the watermark level again, the samples received meanwhile may keep it high */
+    if (status == BSP_ERROR_NONE)
+    {
+      if (MotionSensorFifo.IntPin == MOTION_SENSOR_FIFO_INT1)
+      {
+        if (HAL_GPIO_ReadPin(MOTION_SENSOR_INT1_GPIO_PORT, MOTION_SENSOR_INT1_PIN) == GPIO_PIN_SET)
+        {
+          fifo_status[1] = FIFO_WTM_MASK;
+        }
+        else
+        {
+          fifo_status[1] = 0U;
+        }
+      }
+      else if (ism330dhcx_read_reg(&(pObj->Ctx), ISM330DHCX_FIFO_STATUS2, &fifo_status[1], 1) != ISM330DHCX_OK)
+      {
+        status = BSP_ERROR_COMPONENT_FAILURE;
+        fifo_status[1] = 0U;
+      }
+      else
+      {
+        /* Level read from FIFO_STATUS2 */
+      }
+
+      if ((fifo_status[1] & FIFO_WTM_MASK) != 0U)
+      {
+        MotionSensorFifo.IrqTick    = HAL_GetTick();
+        MotionSensorFifo.IrqPending = 1U;
+        BSP_MOTION_SENSOR_FIFO_Callback(Instance);
+      }
+    }
+
+    /* Update the sustained rates */
+    tick    = HAL_GetTick();
+    elapsed = tick - MotionSensorFifo.RateTick;
+    if (elapsed >= FIFO_RATE_PERIOD)
+    {
+      MotionSensorFifo.Stats.AccRate  = ((MotionSensorFifo.Stats.AccSamples - MotionSensorFifo.RateAcc) * 1000U) / elapsed;
+      MotionSensorFifo.Stats.GyroRate = ((MotionSensorFifo.Stats.GyroSamples - MotionSensorFifo.RateGyro) * 1000U) / elapsed;
+      MotionSensorFifo.RateTick = tick;
+      MotionSensorFifo.RateAcc  = MotionSensorFifo.Stats.AccSamples;
+      MotionSensorFifo.RateGyro = MotionSensorFifo.Stats.GyroSamples;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Get the oldest FIFO block of the motion sensor.
+  * @param  Instance Motion sensor instance (only instance 0 is supported).
+  * @param  pBlock Pointer to the block pointer, set to NULL when no block is available.
+  * @note   The block remains owned by the application until
+  *         BSP_MOTION_SENSOR_FIFO_ReleaseBlock() is called.
+  * @retval BSP status.
+  */
+int32_t BSP_MOTION_SENSOR_FIFO_GetBlock(uint32_t Instance, MOTION_SENSOR_FifoBlock_t **pBlock)
+{
+  int32_t status = BSP_ERROR_NONE;
+
+  if ((Instance >= MOTION_SENSOR_INSTANCES_NBR) || (pBlock == NULL))
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != 0U)
+  {
+    status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if (MotionSensorFifo.Head == MotionSensorFifo.Tail)
+  {
+    *pBlock = NULL;
+  }
+  else
+  {
+    *pBlock = &MotionSensorFifoBlock[MotionSensorFifo.Tail % MOTION_SENSOR_FIFO_BLOCKS_NBR];
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Release the oldest FIFO block of the motion sensor.
+  * @param  Instance Motion sensor instance (only instance 0 is supported).
+  * @retval BSP status.
+  */
+int32_t BSP_MOTION_SENSOR_FIFO_ReleaseBlock(uint32_t Instance)
+{
+  int32_t status = BSP_ERROR_NONE;
+
+  if (Instance >= MOTION_SENSOR_INSTANCES_NBR)
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != 0U)
+  {
+    status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if (MotionSensorFifo.Head != MotionSensorFifo.Tail)
+  {
+    MotionSensorFifo.Tail++;
+  }
+  else
+  {
+    /* Nothing to do (no block) */
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Get the FIFO streaming statistics of the motion sensor.
+  * @param  Instance Motion sensor instance (only instance 0 is supported).
+  * @param  pStats Pointer to the FIFO streaming statistics.
+  * @retval BSP status.
+  */
+int32_t BSP_MOTION_SENSOR_FIFO_GetStats(uint32_t Instance, MOTION_SENSOR_FifoStats_t *pStats)
+{
+  int32_t status = BSP_ERROR_NONE;
+
+  if ((Instance >= MOTION_SENSOR_INSTANCES_NBR) || (pStats == NULL))
+  {
+    status = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != 0U)
+  {
+    status = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else
+  {
+    *pStats = MotionSensorFifo.Stats;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  This function handles the motion sensor FIFO interrupt requests.
+  * @param  Instance Motion sensor instance (only instance 0 is supported).
+  * @retval None
+  */
+void BSP_MOTION_SENSOR_FIFO_IRQHandler(uint32_t Instance)
+{
+  if (Instance == 0U)
+  {
+    HAL_EXTI_IRQHandler(&hmotion_exti);
+  }
+}
+
+/**
+  * @brief  BSP motion sensor FIFO watermark callback.
+  * @param  Instance Motion sensor instance.
+  * @note   Called in interrupt context: the application should signal a thread
+  *         which then calls BSP_MOTION_SENSOR_FIFO_Drain(). Also called by
+  *         BSP_MOTION_SENSOR_FIFO_Drain() when the FIFO is still above its watermark.
+  * @retval None.
+  */
+__weak void BSP_MOTION_SENSOR_FIFO_Callback(uint32_t Instance)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+  /* This function should be implemented by the user application.
+     It is called into this driver when the FIFO watermark is reached. */
+}
 /**
   * @}
   */
@@ -710,6 +1178,155 @@ static int32_t IIS2MDC_Probe(uint32_t Functions)
 
   return status;
 }
+
+/**
+  * @brief  Configure the ISM330DHCX FIFO with watermark interrupt, left in bypass mode.
+  * @param  pObj Pointer to the ISM330DHCX component object.
+  * @param  pConfig Pointer to the FIFO streaming configuration.
+  * @retval Component status.
+  */
+static int32_t MOTION_SENSOR_FIFO_Setup(ISM330DHCX_Object_t *pObj, const MOTION_SENSOR_FifoConfig_t *pConfig)
+{
+  int32_t ret;
+
+  /* Flush the FIFO */
+  ret = ISM330DHCX_FIFO_Set_Mode(pObj, (uint8_t)ISM330DHCX_BYPASS_MODE);
+
+  /* Set the batch data rates */
+  if (ret == ISM330DHCX_OK)
+  {
+    if (pConfig->AccBdr > 0.0f)
+    {
+      ret = ISM330DHCX_FIFO_ACC_Set_BDR(pObj, pConfig->AccBdr);
+    }
+    else
+    {
+      ret = ism330dhcx_fifo_xl_batch_set(&(pObj->Ctx), ISM330DHCX_XL_NOT_BATCHED);
+    }
+  }
+  if (ret == ISM330DHCX_OK)
+  {
+    if (pConfig->GyroBdr > 0.0f)
+    {
+      ret = ISM330DHCX_FIFO_GYRO_Set_BDR(pObj, pConfig->GyroBdr);
+    }
+    else
+    {
+      ret = ism330dhcx_fifo_gy_batch_set(&(pObj->Ctx), ISM330DHCX_GY_NOT_BATCHED);
+    }
+  }
+
+  /* Set the watermark and route it to the interrupt pin */
+  if (ret == ISM330DHCX_OK)
+  {
+    ret = ISM330DHCX_FIFO_Set_Watermark_Level(pObj, pConfig->Watermark);
+  }
+  if (ret == ISM330DHCX_OK)
+  {
+    ret = MOTION_SENSOR_FIFO_Route(pObj, pConfig->IntPin, 1U);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enable or disable the FIFO watermark interrupt on an ISM330DHCX pin.
+  * @param  pObj Pointer to the ISM330DHCX component object.
+  * @param  IntPin MOTION_SENSOR_FIFO_INT1 or MOTION_SENSOR_FIFO_INT2.
+  * @param  Enable 1 to enable, 0 to disable.
+  * @retval Component status.
+  */
+static int32_t MOTION_SENSOR_FIFO_Route(ISM330DHCX_Object_t *pObj, uint8_t IntPin, uint8_t Enable)
+{
+  int32_t ret;
+  uint8_t reg = (IntPin == MOTION_SENSOR_FIFO_INT1) ? ISM330DHCX_INT1_CTRL : ISM330DHCX_INT2_CTRL;
+  uint8_t data;
+
+  ret = ISM330DHCX_Read_Reg(pObj, reg, &data);
+  if (ret == ISM330DHCX_OK)
+  {
+    if (Enable != 0U)
+    {
+      data |= FIFO_TH_ROUTE;
+    }
+    else
+    {
+      data &= (uint8_t)~FIFO_TH_ROUTE;
+    }
+    ret = ISM330DHCX_Write_Reg(pObj, reg, data);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Decode the FIFO words of the burst buffer.
+  * @param  Words Number of words in the burst buffer.
+  * @param  pBlock Pointer to the destination block, NULL to discard the samples.
+  * @retval None.
+  */
+static void MOTION_SENSOR_FIFO_Decode(uint16_t Words, MOTION_SENSOR_FifoBlock_t *pBlock)
+{
+  const uint8_t *pWord;
+  BSP_MOTION_SENSOR_AxesRaw_t axes;
+  uint16_t acc_nbr = 0U;
+  uint16_t gyro_nbr = 0U;
+  uint16_t i;
+  uint8_t  tag;
+
+  for (i = 0U; i < Words; i++)
+  {
+    pWord = &MotionSensorFifoBurst[i * FIFO_WORD_SIZE];
+    tag   = pWord[0] >> 3;
+    axes.xval = (int16_t)(((uint16_t)pWord[2] << 8) | pWord[1]);
+    axes.yval = (int16_t)(((uint16_t)pWord[4] << 8) | pWord[3]);
+    axes.zval = (int16_t)(((uint16_t)pWord[6] << 8) | pWord[5]);
+
+    if (tag == (uint8_t)ISM330DHCX_XL_NC_TAG)
+    {
+      if (pBlock != NULL)
+      {
+        pBlock->Acc[acc_nbr] = axes;
+      }
+      acc_nbr++;
+    }
+    else if (tag == (uint8_t)ISM330DHCX_GYRO_NC_TAG)
+    {
+      if (pBlock != NULL)
+      {
+        pBlock->Gyro[gyro_nbr] = axes;
+      }
+      gyro_nbr++;
+    }
+    else
+    {
+      /* Other sensors are not batched */
+    }
+  }
+
+  MotionSensorFifo.Stats.AccSamples  += acc_nbr;
+  MotionSensorFifo.Stats.GyroSamples += gyro_nbr;
+  if (pBlock != NULL)
+  {
+    pBlock->AccNbr  = acc_nbr;
+    pBlock->GyroNbr = gyro_nbr;
+  }
+  else
+  {
+    MotionSensorFifo.Stats.Dropped += (uint32_t)acc_nbr + gyro_nbr;
+  }
+}
+
+/**
+  * @brief  Motion sensor INT1 EXTI line detection callback.
+  * @retval None.
+  */
+static void MOTION_SENSOR_FIFO_EXTI_Callback(void)
+{
+  MotionSensorFifo.IrqTick    = HAL_GetTick();
+  MotionSensorFifo.IrqPending = 1U;
+  BSP_MOTION_SENSOR_FIFO_Callback(0);
+}
 /**
   * @}
   */
@@ -74,7 +74,9 @@ static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t
 static int32_t HTS221_GetOutputDataRate(HTS221_Object_t *pObj, float *Odr);
 static int32_t HTS221_SetOutputDataRate(HTS221_Object_t *pObj, float Odr);
 static int32_t HTS221_Initialize(HTS221_Object_t *pObj);
-static float Linear_Interpolation(lin_t *Lin, float Coeff);
+static int32_t HTS221_Load_Calibration(HTS221_Object_t *pObj);
+static float HTS221_Humidity(HTS221_Object_t *pObj, int16_t Raw);
+static float HTS221_Temperature(HTS221_Object_t *pObj, int16_t Raw);
 
 /**
   * @}
@@ -314,27 +316,6 @@ int32_t HTS221_HUM_SetOutputDataRate(HTS221_Object_t *pObj, float Odr)
 int32_t HTS221_HUM_GetHumidity(HTS221_Object_t *pObj, float *Value)
 {
   hts221_axis1bit16_t data_raw_humidity;
-  lin_t lin_hum;
-
-  if (hts221_hum_adc_point_0_get(&(pObj->Ctx), &lin_hum.x0) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_hum_rh_point_0_get(&(pObj->Ctx), &lin_hum.y0) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_hum_adc_point_1_get(&(pObj->Ctx), &lin_hum.x1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
-
-  if (hts221_hum_rh_point_1_get(&(pObj->Ctx), &lin_hum.y1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
 
   (void)memset(&data_raw_humidity.i16bit, 0x00, sizeof(int16_t));
   if (hts221_humidity_raw_get(&(pObj->Ctx), &data_raw_humidity.i16bit) != HTS221_OK)
@@ -342,17 +323,7 @@ int32_t HTS221_HUM_GetHumidity(HTS221_Object_t *pObj, float *Value)
     return HTS221_ERROR;
   }
 
-  *Value = Linear_Interpolation(&lin_hum, (float)data_raw_humidity.i16bit);
-
-  if (*Value < 0.0f)
-  {
-    *Value = 0.0f;
-  }
-
-  if (*Value > 100.0f)
-  {
-    *Value = 100.0f;
-  }
+  *Value = HTS221_Humidity(pObj, data_raw_humidity.i16bit);
 
   return HTS221_OK;
 }
@@ -462,51 +433,66 @@ int32_t HTS221_TEMP_SetOutputDataRate(HTS221_Object_t *pObj, float Odr)
 int32_t HTS221_TEMP_GetTemperature(HTS221_Object_t *pObj, float *Value)
 {
   hts221_axis1bit16_t data_raw_temperature;
-  lin_t lin_temp;
 
-  if (hts221_temp_adc_point_0_get(&(pObj->Ctx), &lin_temp.x0) != HTS221_OK)
+  (void)memset(&data_raw_temperature.i16bit, 0x00, sizeof(int16_t));
+  if (hts221_temperature_raw_get(&(pObj->Ctx), &data_raw_temperature.i16bit) != HTS221_OK)
   {
     return HTS221_ERROR;
   }
 
-  if (hts221_temp_deg_point_0_get(&(pObj->Ctx), &lin_temp.y0) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
+  *Value = HTS221_Temperature(pObj, data_raw_temperature.i16bit);
 
-  if (hts221_temp_adc_point_1_get(&(pObj->Ctx), &lin_temp.x1) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
+  return HTS221_OK;
+}
 
-  if (hts221_temp_deg_point_1_get(&(pObj->Ctx), &lin_temp.y1) != HTS221_OK)
+/**
+  * @brief  Get the HTS221 temperature data ready bit value
+  * @param  pObj the device pObj
+  * @param  Status the status of data ready bit
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t HTS221_TEMP_Get_DRDY_Status(HTS221_Object_t *pObj, uint8_t *Status)
+{
+  if (hts221_temp_data_ready_get(&(pObj->Ctx), Status) != HTS221_OK)
   {
     return HTS221_ERROR;
   }
 
-  (void)memset(&data_raw_temperature.i16bit, 0x00, sizeof(int16_t));
-  if (hts221_temperature_raw_get(&(pObj->Ctx), &data_raw_temperature.i16bit) != HTS221_OK)
+  return HTS221_OK;
+}
+
+/**
+  * @brief  Get the HTS221 humidity and temperature values in one bus transaction
+  * @param  pObj the device pObj
+  * @param  Humidity pointer where the humidity value is written
+  * @param  Temperature pointer where the temperature value is written
+  * @retval 0 in case of success, an error code otherwise
+  */
+int32_t HTS221_Get_Hum_Temp(HTS221_Object_t *pObj, float *Humidity, float *Temperature)
+{
+  int16_t raw_humidity;
+  int16_t raw_temperature;
+
+  if (hts221_hum_temp_raw_get(&(pObj->Ctx), &raw_humidity, &raw_temperature) != HTS221_OK)
   {
     return HTS221_ERROR;
   }
 
-  *Value = Linear_Interpolation(&lin_temp, (float)data_raw_temperature.i16bit);
+  *Humidity    = HTS221_Humidity(pObj, raw_humidity);
+  *Temperature = HTS221_Temperature(pObj, raw_temperature);
 
   return HTS221_OK;
 }
 
 /**
-  * @brief  Get the HTS221 temperature data ready bit value
+  * @brief  Get the number of HTS221 register transactions on the bus
   * @param  pObj the device pObj
-  * @param  Status the status of data ready bit
+  * @param  Count pointer where the number of transactions is written
   * @retval 0 in case of success, an error code otherwise
   */
-int32_t HTS221_TEMP_Get_DRDY_Status(HTS221_Object_t *pObj, uint8_t *Status)
+int32_t HTS221_Get_Bus_Transactions(HTS221_Object_t *pObj, uint32_t *Count)
 {
-  if (hts221_temp_data_ready_get(&(pObj->Ctx), Status) != HTS221_OK)
-  {
-    return HTS221_ERROR;
-  }
+  *Count = pObj->bus_transactions;
 
   return HTS221_OK;
 }
@@ -700,6 +686,75 @@ static int32_t HTS221_Initialize(HTS221_Object_t *pObj)
     return HTS221_ERROR;
   }
 
+  /* Read factory calibration once */
+  if (HTS221_Load_Calibration(pObj) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  return HTS221_OK;
+}
+
+/**
+  * @brief  Read the HTS221 factory calibration and compute the conversion coefficients
+  * @param  pObj the device pObj
+  * @retval 0 in case of success, an error code otherwise
+  */
+static int32_t HTS221_Load_Calibration(HTS221_Object_t *pObj)
+{
+  uint8_t calib[16];
+  int32_t x0;
+  int32_t x1;
+  int32_t y0;
+  int32_t y1;
+  int64_t slope;
+
+  /* Calibration registers H0_rH_x2 (0x30) to T1_OUT_H (0x3F) in one transaction */
+  if (hts221_read_reg(&(pObj->Ctx), HTS221_H0_RH_X2, calib, 16) != HTS221_OK)
+  {
+    return HTS221_ERROR;
+  }
+
+  /* Humidity: H0_rH_x2 and H1_rH_x2 in 0.5 %RH, H0_T0_OUT and H1_T0_OUT in LSB */
+  y0 = (int32_t)calib[HTS221_H0_RH_X2 - HTS221_H0_RH_X2];
+  y1 = (int32_t)calib[HTS221_H1_RH_X2 - HTS221_H0_RH_X2];
+  x0 = (int16_t)(((uint16_t)calib[HTS221_H0_T0_OUT_H - HTS221_H0_RH_X2] << 8) |
+                 calib[HTS221_H0_T0_OUT_L - HTS221_H0_RH_X2]);
+  x1 = (int16_t)(((uint16_t)calib[HTS221_H1_T0_OUT_H - HTS221_H0_RH_X2] << 8) |
+                 calib[HTS221_H1_T0_OUT_L - HTS221_H0_RH_X2]);
+  if (x1 == x0)
+  {
+    return HTS221_ERROR;
+  }
+  slope = ((int64_t)(y1 - y0) * (1LL << 23)) / (x1 - x0);
+  if ((slope > INT32_MAX) || (slope < INT32_MIN))
+  {
+    return HTS221_ERROR;
+  }
+  pObj->hum_slope  = (int32_t)slope;
+  pObj->hum_offset = ((int64_t)y0 * (1LL << 23)) - (slope * x0);
+
+  /* Temperature: T0_degC_x8 and T1_degC_x8 (MSBs in T1_T0_MSB) in 1/8 degC, T0_OUT and T1_OUT in LSB */
+  y0 = (int32_t)calib[HTS221_T0_DEGC_X8 - HTS221_H0_RH_X2] |
+       ((int32_t)(calib[HTS221_T1_T0_MSB - HTS221_H0_RH_X2] & 0x03U) << 8);
+  y1 = (int32_t)calib[HTS221_T1_DEGC_X8 - HTS221_H0_RH_X2] |
+       ((int32_t)(calib[HTS221_T1_T0_MSB - HTS221_H0_RH_X2] & 0x0CU) << 6);
+  x0 = (int16_t)(((uint16_t)calib[HTS221_T0_OUT_H - HTS221_H0_RH_X2] << 8) |
+                 calib[HTS221_T0_OUT_L - HTS221_H0_RH_X2]);
+  x1 = (int16_t)(((uint16_t)calib[HTS221_T1_OUT_H - HTS221_H0_RH_X2] << 8) |
+                 calib[HTS221_T1_OUT_L - HTS221_H0_RH_X2]);
+  if (x1 == x0)
+  {
+    return HTS221_ERROR;
+  }
+  slope = ((int64_t)(y1 - y0) * (1LL << 21)) / (x1 - x0);
+  if ((slope > INT32_MAX) || (slope < INT32_MIN))
+  {
+    return HTS221_ERROR;
+  }
+  pObj->temp_slope  = (int32_t)slope;
+  pObj->temp_offset = ((int64_t)y0 * (1LL << 21)) - (slope * x0);
+
   return HTS221_OK;
 }
 
@@ -719,14 +774,39 @@ int32_t HTS221_Enable_DRDY_Interrupt(HTS221_Object_t *pObj)
 }
 
 /**
-  * @brief  Function used to apply coefficient
-  * @param  Lin the line
-  * @param  Coeff the coefficient
-  * @retval Calculation result
+  * @brief  Convert raw humidity with the cached calibration
+  * @param  pObj the device pObj
+  * @param  Raw the raw humidity value
+  * @retval Humidity in %RH (limited to 0..100)
+  */
+static float HTS221_Humidity(HTS221_Object_t *pObj, int16_t Raw)
+{
+  float value;
+
+  value = (float)(((int64_t)pObj->hum_slope * Raw) + pObj->hum_offset) * (1.0f / 16777216.0f);
+
+  if (value < 0.0f)
+  {
+    value = 0.0f;
+  }
+
+  if (value > 100.0f)
+  {
+    value = 100.0f;
+  }
+
+  return value;
+}
+
+/**
+  * @brief  Convert raw temperature with the cached calibration
+  * @param  pObj the device pObj
+  * @param  Raw the raw temperature value
+  * @retval Temperature in degC
   */
-static float Linear_Interpolation(lin_t *Lin, float Coeff)
+static float HTS221_Temperature(HTS221_Object_t *pObj, int16_t Raw)
 {
-  return (((Lin->y1 - Lin->y0) * Coeff) + ((Lin->x1 * Lin->y0) - (Lin->x0 * Lin->y1))) / (Lin->x1 - Lin->x0);
+  return (float)(((int64_t)pObj->temp_slope * Raw) + pObj->temp_offset) * (1.0f / 16777216.0f);
 }
 
 /**
@@ -741,6 +821,8 @@ static int32_t ReadRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t L
 {
   HTS221_Object_t *pObj = (HTS221_Object_t *)Handle;
 
+  pObj->bus_transactions++;
+
   if (pObj->IO.BusType == (uint32_t)HTS221_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte read */
@@ -765,6 +847,8 @@ static int32_t WriteRegWrap(void *Handle, uint8_t Reg, uint8_t *pData, uint16_t
 {
   HTS221_Object_t *pObj = (HTS221_Object_t *)Handle;
 
+  pObj->bus_transactions++;
+
   if (pObj->IO.BusType == (uint32_t)HTS221_I2C_BUS) /* I2C */
   {
     /* Enable Multi-byte write */
@@ -79,6 +79,11 @@ typedef struct
   uint8_t            is_initialized;
   uint8_t            hum_is_enabled;
   uint8_t            temp_is_enabled;
+  int32_t            hum_slope;        /* Humidity calibration slope in %RH/LSB (Q24) */
+  int64_t            hum_offset;       /* Humidity calibration offset in %RH (Q24) */
+  int32_t            temp_slope;       /* Temperature calibration slope in degC/LSB (Q24) */
+  int64_t            temp_offset;      /* Temperature calibration offset in degC (Q24) */
+  uint32_t           bus_transactions; /* Number of register read and write transactions */
 } HTS221_Object_t;
 
 typedef struct
@@ -185,6 +190,9 @@ int32_t HTS221_TEMP_SetOutputDataRate(HTS221_Object_t *pObj, float Odr);
 int32_t HTS221_TEMP_GetTemperature(HTS221_Object_t *pObj, float *Value);
 int32_t HTS221_TEMP_Get_DRDY_Status(HTS221_Object_t *pObj, uint8_t *Status);
 
+int32_t HTS221_Get_Hum_Temp(HTS221_Object_t *pObj, float *Humidity, float *Temperature);
+int32_t HTS221_Get_Bus_Transactions(HTS221_Object_t *pObj, uint32_t *Count);
+
 int32_t HTS221_Read_Reg(HTS221_Object_t *pObj, uint8_t Reg, uint8_t *Data);
 int32_t HTS221_Write_Reg(HTS221_Object_t *pObj, uint8_t Reg, uint8_t Data);
 
@@ -394,6 +394,9 @@ int32_t hts221_humidity_raw_get(stmdev_ctx_t *ctx, int16_t *val);
 
 int32_t hts221_temperature_raw_get(stmdev_ctx_t *ctx, int16_t *val);
 
+int32_t hts221_hum_temp_raw_get(stmdev_ctx_t *ctx, int16_t *hum,
+                                int16_t *temp);
+
 int32_t hts221_device_id_get(stmdev_ctx_t *ctx, uint8_t *buff);
 
 int32_t hts221_power_on_set(stmdev_ctx_t *ctx, uint8_t val);
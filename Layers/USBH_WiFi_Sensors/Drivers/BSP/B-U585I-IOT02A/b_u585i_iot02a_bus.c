@@ -56,6 +56,17 @@
 #define I2C_SCLH_MAX                           256U
 #define I2C_SCLL_MAX                           256U
 #define SEC2NSEC                               1000000000UL
+
+#define I2C_XFER_HOLD                          0xFFU /* Exclusive bus access (internal transfer type) */
+
+#if ((BUS_I2C1_XFER_MODE != BUS_I2C_XFER_POLLING) || (BUS_I2C2_XFER_MODE != BUS_I2C_XFER_POLLING))
+#if (USE_HAL_I2C_REGISTER_CALLBACKS == 0)
+#error "I2C interrupt and DMA transfer modes require USE_HAL_I2C_REGISTER_CALLBACKS set to 1"
+#endif /* USE_HAL_I2C_REGISTER_CALLBACKS == 0 */
+#define I2C_XFER_ASYNC                         1U
+#else
+#define I2C_XFER_ASYNC                         0U
+#endif /* BUS_I2C1_XFER_MODE, BUS_I2C2_XFER_MODE */
 /**
   * @}
   */
@@ -86,6 +97,16 @@ typedef struct
   uint32_t sclh;       /* SCL high period */
   uint32_t scll;       /* SCL low period */
 } I2C_Timings_t;
+
+typedef struct
+{
+  I2C_HandleTypeDef *hi2c;          /* I2C handle */
+  uint32_t           Mode;          /* Transfer mode */
+  uint32_t           CbRegistered;  /* HAL transfer callbacks registered (interrupt and DMA modes) */
+  BSP_I2C_Xfer_t    *pHead;         /* Transfer in progress */
+  BSP_I2C_Xfer_t    *pTail;         /* Last queued transfer */
+  BSP_I2C_Xfer_t    *pAbort;        /* Transfer in progress aborted after a wait timeout */
+} I2C_Engine_t;
 /**
   * @}
   */
@@ -149,9 +170,11 @@ static uint32_t      I2c1InitCounter = 0;
 static uint32_t      I2c2InitCounter = 0;
 static I2C_Timings_t I2c_valid_timing[I2C_VALID_TIMING_NBR];
 static uint32_t      I2c_valid_timing_nbr = 0;
-#if defined(BSP_USE_CMSIS_OS)
-static osSemaphoreId_t BspI2cSemaphore[2] = { NULL, NULL };
-#endif /* BSP_USE_CMSIS_OS */
+static I2C_Engine_t  I2cEngine[2] =
+{
+  { &hi2c1, BUS_I2C1_XFER_MODE, 0U, NULL, NULL, NULL },
+  { &hi2c2, BUS_I2C2_XFER_MODE, 0U, NULL, NULL, NULL }
+};
 /**
   * @}
   */
@@ -167,15 +190,29 @@ static osSemaphoreId_t BspI2cSemaphore[2] = { NULL, NULL };
 /** @defgroup B_U585I_IOT02A_BUS_Private_FunctionPrototypes BUS Private FunctionPrototypes
   * @{
   */
-static int32_t  I2C1_WriteReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C1_ReadReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
-static int32_t  I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
-
-static int32_t  I2C2_WriteReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C2_ReadReg(uint16_t DevAddr, uint16_t MemAddSize, uint16_t Reg, uint8_t *pData, uint16_t Length);
-static int32_t  I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
-static int32_t  I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
+static int32_t  I2C_Xfer(I2C_Engine_t *pEng, uint32_t Dir, uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
+                         uint8_t *pData, uint16_t Length);
+static int32_t  I2C_IsReady(I2C_Engine_t *pEng, uint16_t DevAddr, uint32_t Trials);
+static void     I2C_XferSubmit(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer);
+static void     I2C_XferRun(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer);
+static int32_t  I2C_XferStart(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer);
+static BSP_I2C_Xfer_t *I2C_XferDone(I2C_Engine_t *pEng, int32_t Status);
+static void     I2C_XferNotify(BSP_I2C_Xfer_t *pXfer, int32_t Status);
+static int32_t  I2C_XferStatus(I2C_HandleTypeDef *hi2c, HAL_StatusTypeDef Status);
+static void     I2C_XferWaitInit(BSP_I2C_Xfer_t *pXfer);
+static void     I2C_XferWait(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer);
+static uint32_t I2C_XferWaitTimeout(BSP_I2C_Xfer_t *pXfer, uint32_t Timeout);
+static uint32_t I2C_XferCancel(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer, uint32_t Head);
+#if defined(BSP_USE_CMSIS_OS)
+static void     I2C_XferWake(BSP_I2C_Xfer_t *pXfer);
+#endif /* BSP_USE_CMSIS_OS */
+#if (I2C_XFER_ASYNC == 1U)
+static I2C_Engine_t *I2C_GetEngine(I2C_HandleTypeDef *hi2c);
+static void     I2C_XferCpltCallback(I2C_HandleTypeDef *hi2c);
+static void     I2C_XferErrorCallback(I2C_HandleTypeDef *hi2c);
+static void     I2C_XferAbortCallback(I2C_HandleTypeDef *hi2c);
+static void     I2C_XferAbort(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer);
+#endif /* I2C_XFER_ASYNC == 1U */
 
 static uint32_t I2C_GetTiming(uint32_t clock_src_freq, uint32_t i2c_freq);
 static uint32_t I2C_Compute_SCLL_SCLH(uint32_t clock_src_freq, uint32_t I2C_speed);
@@ -218,33 +255,7 @@ int32_t BSP_I2C1_DeInit(void)
   */
 int32_t BSP_I2C1_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[0], BSP_I2C_XFER_WRITE, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length);
 }
 
 /**
@@ -257,33 +268,7 @@ int32_t BSP_I2C1_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16
   */
 int32_t BSP_I2C1_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[0], BSP_I2C_XFER_READ, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length);
 }
 
 /**
@@ -296,33 +281,7 @@ int32_t BSP_I2C1_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_
   */
 int32_t BSP_I2C1_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[0], BSP_I2C_XFER_WRITE, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length);
 }
 
 /**
@@ -335,33 +294,7 @@ int32_t BSP_I2C1_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
   */
 int32_t BSP_I2C1_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[0], BSP_I2C_XFER_READ, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length);
 }
 
 /**
@@ -373,33 +306,7 @@ int32_t BSP_I2C1_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint1
   */
 int32_t BSP_I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_Recv(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[0], BSP_I2C_XFER_RECV, DevAddr, 0U, 0U, pData, Length);
 }
 
 /**
@@ -411,33 +318,7 @@ int32_t BSP_I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C1_Send(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c1) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[0], BSP_I2C_XFER_SEND, DevAddr, 0U, 0U, pData, Length);
 }
 
 /**
@@ -449,22 +330,29 @@ int32_t BSP_I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C1_IsReady(uint16_t DevAddr, uint32_t Trials)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  return I2C_IsReady(&I2cEngine[0], DevAddr, Trials);
+}
 
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[0], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (HAL_I2C_IsDeviceReady(&hi2c1, DevAddr, Trials, 1000) != HAL_OK)
+/**
+  * @brief  Submit a transfer to the I2C1 transfer queue.
+  * @note   The transfer is executed when all previously queued transfers are completed.
+  *         In polling mode queued transfers are executed by the submitting thread,
+  *         in interrupt and DMA modes the function returns once the transfer is started.
+  *         The descriptor and data buffer must remain valid until the Status is not
+  *         BSP_ERROR_BUSY or the Callback is called.
+  * @param  pXfer  Pointer to transfer descriptor
+  * @retval BSP status
+  */
+int32_t BSP_I2C1_Submit(BSP_I2C_Xfer_t *pXfer)
+{
+  if ((pXfer == NULL) || (pXfer->Dir > BSP_I2C_XFER_RECV))
   {
-    ret = BSP_ERROR_BUSY;
+    return BSP_ERROR_WRONG_PARAM;
   }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[0]);
-#endif /* BSP_USE_CMSIS_OS */
 
-  return ret;
+  I2C_XferSubmit(&I2cEngine[0], pXfer);
+
+  return BSP_ERROR_NONE;
 }
 
 /**
@@ -496,33 +384,7 @@ int32_t BSP_I2C2_DeInit(void)
   */
 int32_t BSP_I2C2_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[1], BSP_I2C_XFER_WRITE, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length);
 }
 
 /**
@@ -535,33 +397,7 @@ int32_t BSP_I2C2_WriteReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16
   */
 int32_t BSP_I2C2_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[1], BSP_I2C_XFER_READ, DevAddr, Reg, I2C_MEMADD_SIZE_8BIT, pData, Length);
 }
 
 /**
@@ -574,33 +410,7 @@ int32_t BSP_I2C2_ReadReg(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_
   */
 int32_t BSP_I2C2_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_WriteReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[1], BSP_I2C_XFER_WRITE, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length);
 }
 
 /**
@@ -613,33 +423,7 @@ int32_t BSP_I2C2_WriteReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint
   */
 int32_t BSP_I2C2_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_ReadReg(DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[1], BSP_I2C_XFER_READ, DevAddr, Reg, I2C_MEMADD_SIZE_16BIT, pData, Length);
 }
 
 /**
@@ -651,33 +435,7 @@ int32_t BSP_I2C2_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint1
   */
 int32_t BSP_I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_Recv(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[1], BSP_I2C_XFER_RECV, DevAddr, 0U, 0U, pData, Length);
 }
 
 /**
@@ -689,33 +447,7 @@ int32_t BSP_I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
 {
-  int32_t ret;
-
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (I2C2_Send(DevAddr, pData, Length) == 0)
-  {
-    ret = BSP_ERROR_NONE;
-  }
-  else
-  {
-    if (HAL_I2C_GetError(&hi2c2) == HAL_I2C_ERROR_AF)
-    {
-      ret = BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
-    }
-    else
-    {
-      ret =  BSP_ERROR_PERIPH_FAILURE;
-    }
-  }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
-
-  return ret;
+  return I2C_Xfer(&I2cEngine[1], BSP_I2C_XFER_SEND, DevAddr, 0U, 0U, pData, Length);
 }
 
 /**
@@ -727,22 +459,29 @@ int32_t BSP_I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
   */
 int32_t BSP_I2C2_IsReady(uint16_t DevAddr, uint32_t Trials)
 {
-  int32_t ret = BSP_ERROR_NONE;
+  return I2C_IsReady(&I2cEngine[1], DevAddr, Trials);
+}
 
-#if defined(BSP_USE_CMSIS_OS)
-  /* Get semaphore to prevent multiple I2C access */
-  osSemaphoreAcquire(BspI2cSemaphore[1], osWaitForever);
-#endif /* BSP_USE_CMSIS_OS */
-  if (HAL_I2C_IsDeviceReady(&hi2c2, DevAddr, Trials, 1000) != HAL_OK)
+/**
+  * @brief  Submit a transfer to the I2C2 transfer queue.
+  * @note   The transfer is executed when all previously queued transfers are completed.
+  *         In polling mode queued transfers are executed by the submitting thread,
+  *         in interrupt and DMA modes the function returns once the transfer is started.
+  *         The descriptor and data buffer must remain valid until the Status is not
+  *         BSP_ERROR_BUSY or the Callback is called.
+  * @param  pXfer  Pointer to transfer descriptor
+  * @retval BSP status
+  */
+int32_t BSP_I2C2_Submit(BSP_I2C_Xfer_t *pXfer)
+{
+  if ((pXfer == NULL) || (pXfer->Dir > BSP_I2C_XFER_RECV))
   {
-    ret = BSP_ERROR_BUSY;
+    return BSP_ERROR_WRONG_PARAM;
   }
-#if defined(BSP_USE_CMSIS_OS)
-  /* Release semaphore to prevent multiple I2C access */
-  osSemaphoreRelease(BspI2cSemaphore[1]);
-#endif /* BSP_USE_CMSIS_OS */
 
-  return ret;
+  I2C_XferSubmit(&I2cEngine[1], pXfer);
+
+  return BSP_ERROR_NONE;
 }
 
 /**
@@ -967,148 +706,626 @@ static uint32_t I2C_Compute_SCLL_SCLH(uint32_t clock_src_freq, uint32_t I2C_spee
 }
 
 /**
-  * @brief  Write a value in a register of the device through BUS.
-  * @param  DevAddr    Device address on Bus.
-  * @param  Reg        The target register address to write
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
+  * @brief  Execute a blocking transfer through the transfer queue.
+  * @note   Not usable in interrupt context, where the queue cannot be waited for:
+  *         interrupt handlers submit their transfers with BSP_I2Cx_Submit.
+  * @param  pEng       Transfer engine
+  * @param  Dir        Transfer type
+  * @param  DevAddr    Device address on BUS
+  * @param  Reg        The target register address (register transfers)
+  * @param  MemAddSize Size of internal memory address (register transfers)
+  * @param  pData      Pointer to data buffer
   * @param  Length     data length in bytes
   * @retval BSP status
   */
-static int32_t I2C1_WriteReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static int32_t I2C_Xfer(I2C_Engine_t *pEng, uint32_t Dir, uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize,
+                        uint8_t *pData, uint16_t Length)
 {
-  if (HAL_I2C_Mem_Write(&hi2c1, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+  BSP_I2C_Xfer_t xfer;
+
+  if (__get_IPSR() != 0U)
   {
-    return BSP_ERROR_NONE;
+    return BSP_ERROR_FEATURE_NOT_SUPPORTED;
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  xfer.DevAddr    = DevAddr;
+  xfer.Reg        = Reg;
+  xfer.MemAddSize = MemAddSize;
+  xfer.Length     = Length;
+  xfer.pData      = pData;
+  xfer.Dir        = Dir;
+  I2C_XferWaitInit(&xfer);
+
+  I2C_XferSubmit(pEng, &xfer);
+  I2C_XferWait(pEng, &xfer);
+
+  return xfer.Status;
 }
 
 /**
-  * @brief  Read a register of the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  Reg        The target register address to read
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
-  * @param  Length     data length in bytes
+  * @brief  Checks if target device is ready for communication.
+  * @note   The bus is held exclusively for the blocking HAL function and released
+  *         afterwards, continuing with the transfers queued in the meantime.
+  *         Not usable in interrupt context.
+  * @param  pEng     Transfer engine
+  * @param  DevAddr  Target device address
+  * @param  Trials   Number of trials
   * @retval BSP status
   */
-static int32_t I2C1_ReadReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static int32_t I2C_IsReady(I2C_Engine_t *pEng, uint16_t DevAddr, uint32_t Trials)
 {
-  if (HAL_I2C_Mem_Read(&hi2c1, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+  BSP_I2C_Xfer_t hold;
+  int32_t        ret = BSP_ERROR_NONE;
+
+  if (__get_IPSR() != 0U)
   {
-    return BSP_ERROR_NONE;
+    return BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+
+  hold.DevAddr    = DevAddr;
+  hold.Reg        = 0U;
+  hold.MemAddSize = 0U;
+  hold.Length     = 0U;
+  hold.pData      = NULL;
+  hold.Dir        = I2C_XFER_HOLD;
+  I2C_XferWaitInit(&hold);
+
+  I2C_XferSubmit(pEng, &hold);
+  I2C_XferWait(pEng, &hold);
+  if (hold.Status != BSP_ERROR_NONE)
+  {
+    /* Bus not granted before the timeout, the hold is no longer queued */
+    return hold.Status;
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  if (HAL_I2C_IsDeviceReady(pEng->hi2c, DevAddr, Trials, 1000) != HAL_OK)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+
+  /* Release the bus without notifying the hold descriptor again */
+  hold.Callback = NULL;
+  I2C_XferRun(pEng, I2C_XferDone(pEng, BSP_ERROR_NONE));
+
+  return ret;
 }
 
 /**
-  * @brief  Receive data from the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be received
-  * @param  Length     data length in bytes
-  * @retval BSP status
+  * @brief  Append a transfer to the queue and execute it if the bus is idle.
+  * @param  pEng   Transfer engine
+  * @param  pXfer  Transfer descriptor
+  * @retval None
   */
-static int32_t I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static void I2C_XferSubmit(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer)
 {
-  if (HAL_I2C_Master_Receive(&hi2c1, DevAddr, pData, Length, 10000) == HAL_OK)
+  uint32_t primask;
+  uint32_t idle;
+
+  pXfer->Status = BSP_ERROR_BUSY;
+  pXfer->pNext  = NULL;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pEng->pTail == NULL)
   {
-    return BSP_ERROR_NONE;
+    pEng->pHead = pXfer;
+    idle = 1U;
+  }
+  else
+  {
+    pEng->pTail->pNext = pXfer;
+    idle = 0U;
   }
+  pEng->pTail = pXfer;
+  __set_PRIMASK(primask);
 
-  return BSP_ERROR_BUS_FAILURE;
+  if (idle != 0U)
+  {
+    I2C_XferRun(pEng, pXfer);
+  }
 }
 
 /**
-  * @brief  Send data to the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be sent
-  * @param  Length     data length in bytes
-  * @retval BSP status
+  * @brief  Execute queued transfers starting with the head of the queue.
+  * @note   In polling mode transfers are executed until the queue is empty or a hold is
+  *         granted. In interrupt and DMA modes the transfer is started and the queue is
+  *         continued from the completion callback.
+  * @param  pEng   Transfer engine
+  * @param  pXfer  Head of the queue (NULL if empty)
+  * @retval None
   */
-static int32_t I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static void I2C_XferRun(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer)
 {
-  if (HAL_I2C_Master_Transmit(&hi2c1, DevAddr, pData, Length, 10000) == HAL_OK)
+  int32_t status;
+
+  while (pXfer != NULL)
   {
-    return BSP_ERROR_NONE;
+    if (pXfer->Dir == I2C_XFER_HOLD)
+    {
+      /* Bus is owned by the hold until it is released */
+      I2C_XferNotify(pXfer, BSP_ERROR_NONE);
+      break;
+    }
+
+    status = I2C_XferStart(pEng, pXfer);
+    if (status == BSP_ERROR_BUSY)
+    {
+      /* Transfer in progress, queue continues from the completion callback */
+      break;
+    }
+
+    pXfer = I2C_XferDone(pEng, status);
+  }
+}
+
+/**
+  * @brief  Start the transfer at the head of the queue.
+  * @param  pEng   Transfer engine
+  * @param  pXfer  Transfer descriptor
+  * @retval BSP status (BSP_ERROR_BUSY if the transfer completes in interrupt context)
+  */
+static int32_t I2C_XferStart(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer)
+{
+  I2C_HandleTypeDef *hi2c = pEng->hi2c;
+  HAL_StatusTypeDef  status;
+#if (I2C_XFER_ASYNC == 1U)
+  uint32_t           dma;
+#endif /* I2C_XFER_ASYNC == 1U */
+
+  if (pEng->Mode == BUS_I2C_XFER_POLLING)
+  {
+    switch (pXfer->Dir)
+    {
+      case BSP_I2C_XFER_WRITE:
+        status = HAL_I2C_Mem_Write(hi2c, pXfer->DevAddr, pXfer->Reg, pXfer->MemAddSize, pXfer->pData, pXfer->Length,
+                                   BUS_I2C_POLL_TIMEOUT);
+        break;
+      case BSP_I2C_XFER_READ:
+        status = HAL_I2C_Mem_Read(hi2c, pXfer->DevAddr, pXfer->Reg, pXfer->MemAddSize, pXfer->pData, pXfer->Length,
+                                  BUS_I2C_POLL_TIMEOUT);
+        break;
+      case BSP_I2C_XFER_SEND:
+        status = HAL_I2C_Master_Transmit(hi2c, pXfer->DevAddr, pXfer->pData, pXfer->Length, BUS_I2C_POLL_TIMEOUT);
+        break;
+      default:
+        status = HAL_I2C_Master_Receive(hi2c, pXfer->DevAddr, pXfer->pData, pXfer->Length, BUS_I2C_POLL_TIMEOUT);
+        break;
+    }
+
+    return I2C_XferStatus(hi2c, status);
+  }
+
+#if (I2C_XFER_ASYNC == 1U)
+  if (pEng->CbRegistered == 0U)
+  {
+    /* Registered callbacks leave the HAL weak callbacks to other users of the handle */
+    if ((HAL_I2C_RegisterCallback(hi2c, HAL_I2C_MEM_TX_COMPLETE_CB_ID, I2C_XferCpltCallback) != HAL_OK) ||
+        (HAL_I2C_RegisterCallback(hi2c, HAL_I2C_MEM_RX_COMPLETE_CB_ID, I2C_XferCpltCallback) != HAL_OK) ||
+        (HAL_I2C_RegisterCallback(hi2c, HAL_I2C_MASTER_TX_COMPLETE_CB_ID, I2C_XferCpltCallback) != HAL_OK) ||
+        (HAL_I2C_RegisterCallback(hi2c, HAL_I2C_MASTER_RX_COMPLETE_CB_ID, I2C_XferCpltCallback) != HAL_OK) ||
+        (HAL_I2C_RegisterCallback(hi2c, HAL_I2C_ERROR_CB_ID, I2C_XferErrorCallback) != HAL_OK) ||
+        (HAL_I2C_RegisterCallback(hi2c, HAL_I2C_ABORT_CB_ID, I2C_XferAbortCallback) != HAL_OK))
+    {
+      return BSP_ERROR_PERIPH_FAILURE;
+    }
+    pEng->CbRegistered = 1U;
+  }
+
+  /* DMA mode falls back to interrupt transfers when no DMA channel is linked to the handle */
+  dma = 0U;
+  if (pEng->Mode == BUS_I2C_XFER_DMA)
+  {
+    if ((pXfer->Dir == BSP_I2C_XFER_READ) || (pXfer->Dir == BSP_I2C_XFER_RECV))
+    {
+      dma = (hi2c->hdmarx != NULL) ? 1U : 0U;
+    }
+    else
+    {
+      dma = (hi2c->hdmatx != NULL) ? 1U : 0U;
+    }
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  switch (pXfer->Dir)
+  {
+    case BSP_I2C_XFER_WRITE:
+      if (dma != 0U)
+      {
+        status = HAL_I2C_Mem_Write_DMA(hi2c, pXfer->DevAddr, pXfer->Reg, pXfer->MemAddSize, pXfer->pData, pXfer->Length);
+      }
+      else
+      {
+        status = HAL_I2C_Mem_Write_IT(hi2c, pXfer->DevAddr, pXfer->Reg, pXfer->MemAddSize, pXfer->pData, pXfer->Length);
+      }
+      break;
+    case BSP_I2C_XFER_READ:
+      if (dma != 0U)
+      {
+        status = HAL_I2C_Mem_Read_DMA(hi2c, pXfer->DevAddr, pXfer->Reg, pXfer->MemAddSize, pXfer->pData, pXfer->Length);
+      }
+      else
+      {
+        status = HAL_I2C_Mem_Read_IT(hi2c, pXfer->DevAddr, pXfer->Reg, pXfer->MemAddSize, pXfer->pData, pXfer->Length);
+      }
+      break;
+    case BSP_I2C_XFER_SEND:
+      if (dma != 0U)
+      {
+        status = HAL_I2C_Master_Transmit_DMA(hi2c, pXfer->DevAddr, pXfer->pData, pXfer->Length);
+      }
+      else
+      {
+        status = HAL_I2C_Master_Transmit_IT(hi2c, pXfer->DevAddr, pXfer->pData, pXfer->Length);
+      }
+      break;
+    default:
+      if (dma != 0U)
+      {
+        status = HAL_I2C_Master_Receive_DMA(hi2c, pXfer->DevAddr, pXfer->pData, pXfer->Length);
+      }
+      else
+      {
+        status = HAL_I2C_Master_Receive_IT(hi2c, pXfer->DevAddr, pXfer->pData, pXfer->Length);
+      }
+      break;
+  }
+
+  if (status == HAL_OK)
+  {
+    return BSP_ERROR_BUSY;
+  }
+
+  return I2C_XferStatus(hi2c, status);
+#else
+  return BSP_ERROR_FEATURE_NOT_SUPPORTED;
+#endif /* I2C_XFER_ASYNC == 1U */
 }
 
 /**
-  * @brief  Write a value in a register of the device through BUS.
-  * @param  DevAddr    Device address on Bus.
-  * @param  Reg        The target register address to write
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
-  * @param  Length     data length in bytes
-  * @retval BSP status
+  * @brief  Remove the completed transfer from the head of the queue and notify it.
+  * @param  pEng    Transfer engine
+  * @param  Status  BSP status of the completed transfer
+  * @retval New head of the queue (NULL if empty)
   */
-static int32_t I2C2_WriteReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static BSP_I2C_Xfer_t *I2C_XferDone(I2C_Engine_t *pEng, int32_t Status)
 {
-  if (HAL_I2C_Mem_Write(&hi2c2, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+  BSP_I2C_Xfer_t *pXfer;
+  BSP_I2C_Xfer_t *pNext;
+  uint32_t        primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pXfer = pEng->pHead;
+  pNext = pXfer->pNext;
+  pEng->pHead = pNext;
+  if (pNext == NULL)
   {
-    return BSP_ERROR_NONE;
+    pEng->pTail = NULL;
   }
+  pEng->pAbort = NULL;
+  __set_PRIMASK(primask);
+
+  I2C_XferNotify(pXfer, Status);
 
-  return BSP_ERROR_BUS_FAILURE;
+  return pNext;
 }
 
 /**
-  * @brief  Read a register of the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  Reg        The target register address to read
-  * @param  MemAddSize Size of internal memory address
-  * @param  pData      The target register value to be written
-  * @param  Length     data length in bytes
-  * @retval BSP status
+  * @brief  Remove a transfer from the queue before its completion (wait timeout).
+  * @note   A queued transfer is always removed. The transfer at the head of the queue
+  *         is removed only with Head set, once its HAL transfer has been aborted, and
+  *         the queue then continues with the next transfer. A removed transfer
+  *         completes with BSP_ERROR_PERIPH_FAILURE and its callback is not called.
+  * @param  pEng   Transfer engine
+  * @param  pXfer  Transfer descriptor
+  * @param  Head   Remove the transfer also when it is at the head of the queue
+  * @retval 1 if the transfer was removed, 0 if it is completed or still in progress
   */
-static int32_t I2C2_ReadReg(uint16_t DevAddr, uint16_t Reg, uint16_t MemAddSize, uint8_t *pData, uint16_t Length)
+static uint32_t I2C_XferCancel(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer, uint32_t Head)
 {
-  if (HAL_I2C_Mem_Read(&hi2c2, DevAddr, Reg, MemAddSize, pData, Length, 10000) == HAL_OK)
+  BSP_I2C_Xfer_t *pPrev;
+  BSP_I2C_Xfer_t *pNext = NULL;
+  uint32_t        removed = 0U;
+  uint32_t        head = 0U;
+  uint32_t        primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((pXfer->Status == BSP_ERROR_BUSY) && (pEng->pHead != NULL))
   {
-    return BSP_ERROR_NONE;
+    if (pEng->pHead == pXfer)
+    {
+      if ((Head != 0U) && (pXfer->Dir != I2C_XFER_HOLD))
+      {
+        pNext = pXfer->pNext;
+        pEng->pHead = pNext;
+        if (pNext == NULL)
+        {
+          pEng->pTail = NULL;
+        }
+        pEng->pAbort = NULL;
+        removed = 1U;
+        head = 1U;
+      }
+    }
+    else
+    {
+      /* Not found while it is being removed from the head by I2C_XferDone */
+      pPrev = pEng->pHead;
+      while ((pPrev->pNext != NULL) && (pPrev->pNext != pXfer))
+      {
+        pPrev = pPrev->pNext;
+      }
+      if (pPrev->pNext == pXfer)
+      {
+        pPrev->pNext = pXfer->pNext;
+        if (pEng->pTail == pXfer)
+        {
+          pEng->pTail = pPrev;
+        }
+        removed = 1U;
+      }
+    }
   }
+  __set_PRIMASK(primask);
 
-  return BSP_ERROR_BUS_FAILURE;
+  if (removed != 0U)
+  {
+    pXfer->Callback = NULL;
+    I2C_XferNotify(pXfer, BSP_ERROR_PERIPH_FAILURE);
+    if (head != 0U)
+    {
+      I2C_XferRun(pEng, pNext);
+    }
+  }
+
+  return removed;
 }
 
 /**
-  * @brief  Receive data from the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be received
-  * @param  Length     data length in bytes
+  * @brief  Set the transfer status and call the completion callback.
+  * @note   The descriptor is returned to its owner by setting the status and must not
+  *         be accessed afterwards.
+  * @param  pXfer   Transfer descriptor
+  * @param  Status  BSP status
+  * @retval None
+  */
+static void I2C_XferNotify(BSP_I2C_Xfer_t *pXfer, int32_t Status)
+{
+  BSP_I2C_XferCb_t callback = pXfer->Callback;
+
+  pXfer->Status = Status;
+  if (callback != NULL)
+  {
+    callback(pXfer);
+  }
+}
+
+/**
+  * @brief  Convert HAL status of a transfer to BSP status.
+  * @param  hi2c    I2C handle
+  * @param  Status  HAL status
   * @retval BSP status
   */
-static int32_t I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static int32_t I2C_XferStatus(I2C_HandleTypeDef *hi2c, HAL_StatusTypeDef Status)
 {
-  if (HAL_I2C_Master_Receive(&hi2c2, DevAddr, pData, Length, 10000) == HAL_OK)
+  if (Status == HAL_OK)
   {
     return BSP_ERROR_NONE;
   }
 
-  return BSP_ERROR_BUS_FAILURE;
+  if (HAL_I2C_GetError(hi2c) == HAL_I2C_ERROR_AF)
+  {
+    return BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE;
+  }
+
+  return BSP_ERROR_PERIPH_FAILURE;
 }
 
 /**
-  * @brief  Send data to the device through BUS
-  * @param  DevAddr    Device address on BUS
-  * @param  pData      The target register value to be sent
-  * @param  Length     data length in bytes
-  * @retval BSP status
+  * @brief  Prepare a transfer descriptor for a blocking wait.
+  * @note   With a running kernel the waiting thread is suspended until the transfer
+  *         completes, otherwise the transfer status is polled.
+  * @param  pXfer  Transfer descriptor
+  * @retval None
   */
-static int32_t I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length)
+static void I2C_XferWaitInit(BSP_I2C_Xfer_t *pXfer)
 {
-  if (HAL_I2C_Master_Transmit(&hi2c2, DevAddr, pData, Length, 10000) == HAL_OK)
+  pXfer->Callback = NULL;
+  pXfer->pUser    = NULL;
+#if defined(BSP_USE_CMSIS_OS)
+  if ((osKernelGetState() == osKernelRunning) && (__get_IPSR() == 0U))
   {
-    return BSP_ERROR_NONE;
+    pXfer->Callback = I2C_XferWake;
+    pXfer->pUser    = osThreadGetId();
   }
+#endif /* BSP_USE_CMSIS_OS */
+}
 
-  return BSP_ERROR_BUS_FAILURE;
+/**
+  * @brief  Wait for completion of a transfer prepared with I2C_XferWaitInit.
+  * @note   After BUS_I2C_POLL_TIMEOUT a transfer still queued is removed. A transfer in
+  *         progress is aborted in interrupt and DMA modes and removed if the abort does
+  *         not complete within another BUS_I2C_POLL_TIMEOUT. In polling mode the
+  *         transfer in progress is bounded by the HAL timeout of the executing thread.
+  * @param  pEng   Transfer engine
+  * @param  pXfer  Transfer descriptor
+  * @retval None
+  */
+static void I2C_XferWait(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer)
+{
+  if (I2C_XferWaitTimeout(pXfer, BUS_I2C_POLL_TIMEOUT) != 0U)
+  {
+    return;
+  }
+
+  if (I2C_XferCancel(pEng, pXfer, 0U) != 0U)
+  {
+    return;
+  }
+
+#if (I2C_XFER_ASYNC == 1U)
+  if (pEng->Mode != BUS_I2C_XFER_POLLING)
+  {
+    I2C_XferAbort(pEng, pXfer);
+    if (I2C_XferWaitTimeout(pXfer, BUS_I2C_POLL_TIMEOUT) != 0U)
+    {
+      return;
+    }
+
+    if (I2C_XferCancel(pEng, pXfer, 1U) != 0U)
+    {
+      return;
+    }
+  }
+#endif /* I2C_XFER_ASYNC == 1U */
+
+  /* Completion is in progress in another context */
+  (void)I2C_XferWaitTimeout(pXfer, HAL_MAX_DELAY);
+}
+
+/**
+  * @brief  Wait for completion of a transfer with a timeout.
+  * @note   pUser is still set when the transfer completes in interrupt context or in
+  *         another thread, the thread flag is then consumed exactly once.
+  * @param  pXfer    Transfer descriptor
+  * @param  Timeout  Timeout in ms (HAL_MAX_DELAY = wait forever)
+  * @retval 1 if the transfer is completed, 0 on timeout
+  */
+static uint32_t I2C_XferWaitTimeout(BSP_I2C_Xfer_t *pXfer, uint32_t Timeout)
+{
+  uint32_t tickstart;
+
+#if defined(BSP_USE_CMSIS_OS)
+  if (pXfer->pUser != NULL)
+  {
+    uint32_t ticks = osWaitForever;
+
+    if (Timeout != HAL_MAX_DELAY)
+    {
+      ticks = (uint32_t)(((uint64_t)Timeout * osKernelGetTickFreq()) / 1000U);
+    }
+    /* The flag is set after the Status, the descriptor is released only with the flag */
+    return ((osThreadFlagsWait(BUS_I2C_XFER_THREAD_FLAG, osFlagsWaitAny, ticks) & osFlagsError) == 0U) ? 1U : 0U;
+  }
+#endif /* BSP_USE_CMSIS_OS */
+
+  tickstart = HAL_GetTick();
+  while (pXfer->Status == BSP_ERROR_BUSY)
+  {
+    if ((Timeout != HAL_MAX_DELAY) && ((HAL_GetTick() - tickstart) > Timeout))
+    {
+      return 0U;
+    }
+  }
+
+  return 1U;
+}
+
+#if defined(BSP_USE_CMSIS_OS)
+/**
+  * @brief  Wake up the thread waiting for a transfer.
+  * @note   A transfer completed by the waiting thread itself (polling mode) only clears
+  *         pUser, no thread flag is left pending. Otherwise reading pUser is the last
+  *         access to the descriptor which may be released once the flag is set.
+  * @param  pXfer  Transfer descriptor
+  * @retval None
+  */
+static void I2C_XferWake(BSP_I2C_Xfer_t *pXfer)
+{
+  osThreadId_t thread_id = (osThreadId_t)pXfer->pUser;
+
+  if ((__get_IPSR() == 0U) && (thread_id == osThreadGetId()))
+  {
+    pXfer->pUser = NULL;
+  }
+  else
+  {
+    (void)osThreadFlagsSet(thread_id, BUS_I2C_XFER_THREAD_FLAG);
+  }
+}
+#endif /* BSP_USE_CMSIS_OS */
+
+#if (I2C_XFER_ASYNC == 1U)
+/**
+  * @brief  Get the transfer engine of an I2C handle.
+  * @param  hi2c  I2C handle
+  * @retval Transfer engine
+  */
+static I2C_Engine_t *I2C_GetEngine(I2C_HandleTypeDef *hi2c)
+{
+  return (hi2c == I2cEngine[0].hi2c) ? &I2cEngine[0] : &I2cEngine[1];
+}
+
+/**
+  * @brief  Transfer complete callback (interrupt and DMA modes).
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+static void I2C_XferCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_Engine_t *pEng = I2C_GetEngine(hi2c);
+
+  if ((pEng->pHead != NULL) && (pEng->pHead->Dir != I2C_XFER_HOLD))
+  {
+    I2C_XferRun(pEng, I2C_XferDone(pEng, BSP_ERROR_NONE));
+  }
+}
+
+/**
+  * @brief  Transfer error callback (interrupt and DMA modes).
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+static void I2C_XferErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_Engine_t *pEng = I2C_GetEngine(hi2c);
+
+  if ((pEng->pHead != NULL) && (pEng->pHead->Dir != I2C_XFER_HOLD))
+  {
+    I2C_XferRun(pEng, I2C_XferDone(pEng, I2C_XferStatus(hi2c, HAL_ERROR)));
+  }
+}
+
+/**
+  * @brief  Transfer abort callback (interrupt and DMA modes).
+  * @note   Only completes the transfer aborted by I2C_XferAbort, if still at the head.
+  * @param  hi2c  I2C handle
+  * @retval None
+  */
+static void I2C_XferAbortCallback(I2C_HandleTypeDef *hi2c)
+{
+  I2C_Engine_t *pEng = I2C_GetEngine(hi2c);
+
+  if ((pEng->pHead != NULL) && (pEng->pHead == pEng->pAbort))
+  {
+    I2C_XferRun(pEng, I2C_XferDone(pEng, BSP_ERROR_PERIPH_FAILURE));
+  }
+}
+
+/**
+  * @brief  Abort the HAL transfer of a transfer in progress (wait timeout).
+  * @note   Interrupts are disabled so that the transfer cannot complete and the next
+  *         one start between the check and the abort request.
+  * @param  pEng   Transfer engine
+  * @param  pXfer  Transfer descriptor
+  * @retval None
+  */
+static void I2C_XferAbort(I2C_Engine_t *pEng, BSP_I2C_Xfer_t *pXfer)
+{
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if ((pXfer->Status == BSP_ERROR_BUSY) && (pEng->pHead == pXfer) && (pXfer->Dir != I2C_XFER_HOLD))
+  {
+    if (HAL_I2C_Master_Abort_IT(pEng->hi2c, pXfer->DevAddr) == HAL_OK)
+    {
+      pEng->pAbort = pXfer;
+    }
+  }
+  __set_PRIMASK(primask);
 }
+#endif /* I2C_XFER_ASYNC == 1U */
 
 /**
   * @}
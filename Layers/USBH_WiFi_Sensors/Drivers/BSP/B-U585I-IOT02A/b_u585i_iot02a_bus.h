@@ -56,6 +56,26 @@ typedef struct
 } BSP_I2C_Cb_t;
 #endif /* (USE_HAL_I2C_REGISTER_CALLBACKS > 0) */
 
+typedef struct BSP_I2C_Xfer_s BSP_I2C_Xfer_t;
+
+/* Transfer completion callback, called from interrupt context in interrupt and DMA modes */
+typedef void (*BSP_I2C_XferCb_t)(BSP_I2C_Xfer_t *pXfer);
+
+/* Transfer descriptor, owned by the transfer queue from submission until completion */
+struct BSP_I2C_Xfer_s
+{
+  uint16_t          DevAddr;     /* Device address on BUS */
+  uint16_t          Reg;         /* Register address (register transfers) */
+  uint16_t          MemAddSize;  /* Register address size: I2C_MEMADD_SIZE_8BIT or I2C_MEMADD_SIZE_16BIT */
+  uint16_t          Length;      /* Length of the data */
+  uint8_t          *pData;       /* Pointer to data buffer */
+  uint32_t          Dir;         /* Transfer type: BSP_I2C_XFER_WRITE, _READ, _SEND or _RECV */
+  BSP_I2C_XferCb_t  Callback;    /* Completion callback (NULL = none, completion is polled on Status) */
+  void             *pUser;       /* User context */
+  volatile int32_t  Status;      /* BSP_ERROR_BUSY until completed, then BSP status */
+  BSP_I2C_Xfer_t   *pNext;       /* Next queued transfer (used by the transfer queue) */
+};
+
 /**
   * @}
   */
@@ -118,6 +138,38 @@ typedef struct
 #define BUS_I2C2_FREQUENCY  400000U /* Frequency of I2C2 = 400 KHz*/
 #endif /* BUS_I2C2_FREQUENCY */
 
+/* I2C transfer modes */
+#define BUS_I2C_XFER_POLLING                   0U    /* Blocking HAL transfers in the submitting thread */
+#define BUS_I2C_XFER_IT                        1U    /* Interrupt driven transfers */
+#define BUS_I2C_XFER_DMA                       2U    /* DMA transfers (interrupt driven if no DMA channel is linked) */
+
+#ifndef BUS_I2C1_XFER_MODE
+#define BUS_I2C1_XFER_MODE                     BUS_I2C_XFER_POLLING
+#endif /* BUS_I2C1_XFER_MODE */
+
+/* I2C2 stays on polling by default: the CubeMX configuration of the layers enables neither the
+   I2C2 event/error interrupts nor USE_HAL_I2C_REGISTER_CALLBACKS */
+#ifndef BUS_I2C2_XFER_MODE
+#define BUS_I2C2_XFER_MODE                     BUS_I2C_XFER_POLLING
+#endif /* BUS_I2C2_XFER_MODE */
+
+/* Timeout in ms of the HAL transfers in polling mode and of the blocking functions
+   waiting for a queued transfer (the transfer is then removed or aborted) */
+#ifndef BUS_I2C_POLL_TIMEOUT
+#define BUS_I2C_POLL_TIMEOUT                   10000U
+#endif /* BUS_I2C_POLL_TIMEOUT */
+
+/* Thread flag used by blocking functions to wait for transfer completion */
+#ifndef BUS_I2C_XFER_THREAD_FLAG
+#define BUS_I2C_XFER_THREAD_FLAG               0x40000000U
+#endif /* BUS_I2C_XFER_THREAD_FLAG */
+
+/* I2C transfer types */
+#define BSP_I2C_XFER_WRITE                     0U    /* Write register */
+#define BSP_I2C_XFER_READ                      1U    /* Read register */
+#define BSP_I2C_XFER_SEND                      2U    /* Send data */
+#define BSP_I2C_XFER_RECV                      3U    /* Receive data */
+
 /**
   * @}
   */
@@ -143,6 +195,7 @@ int32_t BSP_I2C1_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint1
 int32_t BSP_I2C1_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C1_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C1_IsReady(uint16_t DevAddr, uint32_t Trials);
+int32_t BSP_I2C1_Submit(BSP_I2C_Xfer_t *pXfer);
 
 int32_t BSP_I2C2_Init(void);
 int32_t BSP_I2C2_DeInit(void);
@@ -153,6 +206,7 @@ int32_t BSP_I2C2_ReadReg16(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint1
 int32_t BSP_I2C2_Recv(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C2_Send(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
 int32_t BSP_I2C2_IsReady(uint16_t DevAddr, uint32_t Trials);
+int32_t BSP_I2C2_Submit(BSP_I2C_Xfer_t *pXfer);
 int32_t BSP_GetTick(void);
 
 #if (USE_HAL_I2C_REGISTER_CALLBACKS > 0)
@@ -61,10 +61,22 @@ extern "C" {
 /* CAMERA interrupt priority */
 #define BSP_CAMERA_IT_PRIORITY        14U  /* Default is lowest priority level */
 
+/* Motion sensor FIFO interrupt priority */
+#define BSP_MOTION_SENSOR_IT_PRIORITY 15U  /* Default is lowest priority level */
+
+/* Ranging sensor interrupt priority */
+#define BSP_RANGING_SENSOR_IT_PRIORITY 15U  /* Default is lowest priority level */
+
 /* I2C1 and I2C2 Frequencies in Hz  */
 #define BUS_I2C1_FREQUENCY                   100000UL /* Frequency of I2C1 = 100 KHz*/
 #define BUS_I2C2_FREQUENCY                   100000UL /* Frequency of I2C2 = 100 KHz*/
 
+/* I2C1 and I2C2 transfer modes: 0 = polling, 1 = interrupt, 2 = DMA
+   Interrupt and DMA modes require USE_HAL_I2C_REGISTER_CALLBACKS set to 1 and the I2C event and
+   error interrupts (and DMA channels for DMA mode) enabled in the CubeMX configuration */
+#define BUS_I2C1_XFER_MODE                   0U
+#define BUS_I2C2_XFER_MODE                   0U
+
 /* Usage of USBPD PWR TRACE system */
 #define USE_BSP_USBPD_PWR_TRACE       0U      /* USBPD BSP trace system is disabled */
 
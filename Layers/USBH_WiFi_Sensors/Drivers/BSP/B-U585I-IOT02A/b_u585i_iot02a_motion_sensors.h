@@ -81,6 +81,48 @@ typedef struct
 {
   uint32_t Functions;
 } MOTION_SENSOR_Ctx_t;
+
+/* Maximum number of FIFO words read in one burst, and size of a FIFO block */
+#ifndef MOTION_SENSOR_FIFO_BLOCK_WORDS
+#define MOTION_SENSOR_FIFO_BLOCK_WORDS   64U
+#endif
+
+/* Number of FIFO blocks in the ring buffer */
+#ifndef MOTION_SENSOR_FIFO_BLOCKS_NBR
+#define MOTION_SENSOR_FIFO_BLOCKS_NBR    4U
+#endif
+
+/* Motion sensor FIFO streaming configuration (instance 0 only) */
+typedef struct
+{
+  float_t  AccBdr;          /*!< Accelerometer batch data rate in Hz, 0 to exclude it from the FIFO */
+  float_t  GyroBdr;         /*!< Gyroscope batch data rate in Hz, 0 to exclude it from the FIFO */
+  uint16_t Watermark;       /*!< FIFO watermark in words, 1 to MOTION_SENSOR_FIFO_BLOCK_WORDS */
+  uint8_t  IntPin;          /*!< MOTION_SENSOR_FIFO_INT1 or MOTION_SENSOR_FIFO_INT2 */
+} MOTION_SENSOR_FifoConfig_t;
+
+/* Motion sensor FIFO block, filled by one burst read of the FIFO */
+typedef struct
+{
+  uint32_t                    Timestamp;  /*!< Tick of the watermark event, in ms */
+  uint32_t                    Sequence;   /*!< Block sequence number */
+  uint16_t                    AccNbr;     /*!< Number of accelerometer samples */
+  uint16_t                    GyroNbr;    /*!< Number of gyroscope samples */
+  BSP_MOTION_SENSOR_AxesRaw_t Acc[MOTION_SENSOR_FIFO_BLOCK_WORDS];
+  BSP_MOTION_SENSOR_AxesRaw_t Gyro[MOTION_SENSOR_FIFO_BLOCK_WORDS];
+} MOTION_SENSOR_FifoBlock_t;
+
+/* Motion sensor FIFO streaming statistics */
+typedef struct
+{
+  uint32_t AccSamples;      /*!< Accelerometer samples read from the FIFO */
+  uint32_t GyroSamples;     /*!< Gyroscope samples read from the FIFO */
+  uint32_t AccRate;         /*!< Sustained accelerometer rate in samples/s */
+  uint32_t GyroRate;        /*!< Sustained gyroscope rate in samples/s */
+  uint32_t Dropped;         /*!< Samples discarded because the block ring was full */
+  uint32_t Overruns;        /*!< FIFO overruns reported by the sensor (samples lost in the sensor) */
+  uint32_t Bursts;          /*!< FIFO burst reads */
+} MOTION_SENSOR_FifoStats_t;
 /**
   * @}
   */
@@ -99,6 +141,17 @@ typedef struct
 #define MOTION_GYRO             1U
 #define MOTION_ACCELERO         2U
 #define MOTION_MAGNETO          4U
+
+/* FIFO streaming interrupt pins of the ISM330DHCX */
+#define MOTION_SENSOR_FIFO_INT1          1U
+#define MOTION_SENSOR_FIFO_INT2          2U
+
+/* ISM330DHCX INT1 pin (only INT1 is connected to the MCU) */
+#define MOTION_SENSOR_INT1_PIN                 GPIO_PIN_11
+#define MOTION_SENSOR_INT1_GPIO_PORT           GPIOE
+#define MOTION_SENSOR_INT1_GPIO_CLK_ENABLE()   __HAL_RCC_GPIOE_CLK_ENABLE()
+#define MOTION_SENSOR_INT1_EXTI_IRQn           EXTI11_IRQn
+#define MOTION_SENSOR_INT1_EXTI_LINE           EXTI_LINE_11
 /**
   * @}
   */
@@ -130,6 +183,15 @@ int32_t BSP_MOTION_SENSOR_GetOutputDataRate(uint32_t Instance, uint32_t Function
 int32_t BSP_MOTION_SENSOR_SetOutputDataRate(uint32_t Instance, uint32_t Function, float_t Odr);
 int32_t BSP_MOTION_SENSOR_GetFullScale(uint32_t Instance, uint32_t Function, int32_t *Fullscale);
 int32_t BSP_MOTION_SENSOR_SetFullScale(uint32_t Instance, uint32_t Function, int32_t Fullscale);
+
+int32_t BSP_MOTION_SENSOR_FIFO_Start(uint32_t Instance, const MOTION_SENSOR_FifoConfig_t *pConfig);
+int32_t BSP_MOTION_SENSOR_FIFO_Stop(uint32_t Instance);
+int32_t BSP_MOTION_SENSOR_FIFO_Drain(uint32_t Instance);
+int32_t BSP_MOTION_SENSOR_FIFO_GetBlock(uint32_t Instance, MOTION_SENSOR_FifoBlock_t **pBlock);
+int32_t BSP_MOTION_SENSOR_FIFO_ReleaseBlock(uint32_t Instance);
+int32_t BSP_MOTION_SENSOR_FIFO_GetStats(uint32_t Instance, MOTION_SENSOR_FifoStats_t *pStats);
+void    BSP_MOTION_SENSOR_FIFO_IRQHandler(uint32_t Instance);
+void    BSP_MOTION_SENSOR_FIFO_Callback(uint32_t Instance);
 /**
   * @}
   */
@@ -24,6 +24,7 @@
 
 #include "b_u585i_iot02a_ranging_sensor.h"
 #include "b_u585i_iot02a_bus.h"
+#include <string.h>
 
 /** @addtogroup BSP
   * @{
@@ -37,6 +38,35 @@
   * @{
   */
 
+/** @defgroup B_U585I_IOT02A_RANGING_SENSOR_Private_Defines RANGING SENSOR Private Defines
+  * @{
+  */
+#define RS_IT_OCCUPANCY_PERIOD   1000U   /* Bus occupancy measurement period in ms */
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_RANGING_SENSOR_Private_Types RANGING SENSOR Private Types
+  * @{
+  */
+typedef struct
+{
+  uint8_t                  Started;
+  volatile uint8_t         Front;          /* Index of the published frame */
+  volatile uint8_t         IrqPending;
+  volatile uint32_t        IrqTick;
+  volatile uint32_t        Sequence[2];    /* 0 while the frame is not valid */
+  uint32_t                 Timestamp[2];
+  uint32_t                 LastSequence;
+  uint32_t                 WindowTick;
+  uint32_t                 WindowBusTime;
+  RANGING_SENSOR_ITStats_t Stats;
+  RANGING_SENSOR_Result_t  Result[2];
+} RANGING_SENSOR_ITCtx_t;
+/**
+  * @}
+  */
+
 /** @defgroup B_U585I_IOT02A_RANGING_SENSOR_Exported_Variables RANGING SENSOR Exported Variables
   * @{
   */
@@ -50,6 +80,8 @@ void *VL53L5A1_RANGING_SENSOR_CompObj[RANGING_SENSOR_INSTANCES_NBR] = {0};
   */
 static RANGING_SENSOR_Drv_t *VL53L5A1_RANGING_SENSOR_Drv = NULL;
 static RANGING_SENSOR_Capabilities_t VL53L5A1_RANGING_SENSOR_Cap;
+static RANGING_SENSOR_ITCtx_t RangingSensorIT;
+static EXTI_HandleTypeDef hrs_exti;
 /**
   * @}
   */
@@ -59,6 +91,9 @@ static RANGING_SENSOR_Capabilities_t VL53L5A1_RANGING_SENSOR_Cap;
   */
 static int32_t VL53L5CX_Probe(uint32_t Instance);
 static int32_t vl53l5cx_i2c_recover(void);
+static int32_t RANGING_SENSOR_StartIT(uint32_t Instance);
+static void RANGING_SENSOR_StopIT(void);
+static void RANGING_SENSOR_EXTI_Callback(void);
 /**
   * @}
   */
@@ -281,6 +316,10 @@ int32_t BSP_RANGING_SENSOR_GetDistance(const uint32_t Instance, RANGING_SENSOR_R
   * @brief Start ranging.
   * @param Instance    Ranging sensor instance.
   * @param Mode        The desired ranging mode
+  * @note  In RS_MODE_IT_CONTINUOUS mode (center device only), the sensor interrupt
+  *        pin is configured as EXTI line and BSP_RANGING_SENSOR_IRQHandler() must be
+  *        called from the EXTI5 interrupt handler. Frames are then read with
+  *        BSP_RANGING_SENSOR_Process() and retrieved with BSP_RANGING_SENSOR_GetFrame().
   * @retval BSP status
   */
 int32_t BSP_RANGING_SENSOR_Start(uint32_t Instance, uint32_t Mode)
@@ -291,6 +330,10 @@ int32_t BSP_RANGING_SENSOR_Start(uint32_t Instance, uint32_t Mode)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
+  else if (Mode == RS_MODE_IT_CONTINUOUS)
+  {
+    ret = RANGING_SENSOR_StartIT(Instance);
+  }
   else if (VL53L5A1_RANGING_SENSOR_Drv->Start(VL53L5A1_RANGING_SENSOR_CompObj[Instance], Mode) < 0)
   {
     ret = BSP_ERROR_COMPONENT_FAILURE;
@@ -316,13 +359,21 @@ int32_t BSP_RANGING_SENSOR_Stop(uint32_t Instance)
   {
     ret = BSP_ERROR_WRONG_PARAM;
   }
-  else if (VL53L5A1_RANGING_SENSOR_Drv->Stop(VL53L5A1_RANGING_SENSOR_CompObj[Instance]) < 0)
-  {
-    ret = BSP_ERROR_COMPONENT_FAILURE;
-  }
   else
   {
-    ret = BSP_ERROR_NONE;
+    if ((Instance == VL53L5A1_DEV_CENTER) && (RangingSensorIT.Started != 0U))
+    {
+      RANGING_SENSOR_StopIT();
+    }
+
+    if (VL53L5A1_RANGING_SENSOR_Drv->Stop(VL53L5A1_RANGING_SENSOR_CompObj[Instance]) < 0)
+    {
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
   }
 
   return ret;
@@ -461,6 +512,187 @@ int32_t BSP_RANGING_SENSOR_XTalkCalibration(uint32_t Instance, uint16_t Reflecta
 
   return ret;
 }
+
+/**
+  * @brief Read the pending frame in RS_MODE_IT_CONTINUOUS mode.
+  * @param Instance    Ranging sensor instance.
+  * @note This function must be called from thread context, typically after
+  *       BSP_RANGING_SENSOR_Callback() has signaled a data ready interrupt.
+  *       The frame is read in the back buffer and published when complete.
+  * @retval BSP status
+  */
+int32_t BSP_RANGING_SENSOR_Process(uint32_t Instance)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint8_t back;
+  uint32_t irq_tick;
+  uint32_t tick_start;
+  uint32_t tick;
+  uint32_t elapsed;
+
+  if (Instance >= RANGING_SENSOR_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if ((Instance != VL53L5A1_DEV_CENTER) || (RangingSensorIT.Started == 0U))
+  {
+    ret = BSP_ERROR_NO_INIT;
+  }
+  else if (RangingSensorIT.IrqPending == 0U)
+  {
+    /* No frame ready */
+  }
+  else
+  {
+    RangingSensorIT.IrqPending = 0U;
+    irq_tick = RangingSensorIT.IrqTick;
+    back = 1U - RangingSensorIT.Front;
+
+    /* Read the frame in the back buffer */
+    RangingSensorIT.Sequence[back] = 0U;
+    tick_start = HAL_GetTick();
+    if (VL53L5A1_RANGING_SENSOR_Drv->GetDistance(VL53L5A1_RANGING_SENSOR_CompObj[Instance],
+                                                 &RangingSensorIT.Result[back]) < 0)
+    {
+      RangingSensorIT.Stats.Errors++;
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    tick = HAL_GetTick();
+
+    RangingSensorIT.Stats.LastBusTime = tick - tick_start;
+    RangingSensorIT.Stats.BusTime += RangingSensorIT.Stats.LastBusTime;
+
+    if (ret == BSP_ERROR_NONE)
+    {
+      /* Publish the frame */
+      RangingSensorIT.LastSequence++;
+      RangingSensorIT.Timestamp[back] = irq_tick;
+      __DMB();
+      RangingSensorIT.Sequence[back] = RangingSensorIT.LastSequence;
+      RangingSensorIT.Front = back;
+
+      RangingSensorIT.Stats.Frames++;
+      RangingSensorIT.Stats.LastLatency = tick - irq_tick;
+      if (RangingSensorIT.Stats.LastLatency > RangingSensorIT.Stats.MaxLatency)
+      {
+        RangingSensorIT.Stats.MaxLatency = RangingSensorIT.Stats.LastLatency;
+      }
+    }
+
+    /* Update the bus occupancy */
+    elapsed = tick - RangingSensorIT.WindowTick;
+    if (elapsed >= RS_IT_OCCUPANCY_PERIOD)
+    {
+      RangingSensorIT.Stats.BusOccupancy = ((RangingSensorIT.Stats.BusTime - RangingSensorIT.WindowBusTime) * 1000U)
+                                           / elapsed;
+      RangingSensorIT.WindowTick = tick;
+      RangingSensorIT.WindowBusTime = RangingSensorIT.Stats.BusTime;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief Get the last frame published in RS_MODE_IT_CONTINUOUS mode.
+  * @param Instance    Ranging sensor instance.
+  * @param pFrame    Pointer to the frame struct.
+  * @retval BSP status (BSP_ERROR_BUSY if no frame has been published yet)
+  */
+int32_t BSP_RANGING_SENSOR_GetFrame(uint32_t Instance, RANGING_SENSOR_Frame_t *pFrame)
+{
+  int32_t ret = BSP_ERROR_NONE;
+  uint8_t front;
+  uint32_t sequence;
+
+  if ((Instance >= RANGING_SENSOR_INSTANCES_NBR) || (pFrame == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != VL53L5A1_DEV_CENTER)
+  {
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else
+  {
+    /* Copy again if the buffer has been reused meanwhile */
+    do
+    {
+      front = RangingSensorIT.Front;
+      sequence = RangingSensorIT.Sequence[front];
+      __DMB();
+      pFrame->Timestamp = RangingSensorIT.Timestamp[front];
+      pFrame->Result = RangingSensorIT.Result[front];
+      __DMB();
+    } while ((sequence != 0U) && (sequence != RangingSensorIT.Sequence[front]));
+
+    if (sequence == 0U)
+    {
+      ret = BSP_ERROR_BUSY;
+    }
+    else
+    {
+      pFrame->Sequence = sequence;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief Get the RS_MODE_IT_CONTINUOUS mode statistics.
+  * @param Instance    Ranging sensor instance.
+  * @param pStats    Pointer to the statistics struct.
+  * @retval BSP status
+  */
+int32_t BSP_RANGING_SENSOR_GetITStats(uint32_t Instance, RANGING_SENSOR_ITStats_t *pStats)
+{
+  int32_t ret;
+
+  if ((Instance >= RANGING_SENSOR_INSTANCES_NBR) || (pStats == NULL))
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else if (Instance != VL53L5A1_DEV_CENTER)
+  {
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else
+  {
+    *pStats = RangingSensorIT.Stats;
+    ret = BSP_ERROR_NONE;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief This function handles the ranging sensor interrupt requests.
+  * @param Instance    Ranging sensor instance.
+  * @retval None
+  */
+void BSP_RANGING_SENSOR_IRQHandler(uint32_t Instance)
+{
+  if (Instance == VL53L5A1_DEV_CENTER)
+  {
+    HAL_EXTI_IRQHandler(&hrs_exti);
+  }
+}
+
+/**
+  * @brief BSP ranging sensor data ready callback.
+  * @param Instance    Ranging sensor instance.
+  * @note Called in interrupt context: the application should signal a thread
+  *       which then calls BSP_RANGING_SENSOR_Process().
+  * @retval None
+  */
+__weak void BSP_RANGING_SENSOR_Callback(uint32_t Instance)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(Instance);
+  /* This function should be implemented by the user application.
+     It is called into this driver when a new frame is ready. */
+}
 /**
   * @}
   */
@@ -584,6 +816,104 @@ static int32_t vl53l5cx_i2c_recover(void)
   return BSP_ERROR_NONE;
 }
 
+/**
+  * @brief Start continuous ranging with frames read on sensor interrupt.
+  * @param Instance    Ranging sensor instance.
+  * @retval BSP status
+  */
+static int32_t RANGING_SENSOR_StartIT(uint32_t Instance)
+{
+  int32_t ret;
+  GPIO_InitTypeDef GPIO_InitStruct;
+
+  if (Instance != VL53L5A1_DEV_CENTER)
+  {
+    /* Only the interrupt pin of the center device is connected */
+    ret = BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+  else if (RangingSensorIT.Started != 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+  else
+  {
+    /* Reset the frame slots and the statistics */
+    RangingSensorIT.Front = 0U;
+    RangingSensorIT.IrqPending = 0U;
+    RangingSensorIT.Sequence[0] = 0U;
+    RangingSensorIT.Sequence[1] = 0U;
+    RangingSensorIT.LastSequence = 0U;
+    RangingSensorIT.WindowTick = HAL_GetTick();
+    RangingSensorIT.WindowBusTime = 0U;
+    (void)memset(&RangingSensorIT.Stats, 0, sizeof(RangingSensorIT.Stats));
+
+    /* Configure the interrupt pin (active low) as input with external interrupt */
+    VL53L5A1_INT_GPIO_CLK_ENABLE();
+    GPIO_InitStruct.Pin = VL53L5A1_INT_PIN;
+    GPIO_InitStruct.Mode = GPIO_MODE_IT_FALLING;
+    GPIO_InitStruct.Pull = GPIO_NOPULL;
+    GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+    HAL_GPIO_Init(VL53L5A1_INT_PORT, &GPIO_InitStruct);
+
+    (void)HAL_EXTI_GetHandle(&hrs_exti, VL53L5A1_INT_EXTI_LINE);
+    (void)HAL_EXTI_RegisterCallback(&hrs_exti, HAL_EXTI_COMMON_CB_ID, RANGING_SENSOR_EXTI_Callback);
+
+    RangingSensorIT.Started = 1U;
+    HAL_NVIC_SetPriority(VL53L5A1_INT_EXTI_IRQn, BSP_RANGING_SENSOR_IT_PRIORITY, 0x00);
+    HAL_NVIC_EnableIRQ(VL53L5A1_INT_EXTI_IRQn);
+
+    /* The component does not wait for data, frames are read on interrupt only */
+    if (VL53L5A1_RANGING_SENSOR_Drv->Start(VL53L5A1_RANGING_SENSOR_CompObj[Instance], RS_MODE_ASYNC_CONTINUOUS) < 0)
+    {
+      RANGING_SENSOR_StopIT();
+      ret = BSP_ERROR_COMPONENT_FAILURE;
+    }
+    else
+    {
+      ret = BSP_ERROR_NONE;
+    }
+  }
+
+  return ret;
+}
+
+/**
+  * @brief Disable the sensor interrupt of the RS_MODE_IT_CONTINUOUS mode.
+  * @retval None
+  */
+static void RANGING_SENSOR_StopIT(void)
+{
+  GPIO_InitTypeDef GPIO_InitStruct;
+
+  HAL_NVIC_DisableIRQ(VL53L5A1_INT_EXTI_IRQn);
+
+  /* Restore the interrupt pin as simple input */
+  GPIO_InitStruct.Pin = VL53L5A1_INT_PIN;
+  GPIO_InitStruct.Mode = GPIO_MODE_INPUT;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  GPIO_InitStruct.Speed = GPIO_SPEED_FREQ_LOW;
+  HAL_GPIO_Init(VL53L5A1_INT_PORT, &GPIO_InitStruct);
+
+  RangingSensorIT.Started = 0U;
+  RangingSensorIT.IrqPending = 0U;
+}
+
+/**
+  * @brief Ranging sensor EXTI line detection callback.
+  * @retval None
+  */
+static void RANGING_SENSOR_EXTI_Callback(void)
+{
+  if (RangingSensorIT.IrqPending != 0U)
+  {
+    /* The previous frame has not been read and is overwritten by the sensor */
+    RangingSensorIT.Stats.Overruns++;
+  }
+  RangingSensorIT.IrqTick = HAL_GetTick();
+  RangingSensorIT.IrqPending = 1U;
+  BSP_RANGING_SENSOR_Callback(VL53L5A1_DEV_CENTER);
+}
+
 /**
   * @}
   */
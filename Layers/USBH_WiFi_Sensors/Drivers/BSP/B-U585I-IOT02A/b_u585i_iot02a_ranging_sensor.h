@@ -71,6 +71,7 @@ extern "C" {
 #define RS_MODE_BLOCKING_ONESHOT           (VL53L5CX_MODE_BLOCKING_ONESHOT)
 #define RS_MODE_ASYNC_CONTINUOUS           (VL53L5CX_MODE_ASYNC_CONTINUOUS)
 #define RS_MODE_ASYNC_ONESHOT              (VL53L5CX_MODE_ASYNC_ONESHOT)
+#define RS_MODE_IT_CONTINUOUS              (0x10U) /*!< Continuous ranging, frames read on sensor interrupt */
 
 #define VL53L5A1_DEV_LEFT      (0U) /*!< left satellite device */
 #define VL53L5A1_DEV_CENTER    (1U) /*!< center (built-in) device */
@@ -80,6 +81,13 @@ extern "C" {
 #define VL53L5A1_LP_PIN        GPIO_PIN_1
 #define VL53L5A1_LP_PORT       GPIOH
 
+/* Definition of the center device interrupt pin */
+#define VL53L5A1_INT_PIN                  GPIO_PIN_5
+#define VL53L5A1_INT_PORT                 GPIOG
+#define VL53L5A1_INT_GPIO_CLK_ENABLE()    __HAL_RCC_GPIOG_CLK_ENABLE()
+#define VL53L5A1_INT_EXTI_IRQn            EXTI5_IRQn
+#define VL53L5A1_INT_EXTI_LINE            EXTI_LINE_5
+
 /**
   * @}
   */
@@ -133,6 +141,25 @@ typedef struct
   uint32_t NumberOfZones;
   RANGING_SENSOR_ZoneResult_t ZoneResult[RANGING_SENSOR_MAX_NB_ZONES];
 } RANGING_SENSOR_Result_t;
+
+typedef struct
+{
+  uint32_t Sequence;                /*!< Frame sequence number, starting at 1 */
+  uint32_t Timestamp;               /*!< Tick of the data ready interrupt, in ms */
+  RANGING_SENSOR_Result_t Result;
+} RANGING_SENSOR_Frame_t;
+
+typedef struct
+{
+  uint32_t Frames;                  /*!< Frames published */
+  uint32_t Overruns;                /*!< Data ready interrupts raised before the previous frame was read */
+  uint32_t Errors;                  /*!< Frame read failures */
+  uint32_t LastLatency;             /*!< Data ready to frame published, in ms */
+  uint32_t MaxLatency;              /*!< Maximum data ready to frame published, in ms */
+  uint32_t LastBusTime;             /*!< Bus time of the last frame read, in ms */
+  uint32_t BusTime;                 /*!< Cumulated bus time of the frame reads, in ms */
+  uint32_t BusOccupancy;            /*!< Bus time over the last second, in per mille */
+} RANGING_SENSOR_ITStats_t;
 /**
   * @}
   */
@@ -163,6 +190,11 @@ int32_t BSP_RANGING_SENSOR_GetAddress(uint32_t Instance, uint32_t *pAddress);
 int32_t BSP_RANGING_SENSOR_SetPowerMode(uint32_t Instance, uint32_t PowerMode);
 int32_t BSP_RANGING_SENSOR_GetPowerMode(uint32_t Instance, uint32_t *pPowerMode);
 int32_t BSP_RANGING_SENSOR_XTalkCalibration(uint32_t Instance, uint16_t Reflectance, uint16_t Distance);
+int32_t BSP_RANGING_SENSOR_Process(uint32_t Instance);
+int32_t BSP_RANGING_SENSOR_GetFrame(uint32_t Instance, RANGING_SENSOR_Frame_t *pFrame);
+int32_t BSP_RANGING_SENSOR_GetITStats(uint32_t Instance, RANGING_SENSOR_ITStats_t *pStats);
+void    BSP_RANGING_SENSOR_IRQHandler(uint32_t Instance);
+void    BSP_RANGING_SENSOR_Callback(uint32_t Instance);
 /**
   * @}
   */
@@ -0,0 +1,503 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_sensor_hub.c
+  * @author  MCD Application Team
+  * @brief   This file provides a set of functions to read the sensors of the
+  *          B_U585I_IOT02A board according to a periodic read plan:
+  *            - Adjacent register blocks of a device are merged into bursts
+  *            - All bursts of a tick are queued back-to-back on the I2C buses
+  *            - One timestamped sample record is delivered per tick
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "b_u585i_iot02a_sensor_hub.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB SENSOR HUB
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Private_Constants SENSOR HUB Private Constants
+  * @{
+  */
+#if (SENSOR_HUB_MAX_READS > 32U)
+#error "SENSOR_HUB_MAX_READS exceeds the number of bits of the record Valid and Error masks"
+#endif /* SENSOR_HUB_MAX_READS > 32U */
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Private_Types SENSOR HUB Private Types
+  * @{
+  */
+typedef struct
+{
+  uint8_t        Bus;        /* Bus of the device */
+  uint8_t        AutoInc;    /* Register address auto-increment */
+  uint16_t       DevAddr;    /* Device address on BUS */
+  uint16_t       Reg;        /* First register of the burst */
+  uint16_t       Length;     /* Length of the burst in bytes */
+  uint16_t       Offset;     /* Offset of the burst in the record data */
+  uint32_t       Divider;    /* Burst is read every Divider ticks */
+  uint32_t       ReadMask;   /* Read plan entries covered by the burst */
+  BSP_I2C_Xfer_t Xfer;       /* Transfer descriptor */
+} SENSOR_HUB_Burst_t;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Private_Variables SENSOR HUB Private Variables
+  * @{
+  */
+static SENSOR_HUB_Burst_t  HubBurst[SENSOR_HUB_MAX_READS];
+static uint16_t            HubReadOffset[SENSOR_HUB_MAX_READS];
+static uint32_t            HubNbrOfReads  = 0U;
+static uint32_t            HubNbrOfBursts = 0U;
+
+static SENSOR_HUB_Record_t HubRecord[2];
+static uint32_t            HubFill        = 0U;   /* Record filled by the current cycle */
+static uint32_t            HubLast        = 0U;   /* Last delivered record */
+static uint32_t            HubHasRecord   = 0U;   /* A record has been delivered */
+static uint32_t            HubPending     = 0U;   /* Bursts in progress (+1 while submitting), 0 = idle */
+static uint32_t            HubCycle       = 0U;
+static uint32_t            HubOverruns    = 0U;
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Private_FunctionPrototypes SENSOR HUB Private FunctionPrototypes
+  * @{
+  */
+static uint32_t SENSOR_HUB_CanMerge(const SENSOR_HUB_Burst_t *pA, const SENSOR_HUB_Burst_t *pB);
+static void     SENSOR_HUB_XferCallback(BSP_I2C_Xfer_t *pXfer);
+static void     SENSOR_HUB_Release(void);
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Exported_Functions SENSOR HUB Exported Functions
+  * @{
+  */
+
+/**
+  * @brief  Initializes the sensor hub with a read plan.
+  * @note   Sensors must be initialized and configured by their BSP drivers before.
+  *         Register blocks of the same device with the same auto-increment and divider
+  *         which are adjacent or overlapping are merged into a single burst.
+  *         Register addresses are 8-bit.
+  * @param  pPlan       Pointer to the read plan
+  * @param  NbrOfReads  Number of entries in the read plan
+  * @retval BSP status
+  */
+int32_t BSP_SENSOR_HUB_Init(const SENSOR_HUB_Read_t *pPlan, uint32_t NbrOfReads)
+{
+  SENSOR_HUB_Burst_t *pBurst;
+  uint32_t            merged;
+  uint32_t            offset;
+  uint32_t            end;
+  uint32_t            a;
+  uint32_t            b;
+  uint32_t            i;
+  uint32_t            j;
+
+  if ((pPlan == NULL) || (NbrOfReads == 0U) || (NbrOfReads > SENSOR_HUB_MAX_READS))
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  if (HubPending != 0U)
+  {
+    return BSP_ERROR_BUSY;
+  }
+
+  HubNbrOfReads  = 0U;
+  HubNbrOfBursts = 0U;
+
+  for (a = 0U; a < NbrOfReads; a++)
+  {
+    if ((pPlan[a].Bus > SENSOR_HUB_BUS_I2C2) || (pPlan[a].AutoInc > SENSOR_HUB_AUTOINC_MSB) ||
+        (pPlan[a].Length == 0U) || (pPlan[a].Divider == 0U))
+    {
+      return BSP_ERROR_WRONG_PARAM;
+    }
+    pBurst = &HubBurst[a];
+    pBurst->Bus      = pPlan[a].Bus;
+    pBurst->AutoInc  = pPlan[a].AutoInc;
+    pBurst->DevAddr  = pPlan[a].DevAddr;
+    pBurst->Reg      = pPlan[a].Reg;
+    pBurst->Length   = pPlan[a].Length;
+    pBurst->Divider  = pPlan[a].Divider;
+    pBurst->ReadMask = 1UL << a;
+  }
+
+  /* Merge bursts until no more adjacent register blocks are found */
+  b = NbrOfReads;
+  do
+  {
+    merged = 0U;
+    for (a = 0U; a < b; a++)
+    {
+      i = a + 1U;
+      while (i < b)
+      {
+        if (SENSOR_HUB_CanMerge(&HubBurst[a], &HubBurst[i]) != 0U)
+        {
+          end = (uint32_t)HubBurst[a].Reg + HubBurst[a].Length;
+          if (((uint32_t)HubBurst[i].Reg + HubBurst[i].Length) > end)
+          {
+            end = (uint32_t)HubBurst[i].Reg + HubBurst[i].Length;
+          }
+          if (HubBurst[i].Reg < HubBurst[a].Reg)
+          {
+            HubBurst[a].Reg = HubBurst[i].Reg;
+          }
+          HubBurst[a].Length    = (uint16_t)(end - HubBurst[a].Reg);
+          HubBurst[a].ReadMask |= HubBurst[i].ReadMask;
+
+          /* Remove the merged burst keeping the order of the read plan */
+          b--;
+          for (j = i; j < b; j++)
+          {
+            HubBurst[j] = HubBurst[j + 1U];
+          }
+          merged = 1U;
+        }
+        else
+        {
+          i++;
+        }
+      }
+    }
+  } while (merged != 0U);
+
+  /* Assign record data to bursts and read plan entries */
+  offset = 0U;
+  for (a = 0U; a < b; a++)
+  {
+    HubBurst[a].Offset = (uint16_t)offset;
+    offset += HubBurst[a].Length;
+    if (offset > SENSOR_HUB_DATA_SIZE)
+    {
+      return BSP_ERROR_WRONG_PARAM;
+    }
+    for (i = 0U; i < NbrOfReads; i++)
+    {
+      if ((HubBurst[a].ReadMask & (1UL << i)) != 0U)
+      {
+        HubReadOffset[i] = (uint16_t)(HubBurst[a].Offset + (pPlan[i].Reg - HubBurst[a].Reg));
+      }
+    }
+  }
+
+  HubNbrOfReads  = NbrOfReads;
+  HubNbrOfBursts = b;
+  HubFill        = 0U;
+  HubHasRecord   = 0U;
+  HubCycle       = 0U;
+  HubOverruns    = 0U;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  De-initializes the sensor hub.
+  * @retval BSP status
+  */
+int32_t BSP_SENSOR_HUB_DeInit(void)
+{
+  if (HubPending != 0U)
+  {
+    return BSP_ERROR_BUSY;
+  }
+
+  HubNbrOfReads  = 0U;
+  HubNbrOfBursts = 0U;
+  HubHasRecord   = 0U;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Get the offset of the data of a read plan entry in the record data.
+  * @param  Read     Read plan entry
+  * @param  pOffset  Pointer to offset in bytes
+  * @retval BSP status
+  */
+int32_t BSP_SENSOR_HUB_GetOffset(uint32_t Read, uint32_t *pOffset)
+{
+  if ((pOffset == NULL) || (Read >= HubNbrOfReads))
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  *pOffset = HubReadOffset[Read];
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Get the number of bursts the read plan was merged into.
+  * @param  pNbrOfBursts  Pointer to number of bursts
+  * @retval BSP status
+  */
+int32_t BSP_SENSOR_HUB_GetBurstNbr(uint32_t *pNbrOfBursts)
+{
+  if (pNbrOfBursts == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  *pNbrOfBursts = HubNbrOfBursts;
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Start a sample cycle.
+  * @note   To be called periodically from a thread (for example a periodic thread or an
+  *         RTOS timer callback), not from an interrupt handler: in polling transfer mode
+  *         the bursts are read by the calling context. All bursts due in this
+  *         tick are queued back-to-back and the record is delivered by BSP_SENSOR_HUB_Callback
+  *         when the last one completes. In polling transfer mode this is before returning,
+  *         in interrupt and DMA modes from the I2C interrupt.
+  *         Ticks without due bursts do not deliver a record.
+  * @retval BSP status (BSP_ERROR_BUSY if the previous cycle is still in progress)
+  */
+int32_t BSP_SENSOR_HUB_Tick(void)
+{
+  SENSOR_HUB_Record_t *pRecord;
+  SENSOR_HUB_Burst_t  *pBurst;
+  uint32_t             primask;
+  uint32_t             cycle;
+  uint32_t             i;
+
+  if (HubNbrOfBursts == 0U)
+  {
+    return BSP_ERROR_NO_INIT;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (HubPending != 0U)
+  {
+    HubOverruns++;
+    __set_PRIMASK(primask);
+    return BSP_ERROR_BUSY;
+  }
+  /* Prevent completion of the cycle while bursts are submitted */
+  HubPending = 1U;
+  __set_PRIMASK(primask);
+
+  cycle = HubCycle++;
+
+  pRecord = &HubRecord[HubFill];
+  pRecord->Timestamp = HAL_GetTick();
+  pRecord->Cycle     = cycle;
+  pRecord->Valid     = 0U;
+  pRecord->Error     = 0U;
+  pRecord->Overruns  = HubOverruns;
+
+  for (i = 0U; i < HubNbrOfBursts; i++)
+  {
+    pBurst = &HubBurst[i];
+    if ((cycle % pBurst->Divider) != 0U)
+    {
+      continue;
+    }
+
+    pBurst->Xfer.DevAddr    = pBurst->DevAddr;
+    pBurst->Xfer.Reg        = pBurst->Reg;
+    if ((pBurst->AutoInc == SENSOR_HUB_AUTOINC_MSB) && (pBurst->Length > 1U))
+    {
+      pBurst->Xfer.Reg     |= 0x80U;
+    }
+    pBurst->Xfer.MemAddSize = I2C_MEMADD_SIZE_8BIT;
+    pBurst->Xfer.Length     = pBurst->Length;
+    pBurst->Xfer.pData      = &pRecord->Data[pBurst->Offset];
+    pBurst->Xfer.Dir        = BSP_I2C_XFER_READ;
+    pBurst->Xfer.Callback   = SENSOR_HUB_XferCallback;
+    pBurst->Xfer.pUser      = pBurst;
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    HubPending++;
+    __set_PRIMASK(primask);
+
+    if (pBurst->Bus == SENSOR_HUB_BUS_I2C1)
+    {
+      (void)BSP_I2C1_Submit(&pBurst->Xfer);
+    }
+    else
+    {
+      (void)BSP_I2C2_Submit(&pBurst->Xfer);
+    }
+  }
+
+  SENSOR_HUB_Release();
+
+  return BSP_ERROR_NONE;
+}
+
+/**
+  * @brief  Get a copy of the last delivered record.
+  * @param  pRecord  Pointer to record
+  * @retval BSP status (BSP_ERROR_BUSY if no record has been delivered yet)
+  */
+int32_t BSP_SENSOR_HUB_GetRecord(SENSOR_HUB_Record_t *pRecord)
+{
+  uint32_t primask;
+  int32_t  ret = BSP_ERROR_NONE;
+
+  if (pRecord == NULL)
+  {
+    return BSP_ERROR_WRONG_PARAM;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (HubHasRecord == 0U)
+  {
+    ret = BSP_ERROR_BUSY;
+  }
+  else
+  {
+    *pRecord = HubRecord[HubLast];
+  }
+  __set_PRIMASK(primask);
+
+  return ret;
+}
+
+/**
+  * @brief  Sample record callback.
+  * @note   The record remains valid until the next record is delivered.
+  * @param  pRecord  Pointer to record
+  * @retval None
+  */
+__weak void BSP_SENSOR_HUB_Callback(const SENSOR_HUB_Record_t *pRecord)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(pRecord);
+  /* This function should be implemented by the user application.
+     It is called into this driver when a sample record is completed. */
+}
+
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Private_Functions SENSOR HUB Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Check if two bursts can be merged into one.
+  * @param  pA  First burst
+  * @param  pB  Second burst
+  * @retval 1 if the register blocks are adjacent or overlapping, 0 otherwise
+  */
+static uint32_t SENSOR_HUB_CanMerge(const SENSOR_HUB_Burst_t *pA, const SENSOR_HUB_Burst_t *pB)
+{
+  if ((pA->AutoInc == SENSOR_HUB_AUTOINC_NONE) || (pA->AutoInc != pB->AutoInc) || (pA->Bus != pB->Bus) ||
+      (pA->DevAddr != pB->DevAddr) || (pA->Divider != pB->Divider))
+  {
+    return 0U;
+  }
+
+  if ((pB->Reg > ((uint32_t)pA->Reg + pA->Length)) || (pA->Reg > ((uint32_t)pB->Reg + pB->Length)))
+  {
+    return 0U;
+  }
+
+  return 1U;
+}
+
+/**
+  * @brief  Burst transfer completion callback.
+  * @param  pXfer  Transfer descriptor
+  * @retval None
+  */
+static void SENSOR_HUB_XferCallback(BSP_I2C_Xfer_t *pXfer)
+{
+  SENSOR_HUB_Burst_t *pBurst = (SENSOR_HUB_Burst_t *)pXfer->pUser;
+  uint32_t            primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pXfer->Status == BSP_ERROR_NONE)
+  {
+    HubRecord[HubFill].Valid |= pBurst->ReadMask;
+  }
+  else
+  {
+    HubRecord[HubFill].Error |= pBurst->ReadMask;
+  }
+  __set_PRIMASK(primask);
+
+  SENSOR_HUB_Release();
+}
+
+/**
+  * @brief  Release a burst of the current cycle and deliver the record after the last one.
+  * @retval None
+  */
+static void SENSOR_HUB_Release(void)
+{
+  SENSOR_HUB_Record_t *pRecord = NULL;
+  uint32_t             primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  HubPending--;
+  if (HubPending == 0U)
+  {
+    if ((HubRecord[HubFill].Valid | HubRecord[HubFill].Error) != 0U)
+    {
+      /* Next cycle fills the other record */
+      pRecord      = &HubRecord[HubFill];
+      HubLast      = HubFill;
+      HubFill     ^= 1U;
+      HubHasRecord = 1U;
+    }
+  }
+  __set_PRIMASK(primask);
+
+  if (pRecord != NULL)
+  {
+    BSP_SENSOR_HUB_Callback(pRecord);
+  }
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
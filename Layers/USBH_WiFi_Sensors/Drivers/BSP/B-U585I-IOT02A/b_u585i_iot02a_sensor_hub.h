@@ -0,0 +1,128 @@
+/**
+  ******************************************************************************
+  * @file    b_u585i_iot02a_sensor_hub.h
+  * @author  MCD Application Team
+  * @brief   This file contains the common defines and functions prototypes for
+  *          the b_u585i_iot02a_sensor_hub driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef B_U585I_IOT02A_SENSOR_HUB_H
+#define B_U585I_IOT02A_SENSOR_HUB_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "b_u585i_iot02a_conf.h"
+#include "b_u585i_iot02a_errno.h"
+#include "b_u585i_iot02a_bus.h"
+
+/** @addtogroup BSP
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A
+  * @{
+  */
+
+/** @addtogroup B_U585I_IOT02A_SENSOR_HUB
+  * @{
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Exported_Constants SENSOR HUB Exported Constants
+  * @{
+  */
+/* Maximum number of reads in the read plan (at most 32) */
+#ifndef SENSOR_HUB_MAX_READS
+#define SENSOR_HUB_MAX_READS                   16U
+#endif /* SENSOR_HUB_MAX_READS */
+
+/* Size of the sample data of one record in bytes */
+#ifndef SENSOR_HUB_DATA_SIZE
+#define SENSOR_HUB_DATA_SIZE                   64U
+#endif /* SENSOR_HUB_DATA_SIZE */
+
+/* Sensor hub buses */
+#define SENSOR_HUB_BUS_I2C1                    0U
+#define SENSOR_HUB_BUS_I2C2                    1U
+
+/* Register address auto-increment of the device:
+   DEFAULT for devices with auto-increment enabled by a control bit (LPS22HH IF_ADD_INC in
+   CTRL_REG2, ISM330DHCX IF_INC in CTRL3_C, both set by the component drivers), MSB for HTS221 */
+#define SENSOR_HUB_AUTOINC_NONE                0U    /* No auto-increment, reads are never merged */
+#define SENSOR_HUB_AUTOINC_DEFAULT             1U    /* Device increments the register address */
+#define SENSOR_HUB_AUTOINC_MSB                 2U    /* Register address MSB enables auto-increment */
+/**
+  * @}
+  */
+
+/** @defgroup B_U585I_IOT02A_SENSOR_HUB_Exported_Types SENSOR HUB Exported Types
+  * @{
+  */
+typedef struct
+{
+  uint8_t  Bus;        /*!< SENSOR_HUB_BUS_I2C1 or SENSOR_HUB_BUS_I2C2 */
+  uint8_t  AutoInc;    /*!< Register address auto-increment (SENSOR_HUB_AUTOINC_xxx) */
+  uint16_t DevAddr;    /*!< Device address on BUS */
+  uint16_t Reg;        /*!< First register of the block */
+  uint16_t Length;     /*!< Number of registers (bytes) of the block */
+  uint32_t Divider;    /*!< Block is read every Divider ticks */
+} SENSOR_HUB_Read_t;
+
+typedef struct
+{
+  uint32_t Timestamp;  /*!< Tick (ms) at the start of the sample cycle */
+  uint32_t Cycle;      /*!< Sample cycle number */
+  uint32_t Valid;      /*!< Reads of this cycle completed successfully (bit n = read plan entry n) */
+  uint32_t Error;      /*!< Reads of this cycle which failed (bit n = read plan entry n) */
+  uint32_t Overruns;   /*!< Ticks skipped so far since the previous cycle was still in progress */
+  uint8_t  Data[SENSOR_HUB_DATA_SIZE]; /*!< Sample data, entry n at offset from BSP_SENSOR_HUB_GetOffset */
+} SENSOR_HUB_Record_t;
+/**
+  * @}
+  */
+
+/** @addtogroup B_U585I_IOT02A_SENSOR_HUB_Exported_Functions SENSOR HUB Exported Functions
+  * @{
+  */
+int32_t BSP_SENSOR_HUB_Init(const SENSOR_HUB_Read_t *pPlan, uint32_t NbrOfReads);
+int32_t BSP_SENSOR_HUB_DeInit(void);
+int32_t BSP_SENSOR_HUB_GetOffset(uint32_t Read, uint32_t *pOffset);
+int32_t BSP_SENSOR_HUB_GetBurstNbr(uint32_t *pNbrOfBursts);
+int32_t BSP_SENSOR_HUB_Tick(void);
+int32_t BSP_SENSOR_HUB_GetRecord(SENSOR_HUB_Record_t *pRecord);
+void    BSP_SENSOR_HUB_Callback(const SENSOR_HUB_Record_t *pRecord);
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* B_U585I_IOT02A_SENSOR_HUB_H */
@@ -480,6 +480,30 @@ int32_t hts221_temperature_raw_get(stmdev_ctx_t *ctx, int16_t *val)
   return ret;
 }
 
+/**
+  * @brief  Humidity and temperature output values in one read.[get]
+  *
+  * @param  ctx     read / write interface definitions
+  * @param  hum     humidity output value
+  * @param  temp    temperature output value
+  * @retval         interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t hts221_hum_temp_raw_get(stmdev_ctx_t *ctx, int16_t *hum,
+                                int16_t *temp)
+{
+  uint8_t buff[4];
+  int32_t ret;
+
+  ret = hts221_read_reg(ctx, HTS221_HUMIDITY_OUT_L, buff, 4);
+  *hum = (int16_t)buff[1];
+  *hum = (*hum * 256) + (int16_t)buff[0];
+  *temp = (int16_t)buff[3];
+  *temp = (*temp * 256) + (int16_t)buff[2];
+
+  return ret;
+}
+
 /**
   * @}
   *
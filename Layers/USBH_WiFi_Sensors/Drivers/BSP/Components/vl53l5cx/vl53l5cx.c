@@ -39,6 +39,8 @@
 
 /* 0x1388 corresponds to 5000 decimal. This will do a timeout of 5 seconds */
 #define V53L5CX_POLL_TIMEOUT  (0x1388U)
+/* Delay between two data ready checks in blocking mode, in ms, to leave the bus to other devices */
+#define V53L5CX_POLL_PERIOD   (5U)
 #define UNUSED(x) (void)(x)
 
 /**
@@ -696,6 +698,11 @@ static int32_t vl53l5cx_poll_for_measurement(VL53L5CX_Object_t *pObj, uint32_t T
       ret = VL53L5CX_OK;
       break;
     }
+
+    if (Timeout != 0U)
+    {
+      (void)WaitMs(&pObj->Dev.platform, V53L5CX_POLL_PERIOD);
+    }
   } while ((pObj->IO.GetTick() - TickStart) < Timeout);
 
   return ret;
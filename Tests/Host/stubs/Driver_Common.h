@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Subset of the CMSIS-Driver common definitions used by the drivers.
+ */
+
+#ifndef DRIVER_COMMON_H_
+#define DRIVER_COMMON_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define ARM_DRIVER_VERSION_MAJOR_MINOR(major,minor) (((major) << 8) | (minor))
+
+typedef struct {
+  uint16_t api;
+  uint16_t drv;
+} ARM_DRIVER_VERSION;
+
+typedef enum {
+  ARM_POWER_OFF,
+  ARM_POWER_LOW,
+  ARM_POWER_FULL
+} ARM_POWER_STATE;
+
+#define ARM_DRIVER_OK                 0
+#define ARM_DRIVER_ERROR             -1
+#define ARM_DRIVER_ERROR_BUSY        -2
+#define ARM_DRIVER_ERROR_TIMEOUT     -3
+#define ARM_DRIVER_ERROR_UNSUPPORTED -4
+#define ARM_DRIVER_ERROR_PARAMETER   -5
+#define ARM_DRIVER_ERROR_SPECIFIC    -6
+
+#endif /* DRIVER_COMMON_H_ */
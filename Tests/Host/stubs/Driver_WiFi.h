@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Subset of the CMSIS-Driver WiFi API used by WiFi_EMW3080.c.
+ */
+
+#ifndef DRIVER_WIFI_H_
+#define DRIVER_WIFI_H_
+
+#include "Driver_Common.h"
+
+#define ARM_WIFI_API_VERSION ARM_DRIVER_VERSION_MAJOR_MINOR(1,1)
+
+#define _ARM_Driver_WiFi_(n)      Driver_WiFi##n
+#define  ARM_Driver_WiFi_(n) _ARM_Driver_WiFi_(n)
+
+/* Options */
+#define ARM_WIFI_BSSID                      1U
+#define ARM_WIFI_TX_POWER                   2U
+#define ARM_WIFI_LP_TIMER                   3U
+#define ARM_WIFI_DTIM                       4U
+#define ARM_WIFI_BEACON                     5U
+#define ARM_WIFI_MAC                        6U
+#define ARM_WIFI_IP                         7U
+#define ARM_WIFI_IP_SUBNET_MASK             8U
+#define ARM_WIFI_IP_GATEWAY                 9U
+#define ARM_WIFI_IP_DNS1                    10U
+#define ARM_WIFI_IP_DNS2                    11U
+#define ARM_WIFI_IP_DHCP                    12U
+#define ARM_WIFI_IP_DHCP_POOL_BEGIN         13U
+#define ARM_WIFI_IP_DHCP_POOL_END           14U
+#define ARM_WIFI_IP_DHCP_LEASE_TIME         15U
+#define ARM_WIFI_IP6_GLOBAL                 16U
+#define ARM_WIFI_IP6_LINK_LOCAL             17U
+#define ARM_WIFI_IP6_SUBNET_PREFIX_LEN      18U
+#define ARM_WIFI_IP6_GATEWAY                19U
+#define ARM_WIFI_IP6_DNS1                   20U
+#define ARM_WIFI_IP6_DNS2                   21U
+#define ARM_WIFI_IP6_DHCP_MODE              22U
+
+/* Security types */
+#define ARM_WIFI_SECURITY_OPEN              0U
+#define ARM_WIFI_SECURITY_WEP               1U
+#define ARM_WIFI_SECURITY_WPA               2U
+#define ARM_WIFI_SECURITY_WPA2              3U
+#define ARM_WIFI_SECURITY_WPA3              4U
+#define ARM_WIFI_SECURITY_UNKNOWN           255U
+
+/* Events */
+#define ARM_WIFI_EVENT_AP_CONNECT           (1UL << 0)
+#define ARM_WIFI_EVENT_AP_DISCONNECT        (1UL << 1)
+#define ARM_WIFI_EVENT_ETH_RX_FRAME         (1UL << 4)
+
+/* Sockets */
+#define ARM_SOCKET_AF_INET                  1
+#define ARM_SOCKET_AF_INET6                 2
+
+#define ARM_SOCKET_SOCK_STREAM              1
+#define ARM_SOCKET_SOCK_DGRAM               2
+
+#define ARM_SOCKET_IPPROTO_TCP              1
+#define ARM_SOCKET_IPPROTO_UDP              2
+
+#define ARM_SOCKET_IO_FIONBIO               1
+#define ARM_SOCKET_SO_RCVTIMEO              2
+#define ARM_SOCKET_SO_SNDTIMEO              3
+#define ARM_SOCKET_SO_KEEPALIVE             4
+#define ARM_SOCKET_SO_TYPE                  5
+
+#define ARM_SOCKET_ERROR                    (-1)
+#define ARM_SOCKET_ESOCK                    (-2)
+#define ARM_SOCKET_EINVAL                   (-3)
+#define ARM_SOCKET_ENOTSUP                  (-4)
+#define ARM_SOCKET_ENOMEM                   (-5)
+#define ARM_SOCKET_EAGAIN                   (-6)
+#define ARM_SOCKET_EINPROGRESS              (-7)
+#define ARM_SOCKET_ETIMEDOUT                (-8)
+#define ARM_SOCKET_EISCONN                  (-9)
+#define ARM_SOCKET_ENOTCONN                 (-10)
+#define ARM_SOCKET_ECONNREFUSED             (-11)
+#define ARM_SOCKET_ECONNRESET               (-12)
+#define ARM_SOCKET_ECONNABORTED             (-13)
+#define ARM_SOCKET_EALREADY                 (-14)
+#define ARM_SOCKET_EADDRINUSE               (-15)
+#define ARM_SOCKET_EHOSTNOTFOUND            (-16)
+
+typedef struct {
+  const char *ssid;
+  const char *pass;
+  uint8_t     security;
+  uint8_t     ch;
+  uint8_t     reserved;
+  uint8_t     wps_method;
+  const char *wps_pin;
+} ARM_WIFI_CONFIG_t;
+
+typedef struct {
+  char    ssid[32+1];
+  uint8_t bssid[6];
+  uint8_t security;
+  uint8_t ch;
+  uint8_t rssi;
+} ARM_WIFI_SCAN_INFO_t;
+
+typedef struct {
+  char    ssid[32+1];
+  char    pass[64+1];
+  uint8_t security;
+  uint8_t ch;
+  uint8_t rssi;
+} ARM_WIFI_NET_INFO_t;
+
+typedef void (*ARM_WIFI_SignalEvent_t) (uint32_t event, void *arg);
+
+typedef struct {
+  uint32_t station             : 1;
+  uint32_t ap                  : 1;
+  uint32_t station_ap          : 1;
+  uint32_t wps_station         : 1;
+  uint32_t wps_ap              : 1;
+  uint32_t event_ap_connect    : 1;
+  uint32_t event_ap_disconnect : 1;
+  uint32_t event_eth_rx_frame  : 1;
+  uint32_t bypass_mode         : 1;
+  uint32_t ip                  : 1;
+  uint32_t ip6                 : 1;
+  uint32_t ping                : 1;
+  uint32_t reserved            : 20;
+} ARM_WIFI_CAPABILITIES;
+
+typedef struct {
+  ARM_DRIVER_VERSION    (*GetVersion)     (void);
+  ARM_WIFI_CAPABILITIES (*GetCapabilities)(void);
+  int32_t (*Initialize)  (ARM_WIFI_SignalEvent_t cb_event);
+  int32_t (*Uninitialize)(void);
+  int32_t (*PowerControl)(ARM_POWER_STATE state);
+  int32_t (*GetModuleInfo)(char *module_info, uint32_t max_len);
+  int32_t (*SetOption)   (uint32_t interface, uint32_t option, const void *data, uint32_t len);
+  int32_t (*GetOption)   (uint32_t interface, uint32_t option, void *data, uint32_t *len);
+  int32_t (*Scan)        (ARM_WIFI_SCAN_INFO_t scan_info[], uint32_t max_num);
+  int32_t (*Activate)    (uint32_t interface, const ARM_WIFI_CONFIG_t *config);
+  int32_t (*Deactivate)  (uint32_t interface);
+  uint32_t (*IsConnected)(void);
+  int32_t (*GetNetInfo)  (ARM_WIFI_NET_INFO_t *net_info);
+  int32_t (*BypassControl)    (uint32_t interface, uint32_t mode);
+  int32_t (*EthSendFrame)     (uint32_t interface, const uint8_t *frame, uint32_t len);
+  int32_t (*EthReadFrame)     (uint32_t interface, uint8_t *frame, uint32_t len);
+  uint32_t (*EthGetRxFrameSize)(uint32_t interface);
+  int32_t (*SocketCreate)     (int32_t af, int32_t type, int32_t protocol);
+  int32_t (*SocketBind)       (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port);
+  int32_t (*SocketListen)     (int32_t socket, int32_t backlog);
+  int32_t (*SocketAccept)     (int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketConnect)    (int32_t socket, const uint8_t *ip, uint32_t ip_len, uint16_t port);
+  int32_t (*SocketRecv)       (int32_t socket, void *buf, uint32_t len);
+  int32_t (*SocketRecvFrom)   (int32_t socket, void *buf, uint32_t len, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketSend)       (int32_t socket, const void *buf, uint32_t len);
+  int32_t (*SocketSendTo)     (int32_t socket, const void *buf, uint32_t len, const uint8_t *ip, uint32_t ip_len, uint16_t port);
+  int32_t (*SocketGetSockName)(int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketGetPeerName)(int32_t socket, uint8_t *ip, uint32_t *ip_len, uint16_t *port);
+  int32_t (*SocketGetOpt)     (int32_t socket, int32_t opt_id, void *opt_val, uint32_t *opt_len);
+  int32_t (*SocketSetOpt)     (int32_t socket, int32_t opt_id, const void *opt_val, uint32_t opt_len);
+  int32_t (*SocketClose)      (int32_t socket);
+  int32_t (*SocketGetHostByName)(const char *name, int32_t af, uint8_t *ip, uint32_t *ip_len);
+  int32_t (*Ping)             (const uint8_t *ip, uint32_t ip_len);
+} const ARM_DRIVER_WIFI;
+
+#endif /* DRIVER_WIFI_H_ */
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host replacement of the generated RTE_Components.h.
+ */
+
+#ifndef RTE_COMPONENTS_H
+#define RTE_COMPONENTS_H
+
+#define RTE_Drivers_WiFi
+
+#endif /* RTE_COMPONENTS_H */
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host replacement of the BSP configuration, included ahead of the layer's
+ * b_u585i_iot02a_conf.h: I2C1 in DMA mode with a transmit DMA channel only,
+ * I2C2 in polling mode, and a short transfer timeout.
+ */
+
+#ifndef B_U585I_IOT02A_CONF_H
+#define B_U585I_IOT02A_CONF_H
+
+#include "stm32u5xx_hal.h"
+
+#define BUS_I2C1_FREQUENCY                   100000UL
+#define BUS_I2C2_FREQUENCY                   100000UL
+
+#define BUS_I2C1_XFER_MODE                   2U
+#define BUS_I2C2_XFER_MODE                   0U
+
+#define BUS_I2C_POLL_TIMEOUT                 40U
+
+#endif /* B_U585I_IOT02A_CONF_H */
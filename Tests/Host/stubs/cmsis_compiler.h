@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host replacement of the CMSIS compiler abstraction, GCC attributes.
+ */
+
+#ifndef CMSIS_COMPILER_H
+#define CMSIS_COMPILER_H
+
+#include "stm32u5xx_hal.h"
+
+#define __NO_RETURN           __attribute__((__noreturn__))
+#define __ALIGNED(x)          __attribute__((aligned(x)))
+#define __STATIC_INLINE       static inline
+#define __WEAK                __attribute__((weak))
+
+#endif /* CMSIS_COMPILER_H */
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * STM32 CRC peripheral emulation: 16-bit polynomial, byte input, no
+ * reversal, the configuration used by checksumutils.c.
+ */
+
+#include "stm32u5xx_hal.h"
+#include "cmsis_os2.h"
+
+CRC_TypeDef HostCrc;
+
+/* Number of HAL_CRC_Accumulate calls. */
+volatile uint32_t HostCrcAccumulates;
+
+HAL_StatusTypeDef HAL_CRC_Init (CRC_HandleTypeDef *hcrc) {
+  hcrc->Instance->POL  = hcrc->Init.GeneratingPolynomial;
+  hcrc->Instance->INIT = hcrc->Init.InitValue;
+  hcrc->Instance->DR   = hcrc->Init.InitValue;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CRC_DeInit (CRC_HandleTypeDef *hcrc) {
+  hcrc->Instance->DR = 0xFFFFFFFFU;
+  return HAL_OK;
+}
+
+/* The register state is updated per byte and other threads may run in */
+/* between, like interrupts on the target.                              */
+uint32_t HAL_CRC_Accumulate (CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength) {
+  const uint8_t *data = (const uint8_t *)pBuffer;
+
+  __atomic_fetch_add(&HostCrcAccumulates, 1U, __ATOMIC_RELAXED);
+  for (uint32_t i = 0U; i < BufferLength; i++) {
+    uint32_t crc = hcrc->Instance->DR ^ ((uint32_t)data[i] << 8);
+
+    for (uint32_t bit = 0U; bit < 8U; bit++) {
+      crc = ((crc & 0x8000U) != 0U) ? ((crc << 1) ^ hcrc->Instance->POL) : (crc << 1);
+    }
+    hcrc->Instance->DR = crc & 0xFFFFU;
+    if ((i & 7U) == 7U) {
+      osThreadYield();
+    }
+  }
+  return hcrc->Instance->DR;
+}
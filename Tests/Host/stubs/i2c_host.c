@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * STM32 I2C peripheral emulation for hi2c1 and hi2c2.
+ *
+ * Each bus has HOST_I2C_DEVICES register memories at the addresses
+ * HOST_I2C_DEV_ADDR(n), other addresses are not acknowledged. Polling
+ * transfers run in the calling thread, interrupt and DMA transfers in an
+ * interrupt thread per bus which calls the registered callbacks. A transfer
+ * started while the peripheral is busy fails with HAL_BUSY and is counted.
+ * Transfers to HostI2cStallAddr do not complete until it is cleared or
+ * they are aborted, with HostI2cAbortStall set the abort does not complete
+ * either.
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+
+#include "stm32u5xx_hal.h"
+
+#define HOST_I2C_DEVICES        (8U)
+#define HOST_I2C_DEV_ADDR(n)    (0x20U + (2U * (n)))
+#define HOST_I2C_MEM_SIZE       (0x10000U)
+
+I2C_HandleTypeDef hi2c1;
+I2C_HandleTypeDef hi2c2;
+
+/* Test controls and counters. */
+volatile uint32_t HostI2cByteNs = 1000U;  /* Transfer time per byte */
+volatile uint32_t HostI2cStallAddr;
+volatile uint32_t HostI2cAbortStall;
+volatile uint32_t HostI2cOverlaps;        /* Transfers started while the peripheral was busy */
+volatile uint32_t HostI2cDmaStarts;
+volatile uint32_t HostI2cItStarts;
+
+typedef struct {
+  I2C_HandleTypeDef *hi2c;
+  pthread_mutex_t    lock;
+  pthread_cond_t     cond;
+  uint32_t           irq_thread;          /* Interrupt thread started */
+  uint32_t           busy;                /* Transfer in progress */
+  uint32_t           pending;             /* Interrupt or DMA transfer waiting for the interrupt thread */
+  uint32_t           abort;               /* Abort requested */
+  HAL_I2C_CallbackIDTypeDef cb_id;        /* Completion callback of the pending transfer */
+  uint16_t           addr;
+  uint16_t           reg;
+  uint32_t           mem;                 /* Register transfer */
+  uint32_t           write;
+  uint8_t           *data;
+  uint16_t           len;
+  uint8_t            dev_mem[HOST_I2C_DEVICES][HOST_I2C_MEM_SIZE];
+} host_i2c_t;
+
+static host_i2c_t HostI2c[2] = {
+  { .hi2c = &hi2c1, .lock = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER },
+  { .hi2c = &hi2c2, .lock = PTHREAD_MUTEX_INITIALIZER, .cond = PTHREAD_COND_INITIALIZER }
+};
+
+static host_i2c_t *host_i2c (I2C_HandleTypeDef *hi2c) {
+  return (hi2c == &hi2c1) ? &HostI2c[0] : &HostI2c[1];
+}
+
+static void host_i2c_sleep (uint32_t ns) {
+  const struct timespec ts = { (time_t)(ns / 1000000000U), (long)(ns % 1000000000U) };
+
+  if (ns != 0U) {
+    nanosleep(&ts, NULL);
+  }
+}
+
+/* Claims the peripheral for a transfer, as the HAL state check does. */
+static HAL_StatusTypeDef host_i2c_claim (host_i2c_t *i2c, uint16_t addr, uint16_t reg, uint32_t mem,
+                                         uint32_t write, uint8_t *data, uint16_t len) {
+  pthread_mutex_lock(&i2c->lock);
+  if (i2c->busy != 0U) {
+    pthread_mutex_unlock(&i2c->lock);
+    __atomic_add_fetch(&HostI2cOverlaps, 1U, __ATOMIC_SEQ_CST);
+    return HAL_BUSY;
+  }
+  i2c->busy  = 1U;
+  i2c->abort = 0U;
+  i2c->addr  = addr;
+  i2c->reg   = reg;
+  i2c->mem   = mem;
+  i2c->write = write;
+  i2c->data  = data;
+  i2c->len   = len;
+  i2c->hi2c->ErrorCode = HAL_I2C_ERROR_NONE;
+  pthread_mutex_unlock(&i2c->lock);
+  return HAL_OK;
+}
+
+static void host_i2c_release (host_i2c_t *i2c) {
+  pthread_mutex_lock(&i2c->lock);
+  i2c->busy    = 0U;
+  i2c->pending = 0U;
+  i2c->abort   = 0U;
+  pthread_mutex_unlock(&i2c->lock);
+}
+
+/* Moves the data of the claimed transfer, HAL_ERROR with ErrorCode AF if no device acknowledges. */
+static HAL_StatusTypeDef host_i2c_xfer (host_i2c_t *i2c) {
+  uint8_t *dev_mem = NULL;
+  uint32_t offset;
+
+  for (uint32_t n = 0U; n < HOST_I2C_DEVICES; n++) {
+    if (i2c->addr == HOST_I2C_DEV_ADDR(n)) {
+      dev_mem = i2c->dev_mem[n];
+    }
+  }
+  host_i2c_sleep(HostI2cByteNs * (i2c->len + 2U));
+  if (dev_mem == NULL) {
+    i2c->hi2c->ErrorCode = HAL_I2C_ERROR_AF;
+    return HAL_ERROR;
+  }
+
+  offset = (i2c->mem != 0U) ? i2c->reg : 0U;
+  for (uint32_t i = 0U; i < i2c->len; i++) {
+    if (i2c->write != 0U) {
+      dev_mem[(offset + i) % HOST_I2C_MEM_SIZE] = i2c->data[i];
+    } else {
+      i2c->data[i] = dev_mem[(offset + i) % HOST_I2C_MEM_SIZE];
+    }
+  }
+  return HAL_OK;
+}
+
+static HAL_StatusTypeDef host_i2c_poll (I2C_HandleTypeDef *hi2c, uint16_t addr, uint16_t reg, uint32_t mem,
+                                        uint32_t write, uint8_t *data, uint16_t len, uint32_t timeout) {
+  host_i2c_t *i2c = host_i2c(hi2c);
+  HAL_StatusTypeDef status;
+
+  status = host_i2c_claim(i2c, addr, reg, mem, write, data, len);
+  if (status != HAL_OK) {
+    return status;
+  }
+  if (addr == HostI2cStallAddr) {
+    HAL_Delay(timeout);
+    hi2c->ErrorCode = HAL_I2C_ERROR_TIMEOUT;
+    status = HAL_TIMEOUT;
+  } else {
+    status = host_i2c_xfer(i2c);
+  }
+  host_i2c_release(i2c);
+  return status;
+}
+
+static void host_i2c_callback (I2C_HandleTypeDef *hi2c, HAL_I2C_CallbackIDTypeDef id) {
+  pI2C_CallbackTypeDef cb;
+
+  switch (id) {
+    case HAL_I2C_MASTER_TX_COMPLETE_CB_ID: cb = hi2c->MasterTxCpltCallback; break;
+    case HAL_I2C_MASTER_RX_COMPLETE_CB_ID: cb = hi2c->MasterRxCpltCallback; break;
+    case HAL_I2C_MEM_TX_COMPLETE_CB_ID:    cb = hi2c->MemTxCpltCallback;    break;
+    case HAL_I2C_MEM_RX_COMPLETE_CB_ID:    cb = hi2c->MemRxCpltCallback;    break;
+    case HAL_I2C_ERROR_CB_ID:              cb = hi2c->ErrorCallback;        break;
+    default:                               cb = hi2c->AbortCpltCallback;    break;
+  }
+  if (cb != NULL) {
+    host_irq_enter();
+    cb(hi2c);
+    host_irq_exit();
+  }
+}
+
+/* Interrupt thread: executes the pending transfer and calls its callback. */
+static void *host_i2c_irq_thread (void *arg) {
+  host_i2c_t *i2c = arg;
+  HAL_I2C_CallbackIDTypeDef id;
+  uint32_t abort;
+
+  for (;;) {
+    pthread_mutex_lock(&i2c->lock);
+    while (i2c->pending == 0U) {
+      pthread_cond_wait(&i2c->cond, &i2c->lock);
+    }
+    pthread_mutex_unlock(&i2c->lock);
+
+    while ((i2c->addr == HostI2cStallAddr) && ((i2c->abort == 0U) || (HostI2cAbortStall != 0U))) {
+      host_i2c_sleep(100000U);
+    }
+
+    pthread_mutex_lock(&i2c->lock);
+    abort = i2c->abort;
+    pthread_mutex_unlock(&i2c->lock);
+    if (abort != 0U) {
+      id = HAL_I2C_ABORT_CB_ID;
+    } else if (host_i2c_xfer(i2c) != HAL_OK) {
+      id = HAL_I2C_ERROR_CB_ID;
+    } else {
+      id = i2c->cb_id;
+    }
+
+    /* Ready for the next transfer, which the callback may start */
+    host_i2c_release(i2c);
+    host_i2c_callback(i2c->hi2c, id);
+  }
+  return NULL;
+}
+
+static HAL_StatusTypeDef host_i2c_start (I2C_HandleTypeDef *hi2c, uint16_t addr, uint16_t reg, uint32_t mem,
+                                         uint32_t write, uint8_t *data, uint16_t len, uint32_t dma) {
+  host_i2c_t *i2c = host_i2c(hi2c);
+  HAL_StatusTypeDef status;
+  pthread_t th;
+
+  status = host_i2c_claim(i2c, addr, reg, mem, write, data, len);
+  if (status != HAL_OK) {
+    return status;
+  }
+  __atomic_add_fetch((dma != 0U) ? &HostI2cDmaStarts : &HostI2cItStarts, 1U, __ATOMIC_SEQ_CST);
+
+  pthread_mutex_lock(&i2c->lock);
+  if (i2c->irq_thread == 0U) {
+    pthread_create(&th, NULL, host_i2c_irq_thread, i2c);
+    pthread_detach(th);
+    i2c->irq_thread = 1U;
+  }
+  if (mem != 0U) {
+    i2c->cb_id = (write != 0U) ? HAL_I2C_MEM_TX_COMPLETE_CB_ID : HAL_I2C_MEM_RX_COMPLETE_CB_ID;
+  } else {
+    i2c->cb_id = (write != 0U) ? HAL_I2C_MASTER_TX_COMPLETE_CB_ID : HAL_I2C_MASTER_RX_COMPLETE_CB_ID;
+  }
+  i2c->pending = 1U;
+  pthread_cond_signal(&i2c->cond);
+  pthread_mutex_unlock(&i2c->lock);
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_RegisterCallback (I2C_HandleTypeDef *hi2c, HAL_I2C_CallbackIDTypeDef CallbackID,
+                                            pI2C_CallbackTypeDef pCallback) {
+  switch (CallbackID) {
+    case HAL_I2C_MASTER_TX_COMPLETE_CB_ID: hi2c->MasterTxCpltCallback = pCallback; break;
+    case HAL_I2C_MASTER_RX_COMPLETE_CB_ID: hi2c->MasterRxCpltCallback = pCallback; break;
+    case HAL_I2C_MEM_TX_COMPLETE_CB_ID:    hi2c->MemTxCpltCallback    = pCallback; break;
+    case HAL_I2C_MEM_RX_COMPLETE_CB_ID:    hi2c->MemRxCpltCallback    = pCallback; break;
+    case HAL_I2C_ERROR_CB_ID:              hi2c->ErrorCallback        = pCallback; break;
+    case HAL_I2C_ABORT_CB_ID:              hi2c->AbortCpltCallback    = pCallback; break;
+    default:                               return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                           uint16_t Size, uint32_t Timeout) {
+  return host_i2c_poll(hi2c, DevAddress, 0U, 0U, 1U, pData, Size, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                          uint16_t Size, uint32_t Timeout) {
+  return host_i2c_poll(hi2c, DevAddress, 0U, 0U, 0U, pData, Size, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                     uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+  return host_i2c_poll(hi2c, DevAddress, MemAddress, MemAddSize, 1U, pData, Size, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout) {
+  return host_i2c_poll(hi2c, DevAddress, MemAddress, MemAddSize, 0U, pData, Size, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                         uint32_t Timeout) {
+  (void)Trials;
+  return host_i2c_poll(hi2c, DevAddress, 0U, 0U, 0U, NULL, 0U, Timeout);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, 0U, 0U, 1U, pData, Size, 0U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, 0U, 0U, 0U, pData, Size, 0U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, MemAddress, MemAddSize, 1U, pData, Size, 0U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, MemAddress, MemAddSize, 0U, pData, Size, 0U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                               uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, 0U, 0U, 1U, pData, Size, 1U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, 0U, 0U, 0U, pData, Size, 1U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                         uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, MemAddress, MemAddSize, 1U, pData, Size, 1U);
+}
+
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA (I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size) {
+  return host_i2c_start(hi2c, DevAddress, MemAddress, MemAddSize, 0U, pData, Size, 1U);
+}
+
+/* Only an interrupt or DMA transfer in progress can be aborted, the abort callback follows. */
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT (I2C_HandleTypeDef *hi2c, uint16_t DevAddress) {
+  host_i2c_t *i2c = host_i2c(hi2c);
+  HAL_StatusTypeDef status = HAL_ERROR;
+
+  (void)DevAddress;
+  pthread_mutex_lock(&i2c->lock);
+  if ((i2c->pending != 0U) && (i2c->abort == 0U)) {
+    i2c->abort = 1U;
+    status = HAL_OK;
+  }
+  pthread_mutex_unlock(&i2c->lock);
+  return status;
+}
+
+uint32_t HAL_I2C_GetError (I2C_HandleTypeDef *hi2c) {
+  return hi2c->ErrorCode;
+}
@@ -0,0 +1,14 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Host replacement of the CubeMX generated main.h.
+ */
+
+#ifndef MAIN_H
+#define MAIN_H
+
+#include "stm32u5xx_hal.h"
+
+#endif /* MAIN_H */
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * mx_wifi API stand-in for the WiFi_EMW3080.c driver tests.
+ *
+ * The driver initializes against an idle module: probe, reset, init and
+ * the status callbacks succeed, all other requests fail. The functions are
+ * weak, a test replaces the requests it exercises.
+ */
+
+#include <string.h>
+
+#include "mx_wifi.h"
+#include "core/mx_wifi_ipc.h"
+#include "io_pattern/mx_wifi_io.h"
+
+#define HOST_WEAK __attribute__((weak))
+
+static MX_WIFIObject_t HostWifiObj;
+
+HOST_WEAK int32_t mxwifi_probe(void **ll_drv_context) {
+  *ll_drv_context = &HostWifiObj;
+  return 0;
+}
+
+HOST_WEAK void mx_wifi_spi_get_stat(mx_wifi_spi_stat_t *stat) {
+  memset(stat, 0, sizeof(*stat));
+}
+
+HOST_WEAK void mipc_get_rx_stat(mipc_rx_stat_t *stat) {
+  memset(stat, 0, sizeof(*stat));
+}
+
+HOST_WEAK void mipc_get_tx_stat(mipc_tx_stat_t *stat) {
+  memset(stat, 0, sizeof(*stat));
+}
+
+HOST_WEAK int32_t mipc_get_latency_stat(uint32_t index, mipc_latency_stat_t *stat) {
+  memset(stat, 0, sizeof(*stat));
+  return -1;
+}
+
+HOST_WEAK uint32_t mipc_get_latency_untracked(void) {
+  return 0U;
+}
+
+/* Module control */
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_HardResetModule(MX_WIFIObject_t *Obj) {
+  return MX_WIFI_STATUS_OK;
+}
+
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_Init(MX_WIFIObject_t *Obj) {
+  return MX_WIFI_STATUS_OK;
+}
+
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_DeInit(MX_WIFIObject_t *Obj) {
+  return MX_WIFI_STATUS_OK;
+}
+
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_RegisterStatusCallback(MX_WIFIObject_t *Obj, mx_wifi_status_callback_t Cb, void *arg) {
+  return MX_WIFI_STATUS_OK;
+}
+
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_UnRegisterStatusCallback_if(MX_WIFIObject_t *Obj, mwifi_if_t Interface) {
+  return MX_WIFI_STATUS_OK;
+}
+
+HOST_WEAK int32_t MX_WIFI_station_powersave(MX_WIFIObject_t *Obj, int32_t ps_onoff) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+/* Station */
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_Scan(MX_WIFIObject_t *Obj, mc_wifi_scan_mode_t ScanMode, char *SSID, int32_t Len) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int8_t MX_WIFI_Get_scan_result(MX_WIFIObject_t *Obj, uint8_t *Results, uint8_t Number) {
+  return 0;
+}
+
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_Connect(MX_WIFIObject_t *Obj, const mx_char_t *SSID,
+                                           const mx_char_t *Password, MX_WIFI_SecurityType_t SecType) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_Disconnect(MX_WIFIObject_t *Obj) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int8_t MX_WIFI_IsConnected(MX_WIFIObject_t *Obj) {
+  return 0;
+}
+
+HOST_WEAK MX_WIFI_STATUS_T MX_WIFI_GetIPAddress(MX_WIFIObject_t *Obj, uint8_t *IpAddr, mwifi_if_t WifiMode) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+/* Sockets */
+HOST_WEAK int32_t MX_WIFI_Socket_create(MX_WIFIObject_t *Obj, int32_t Domain, int32_t Type, int32_t Protocol) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_close(MX_WIFIObject_t *Obj, int32_t SockFd) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_bind(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                      const struct mx_sockaddr *Addr, int32_t AddrLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_listen(MX_WIFIObject_t *Obj, int32_t sockfd, int32_t backlog) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_accept(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                        struct mx_sockaddr *Addr, uint32_t *AddrLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_connect(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                         const struct mx_sockaddr *Addr, int32_t AddrLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_recv(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *Buf,
+                                      int32_t Len, int32_t flags) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_recvfrom(MX_WIFIObject_t *Obj, int32_t SockFd, uint8_t *Buf,
+                                          int32_t Len, int32_t Flags,
+                                          struct mx_sockaddr *FromAddr, uint32_t *FromAddrLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_send(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t *Buf,
+                                      int32_t Len, int32_t flags) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_send_stream(MX_WIFIObject_t *Obj, int32_t SockFd, const uint8_t *Buf,
+                                             int32_t Len, int32_t flags) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_sendto(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                        const uint8_t *Buf, int32_t Len, int32_t Flags,
+                                        struct mx_sockaddr *ToAddr, int32_t ToAddrLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_getsockname(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                             struct mx_sockaddr *Addr, uint32_t *AddrLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_getpeername(MX_WIFIObject_t *Obj, int32_t SockFd,
+                                             struct mx_sockaddr *Addr, uint32_t *AddrLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_getsockopt(MX_WIFIObject_t *Obj, int32_t SockFd, int32_t Level,
+                                            int32_t OptName, void *OptValue, uint32_t *OptLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_setsockopt(MX_WIFIObject_t *Obj, int32_t SockFd, int32_t Level,
+                                            int32_t OptName, const void *OptValue, int32_t OptLen) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_gethostbyname(MX_WIFIObject_t *Obj, struct mx_sockaddr *Addr, const mx_char_t *Name) {
+  return MX_WIFI_STATUS_ERROR;
+}
+
+HOST_WEAK int32_t MX_WIFI_Socket_ping(MX_WIFIObject_t *Obj, const char *hostname, int32_t count, int32_t delay,
+                                      int32_t response[]) {
+  return MX_WIFI_STATUS_ERROR;
+}
@@ -0,0 +1,728 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * CMSIS-RTOS2 subset and HAL services on POSIX threads for the host tests.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "cmsis_os2.h"
+#include "stm32u5xx_hal.h"
+
+/* Thread control block */
+typedef struct {
+  pthread_t       th;
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+  uint32_t        flags;
+  osThreadFunc_t  func;
+  void           *arg;
+} host_thread_t;
+
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+  uint32_t        flags;
+} host_event_t;
+
+typedef struct {
+  pthread_mutex_t lock;
+} host_mutex_t;
+
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+  uint32_t        count;
+  uint32_t        max;
+} host_sem_t;
+
+typedef struct {
+  pthread_mutex_t lock;
+  pthread_cond_t  cond;
+  uint32_t        msg_count;
+  uint32_t        msg_size;
+  uint32_t        in;
+  uint32_t        rd;
+  uint32_t        wr;
+  uint8_t        *buf;
+} host_mq_t;
+
+static __thread host_thread_t *CurrentThread;
+static __thread int            IrqContext;
+static __thread int            IrqMasked;
+static pthread_mutex_t         IrqLock = PTHREAD_MUTEX_INITIALIZER;
+static volatile uint32_t       PreemptEnable;
+
+static void host_fatal (const char *what) {
+  fprintf(stderr, "os_host: %s\n", what);
+  abort();
+}
+
+static void host_cond_init (pthread_cond_t *cond) {
+  pthread_condattr_t attr;
+
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(cond, &attr);
+  pthread_condattr_destroy(&attr);
+}
+
+static struct timespec host_deadline (uint32_t timeout) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  ts.tv_sec  += timeout / 1000U;
+  ts.tv_nsec += (long)(timeout % 1000U) * 1000000L;
+  if (ts.tv_nsec >= 1000000000L) {
+    ts.tv_sec  += 1;
+    ts.tv_nsec -= 1000000000L;
+  }
+  return ts;
+}
+
+/* Wait on cond until woken or the deadline, returns 0 on timeout. */
+static int host_cond_wait (pthread_cond_t *cond, pthread_mutex_t *lock, uint32_t timeout, const struct timespec *deadline) {
+  if (timeout == osWaitForever) {
+    pthread_cond_wait(cond, lock);
+    return 1;
+  }
+  return (pthread_cond_timedwait(cond, lock, deadline) != ETIMEDOUT);
+}
+
+static host_thread_t *host_thread_self (void) {
+  if (CurrentThread == NULL) {
+    CurrentThread = calloc(1U, sizeof(host_thread_t));
+    if (CurrentThread == NULL) {
+      host_fatal("no memory");
+    }
+    CurrentThread->th = pthread_self();
+    pthread_mutex_init(&CurrentThread->lock, NULL);
+    host_cond_init(&CurrentThread->cond);
+  }
+  return CurrentThread;
+}
+
+/* Random preemption points in the RTOS services and exclusive accesses, see stm32u5xx_hal.h */
+void host_preempt (uint32_t enable) {
+  PreemptEnable = enable;
+}
+
+static void host_preempt_point (void) {
+  if (PreemptEnable != 0U) {
+    const int r = rand() & 15;
+
+    if (r == 0) {
+      const struct timespec ts = { 0, 50000L };
+
+      nanosleep(&ts, NULL);
+    } else if (r < 4) {
+      sched_yield();
+    }
+  }
+}
+
+/* Interrupt context emulation, see stm32u5xx_hal.h: the interrupts and the threads */
+/* with interrupts disabled hold IrqLock.                                            */
+void host_irq_enter (void) {
+  pthread_mutex_lock(&IrqLock);
+  IrqContext = 1;
+}
+
+void host_irq_exit (void) {
+  IrqContext = 0;
+  pthread_mutex_unlock(&IrqLock);
+}
+
+uint32_t host_irq_active (void) {
+  return (IrqContext != 0) ? 1U : 0U;
+}
+
+uint32_t __get_PRIMASK (void) {
+  return (IrqMasked != 0) ? 1U : 0U;
+}
+
+void __disable_irq (void) {
+  if ((IrqMasked == 0) && (IrqContext == 0)) {
+    pthread_mutex_lock(&IrqLock);
+  }
+  IrqMasked = 1;
+}
+
+void __set_PRIMASK (uint32_t priMask) {
+  if (priMask != 0U) {
+    __disable_irq();
+  } else if (IrqMasked != 0) {
+    IrqMasked = 0;
+    if (IrqContext == 0) {
+      pthread_mutex_unlock(&IrqLock);
+    }
+  }
+}
+
+/* Kernel */
+osKernelState_t osKernelGetState (void) {
+  return osKernelRunning;
+}
+
+static struct timespec    TickStart;
+static pthread_once_t     TickOnce = PTHREAD_ONCE_INIT;
+static volatile uint32_t  TickOffset;
+
+static void host_tick_init (void) {
+  clock_gettime(CLOCK_MONOTONIC, &TickStart);
+}
+
+uint32_t osKernelGetTickCount (void) {
+  struct timespec now;
+
+  pthread_once(&TickOnce, host_tick_init);
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(((now.tv_sec - TickStart.tv_sec) * 1000L) + ((now.tv_nsec - TickStart.tv_nsec) / 1000000L)) + TickOffset;
+}
+
+uint32_t osKernelGetTickFreq (void) {
+  return 1000U;
+}
+
+/* Moves the tick count forward, timeouts of waiting threads are not affected. */
+void host_tick_advance (uint32_t ticks) {
+  TickOffset += ticks;
+}
+
+uint32_t HAL_GetTick (void) {
+  return osKernelGetTickCount();
+}
+
+void HAL_Delay (uint32_t Delay) {
+  (void)osDelay(Delay);
+}
+
+osStatus_t osDelay (uint32_t ticks) {
+  struct timespec ts;
+
+  ts.tv_sec  = ticks / 1000U;
+  ts.tv_nsec = (long)(ticks % 1000U) * 1000000L;
+  nanosleep(&ts, NULL);
+  return osOK;
+}
+
+/* Threads */
+static void *host_thread_entry (void *arg) {
+  host_thread_t *t = arg;
+
+  CurrentThread = t;
+  t->func(t->arg);
+  return NULL;
+}
+
+osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAttr_t *attr) {
+  host_thread_t *t;
+
+  (void)attr;
+  t = calloc(1U, sizeof(host_thread_t));
+  if (t == NULL) {
+    return NULL;
+  }
+  pthread_mutex_init(&t->lock, NULL);
+  host_cond_init(&t->cond);
+  t->func = func;
+  t->arg  = argument;
+  if (pthread_create(&t->th, NULL, host_thread_entry, t) != 0) {
+    free(t);
+    return NULL;
+  }
+  return t;
+}
+
+osThreadId_t osThreadGetId (void) {
+  return host_thread_self();
+}
+
+osStatus_t osThreadYield (void) {
+  sched_yield();
+  return osOK;
+}
+
+osStatus_t osThreadJoin (osThreadId_t thread_id) {
+  host_thread_t *t = thread_id;
+
+  if (t == NULL) {
+    return osErrorParameter;
+  }
+  pthread_join(t->th, NULL);
+  pthread_mutex_destroy(&t->lock);
+  pthread_cond_destroy(&t->cond);
+  free(t);
+  return osOK;
+}
+
+osStatus_t osThreadTerminate (osThreadId_t thread_id) {
+  (void)thread_id;
+  /* Threads of the tests end on their own and are joined. */
+  return osErrorResource;
+}
+
+void osThreadExit (void) {
+  pthread_exit(NULL);
+}
+
+/* Flags wait of threads and event flags objects. */
+static uint32_t host_flags_wait (pthread_mutex_t *lock, pthread_cond_t *cond, uint32_t *current,
+                                 uint32_t flags, uint32_t options, uint32_t timeout) {
+  const struct timespec deadline = host_deadline(timeout);
+  uint32_t rflags;
+
+  pthread_mutex_lock(lock);
+  for (;;) {
+    const uint32_t match = *current & flags;
+
+    if (((options & osFlagsWaitAll) != 0U) ? (match == flags) : (match != 0U)) {
+      rflags = *current;
+      if ((options & osFlagsNoClear) == 0U) {
+        *current &= ~flags;
+      }
+      break;
+    }
+    if ((timeout == 0U) || (host_cond_wait(cond, lock, timeout, &deadline) == 0)) {
+      rflags = (timeout == 0U) ? osFlagsErrorResource : osFlagsErrorTimeout;
+      break;
+    }
+  }
+  pthread_mutex_unlock(lock);
+  return rflags;
+}
+
+uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags) {
+  host_thread_t *t = thread_id;
+  uint32_t rflags;
+
+  if ((t == NULL) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  pthread_mutex_lock(&t->lock);
+  t->flags |= flags;
+  rflags = t->flags;
+  pthread_cond_broadcast(&t->cond);
+  pthread_mutex_unlock(&t->lock);
+  return rflags;
+}
+
+uint32_t osThreadFlagsClear (uint32_t flags) {
+  host_thread_t *t = host_thread_self();
+  uint32_t rflags;
+
+  if (host_irq_active() != 0U) {
+    return osFlagsErrorISR;
+  }
+  pthread_mutex_lock(&t->lock);
+  rflags = t->flags;
+  t->flags &= ~flags;
+  pthread_mutex_unlock(&t->lock);
+  return rflags;
+}
+
+uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout) {
+  host_thread_t *t = host_thread_self();
+
+  if (host_irq_active() != 0U) {
+    return osFlagsErrorISR;
+  }
+  return host_flags_wait(&t->lock, &t->cond, &t->flags, flags, options, timeout);
+}
+
+/* Event flags */
+osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr) {
+  host_event_t *e;
+
+  (void)attr;
+  e = calloc(1U, sizeof(host_event_t));
+  if (e != NULL) {
+    pthread_mutex_init(&e->lock, NULL);
+    host_cond_init(&e->cond);
+  }
+  return e;
+}
+
+uint32_t osEventFlagsSet (osEventFlagsId_t ef_id, uint32_t flags) {
+  host_event_t *e = ef_id;
+  uint32_t rflags;
+
+  if ((e == NULL) || ((flags & osFlagsError) != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  pthread_mutex_lock(&e->lock);
+  e->flags |= flags;
+  rflags = e->flags;
+  pthread_cond_broadcast(&e->cond);
+  pthread_mutex_unlock(&e->lock);
+  return rflags;
+}
+
+uint32_t osEventFlagsClear (osEventFlagsId_t ef_id, uint32_t flags) {
+  host_event_t *e = ef_id;
+  uint32_t rflags;
+
+  if (e == NULL) {
+    return osFlagsErrorParameter;
+  }
+  pthread_mutex_lock(&e->lock);
+  rflags = e->flags;
+  e->flags &= ~flags;
+  pthread_mutex_unlock(&e->lock);
+  return rflags;
+}
+
+uint32_t osEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t options, uint32_t timeout) {
+  host_event_t *e = ef_id;
+
+  if (e == NULL) {
+    return osFlagsErrorParameter;
+  }
+  if ((host_irq_active() != 0U) && (timeout != 0U)) {
+    return osFlagsErrorParameter;
+  }
+  return host_flags_wait(&e->lock, &e->cond, &e->flags, flags, options, timeout);
+}
+
+osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id) {
+  host_event_t *e = ef_id;
+
+  if (e == NULL) {
+    return osErrorParameter;
+  }
+  pthread_cond_destroy(&e->cond);
+  pthread_mutex_destroy(&e->lock);
+  free(e);
+  return osOK;
+}
+
+/* Mutexes, not recursive, misuse is fatal instead of returning an error. */
+osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
+  host_mutex_t *m;
+  pthread_mutexattr_t mattr;
+
+  (void)attr;
+  m = calloc(1U, sizeof(host_mutex_t));
+  if (m != NULL) {
+    pthread_mutexattr_init(&mattr);
+    pthread_mutexattr_settype(&mattr, PTHREAD_MUTEX_ERRORCHECK);
+    pthread_mutex_init(&m->lock, &mattr);
+    pthread_mutexattr_destroy(&mattr);
+  }
+  return m;
+}
+
+osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
+  host_mutex_t *m = mutex_id;
+  int rc;
+
+  if (m == NULL) {
+    host_fatal("mutex not created");
+  }
+  if (host_irq_active() != 0U) {
+    host_fatal("mutex acquired from an interrupt");
+  }
+  if (timeout == osWaitForever) {
+    rc = pthread_mutex_lock(&m->lock);
+  } else if (timeout == 0U) {
+    rc = pthread_mutex_trylock(&m->lock);
+  } else {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    ts.tv_sec  += timeout / 1000U;
+    ts.tv_nsec += (long)(timeout % 1000U) * 1000000L;
+    if (ts.tv_nsec >= 1000000000L) {
+      ts.tv_sec  += 1;
+      ts.tv_nsec -= 1000000000L;
+    }
+    rc = pthread_mutex_timedlock(&m->lock, &ts);
+  }
+  if (rc == EDEADLK) {
+    host_fatal("mutex acquired twice by the same thread");
+  }
+  return (rc == 0) ? osOK : ((timeout == 0U) ? osErrorResource : osErrorTimeout);
+}
+
+osStatus_t osMutexRelease (osMutexId_t mutex_id) {
+  host_mutex_t *m = mutex_id;
+
+  if ((m == NULL) || (pthread_mutex_unlock(&m->lock) != 0)) {
+    host_fatal("mutex released by a thread not owning it");
+  }
+  host_preempt_point();
+  return osOK;
+}
+
+osStatus_t osMutexDelete (osMutexId_t mutex_id) {
+  host_mutex_t *m = mutex_id;
+
+  if (m == NULL) {
+    return osErrorParameter;
+  }
+  pthread_mutex_destroy(&m->lock);
+  free(m);
+  return osOK;
+}
+
+/* Semaphores */
+osSemaphoreId_t osSemaphoreNew (uint32_t max_count, uint32_t initial_count, const osSemaphoreAttr_t *attr) {
+  host_sem_t *s;
+
+  (void)attr;
+  if ((max_count == 0U) || (initial_count > max_count)) {
+    return NULL;
+  }
+  s = calloc(1U, sizeof(host_sem_t));
+  if (s != NULL) {
+    pthread_mutex_init(&s->lock, NULL);
+    host_cond_init(&s->cond);
+    s->count = initial_count;
+    s->max   = max_count;
+  }
+  return s;
+}
+
+osStatus_t osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout) {
+  host_sem_t *s = semaphore_id;
+  const struct timespec deadline = host_deadline(timeout);
+  osStatus_t status = osOK;
+
+  if (s == NULL) {
+    return osErrorParameter;
+  }
+  host_preempt_point();
+  pthread_mutex_lock(&s->lock);
+  while (s->count == 0U) {
+    if ((timeout == 0U) || (host_cond_wait(&s->cond, &s->lock, timeout, &deadline) == 0)) {
+      if (s->count == 0U) {
+        status = (timeout == 0U) ? osErrorResource : osErrorTimeout;
+      }
+      break;
+    }
+  }
+  if (status == osOK) {
+    s->count--;
+  }
+  pthread_mutex_unlock(&s->lock);
+  return status;
+}
+
+osStatus_t osSemaphoreRelease (osSemaphoreId_t semaphore_id) {
+  host_sem_t *s = semaphore_id;
+  osStatus_t status = osOK;
+
+  if (s == NULL) {
+    return osErrorParameter;
+  }
+  pthread_mutex_lock(&s->lock);
+  if (s->count < s->max) {
+    s->count++;
+    pthread_cond_signal(&s->cond);
+  } else {
+    status = osErrorResource;
+  }
+  pthread_mutex_unlock(&s->lock);
+  host_preempt_point();
+  return status;
+}
+
+uint32_t osSemaphoreGetCount (osSemaphoreId_t semaphore_id) {
+  host_sem_t *s = semaphore_id;
+  uint32_t count;
+
+  if (s == NULL) {
+    return 0U;
+  }
+  pthread_mutex_lock(&s->lock);
+  count = s->count;
+  pthread_mutex_unlock(&s->lock);
+  return count;
+}
+
+osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
+  host_sem_t *s = semaphore_id;
+
+  if (s == NULL) {
+    return osErrorParameter;
+  }
+  pthread_mutex_destroy(&s->lock);
+  pthread_cond_destroy(&s->cond);
+  free(s);
+  return osOK;
+}
+
+/* Message queues, the priority is ignored. */
+osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
+  host_mq_t *q;
+
+  (void)attr;
+  if ((msg_count == 0U) || (msg_size == 0U)) {
+    return NULL;
+  }
+  q = calloc(1U, sizeof(host_mq_t));
+  if (q != NULL) {
+    q->buf = calloc(msg_count, msg_size);
+    if (q->buf == NULL) {
+      free(q);
+      return NULL;
+    }
+    pthread_mutex_init(&q->lock, NULL);
+    host_cond_init(&q->cond);
+    q->msg_count = msg_count;
+    q->msg_size  = msg_size;
+  }
+  return q;
+}
+
+osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uint8_t msg_prio, uint32_t timeout) {
+  host_mq_t *q = mq_id;
+  const struct timespec deadline = host_deadline(timeout);
+  osStatus_t status = osOK;
+
+  (void)msg_prio;
+  if ((q == NULL) || (msg_ptr == NULL)) {
+    return osErrorParameter;
+  }
+  pthread_mutex_lock(&q->lock);
+  while (q->in == q->msg_count) {
+    if ((timeout == 0U) || (host_cond_wait(&q->cond, &q->lock, timeout, &deadline) == 0)) {
+      if (q->in == q->msg_count) {
+        status = (timeout == 0U) ? osErrorResource : osErrorTimeout;
+      }
+      break;
+    }
+  }
+  if (status == osOK) {
+    memcpy(&q->buf[q->wr * q->msg_size], msg_ptr, q->msg_size);
+    q->wr = (q->wr + 1U) % q->msg_count;
+    q->in++;
+    pthread_cond_broadcast(&q->cond);
+  }
+  pthread_mutex_unlock(&q->lock);
+  return status;
+}
+
+osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *msg_prio, uint32_t timeout) {
+  host_mq_t *q = mq_id;
+  const struct timespec deadline = host_deadline(timeout);
+  osStatus_t status = osOK;
+
+  if ((q == NULL) || (msg_ptr == NULL)) {
+    return osErrorParameter;
+  }
+  pthread_mutex_lock(&q->lock);
+  while (q->in == 0U) {
+    if ((timeout == 0U) || (host_cond_wait(&q->cond, &q->lock, timeout, &deadline) == 0)) {
+      if (q->in == 0U) {
+        status = (timeout == 0U) ? osErrorResource : osErrorTimeout;
+      }
+      break;
+    }
+  }
+  if (status == osOK) {
+    memcpy(msg_ptr, &q->buf[q->rd * q->msg_size], q->msg_size);
+    q->rd = (q->rd + 1U) % q->msg_count;
+    q->in--;
+    if (msg_prio != NULL) {
+      *msg_prio = 0U;
+    }
+    pthread_cond_broadcast(&q->cond);
+  }
+  pthread_mutex_unlock(&q->lock);
+  return status;
+}
+
+uint32_t osMessageQueueGetCount (osMessageQueueId_t mq_id) {
+  host_mq_t *q = mq_id;
+  uint32_t count;
+
+  if (q == NULL) {
+    return 0U;
+  }
+  pthread_mutex_lock(&q->lock);
+  count = q->in;
+  pthread_mutex_unlock(&q->lock);
+  return count;
+}
+
+osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id) {
+  host_mq_t *q = mq_id;
+
+  if (q == NULL) {
+    return osErrorParameter;
+  }
+  pthread_mutex_destroy(&q->lock);
+  pthread_cond_destroy(&q->cond);
+  free(q->buf);
+  free(q);
+  return osOK;
+}
+
+/* Exclusive accesses, emulated with a monitor per thread: the store fails when the */
+/* word was stored exclusively by another thread since the load, like on the target */
+/* where any other exclusive store or a context switch clears the reservation.      */
+#define HOST_EXCL_GENERATIONS  (64U)
+
+static pthread_mutex_t          ExclLock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t                 ExclGeneration[HOST_EXCL_GENERATIONS];
+static __thread volatile void  *ExclAddr;
+static __thread uint32_t        ExclTag;
+
+static uint32_t host_excl_slot (volatile void *addr) {
+  return (uint32_t)(((uintptr_t)addr >> 2) % HOST_EXCL_GENERATIONS);
+}
+
+uint32_t __LDREXW (volatile uint32_t *addr) {
+  uint32_t value;
+
+  pthread_mutex_lock(&ExclLock);
+  value    = *addr;
+  ExclAddr = addr;
+  ExclTag  = ExclGeneration[host_excl_slot(addr)];
+  pthread_mutex_unlock(&ExclLock);
+
+  /* Widen the window between the load and the store to provoke conflicts. */
+  host_preempt_point();
+  return value;
+}
+
+uint32_t __STREXW (uint32_t value, volatile uint32_t *addr) {
+  const uint32_t slot = host_excl_slot(addr);
+  uint32_t failed = 1U;
+
+  pthread_mutex_lock(&ExclLock);
+  if ((ExclAddr == addr) && (ExclTag == ExclGeneration[slot])) {
+    *addr = value;
+    ExclGeneration[slot]++;
+    failed = 0U;
+  }
+  ExclAddr = NULL;
+  pthread_mutex_unlock(&ExclLock);
+  return failed;
+}
+
+void __CLREX (void) {
+  ExclAddr = NULL;
+}
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Minimal STM32U5 HAL and CMSIS core declarations for the host tests.
+ */
+
+#ifndef STM32U5XX_HAL_H
+#define STM32U5XX_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef __IO
+#define __IO volatile
+#endif
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+#define HAL_MAX_DELAY      0xFFFFFFFFU
+
+uint32_t HAL_GetTick(void);
+void     HAL_Delay(uint32_t Delay);
+
+/* Exclusive accesses, emulated in os_host.c. */
+uint32_t __LDREXW(volatile uint32_t *addr);
+uint32_t __STREXW(uint32_t value, volatile uint32_t *addr);
+void     __CLREX(void);
+#define  __DMB()  __sync_synchronize()
+
+/* Interrupt context emulation: code run between host_irq_enter() and host_irq_exit() */
+/* sees a non zero IPSR and the RTOS services fail as they do from an interrupt.      */
+/* Interrupts run one at a time and not while a thread has them disabled.             */
+void     host_irq_enter(void);
+void     host_irq_exit(void);
+uint32_t host_irq_active(void);
+#define __get_IPSR()  host_irq_active()
+
+uint32_t __get_PRIMASK(void);
+void     __set_PRIMASK(uint32_t priMask);
+void     __disable_irq(void);
+
+/* Random preemption in the RTOS services and after the exclusive loads, to provoke */
+/* the races in the stress tests.                                                   */
+void     host_preempt(uint32_t enable);
+
+/* CRC peripheral, emulated in crc_host.c: HAL_CRC_Accumulate computes a 16-bit CRC */
+/* of bytes from DR, which __HAL_CRC_DR_RESET loads with INIT.                      */
+typedef struct
+{
+  __IO uint32_t DR;
+  __IO uint32_t IDR;
+  __IO uint32_t CR;
+  uint32_t      RESERVED;
+  __IO uint32_t INIT;
+  __IO uint32_t POL;
+} CRC_TypeDef;
+
+typedef struct
+{
+  uint8_t  DefaultPolynomialUse;
+  uint8_t  DefaultInitValueUse;
+  uint32_t GeneratingPolynomial;
+  uint32_t CRCLength;
+  uint32_t InitValue;
+  uint32_t InputDataInversionMode;
+  uint32_t OutputDataInversionMode;
+} CRC_InitTypeDef;
+
+typedef struct
+{
+  CRC_TypeDef     *Instance;
+  CRC_InitTypeDef  Init;
+  uint32_t         InputDataFormat;
+} CRC_HandleTypeDef;
+
+extern CRC_TypeDef HostCrc;
+#define CRC                               (&HostCrc)
+
+#define DEFAULT_POLYNOMIAL_DISABLE        ((uint8_t)0x01U)
+#define DEFAULT_INIT_VALUE_DISABLE        ((uint8_t)0x01U)
+#define CRC_POLYLENGTH_16B                (0x08U)
+#define CRC_INPUTDATA_INVERSION_NONE      (0x00U)
+#define CRC_OUTPUTDATA_INVERSION_DISABLE  (0x00U)
+#define CRC_INPUTDATA_FORMAT_BYTES        (0x01U)
+
+#define WRITE_REG(REG, VAL)               ((REG) = (VAL))
+#define __HAL_CRC_DR_RESET(h)             ((h)->Instance->DR = (h)->Instance->INIT)
+
+HAL_StatusTypeDef HAL_CRC_Init(CRC_HandleTypeDef *hcrc);
+HAL_StatusTypeDef HAL_CRC_DeInit(CRC_HandleTypeDef *hcrc);
+uint32_t          HAL_CRC_Accumulate(CRC_HandleTypeDef *hcrc, uint32_t pBuffer[], uint32_t BufferLength);
+
+/* I2C peripheral, emulated in i2c_host.c: register memories of the devices on the */
+/* bus, the interrupt and DMA transfers complete from an interrupt thread.          */
+#define USE_HAL_I2C_REGISTER_CALLBACKS    1U
+
+typedef struct
+{
+  uint32_t Request;
+} DMA_HandleTypeDef;
+
+typedef struct __I2C_HandleTypeDef
+{
+  DMA_HandleTypeDef *hdmatx;
+  DMA_HandleTypeDef *hdmarx;
+  __IO uint32_t      ErrorCode;
+  void (* MasterTxCpltCallback)(struct __I2C_HandleTypeDef *hi2c);
+  void (* MasterRxCpltCallback)(struct __I2C_HandleTypeDef *hi2c);
+  void (* MemTxCpltCallback)(struct __I2C_HandleTypeDef *hi2c);
+  void (* MemRxCpltCallback)(struct __I2C_HandleTypeDef *hi2c);
+  void (* ErrorCallback)(struct __I2C_HandleTypeDef *hi2c);
+  void (* AbortCpltCallback)(struct __I2C_HandleTypeDef *hi2c);
+} I2C_HandleTypeDef;
+
+typedef void (*pI2C_CallbackTypeDef)(I2C_HandleTypeDef *hi2c);
+
+typedef enum
+{
+  HAL_I2C_MASTER_TX_COMPLETE_CB_ID = 0x00U,
+  HAL_I2C_MASTER_RX_COMPLETE_CB_ID = 0x01U,
+  HAL_I2C_MEM_TX_COMPLETE_CB_ID    = 0x05U,
+  HAL_I2C_MEM_RX_COMPLETE_CB_ID    = 0x06U,
+  HAL_I2C_ERROR_CB_ID              = 0x07U,
+  HAL_I2C_ABORT_CB_ID              = 0x08U
+} HAL_I2C_CallbackIDTypeDef;
+
+#define HAL_I2C_ERROR_NONE                (0x00000000U)
+#define HAL_I2C_ERROR_AF                  (0x00000004U)
+#define HAL_I2C_ERROR_TIMEOUT             (0x00000020U)
+
+#define I2C_MEMADD_SIZE_8BIT              (0x00000001U)
+#define I2C_MEMADD_SIZE_16BIT             (0x00000002U)
+
+HAL_StatusTypeDef HAL_I2C_RegisterCallback(I2C_HandleTypeDef *hi2c, HAL_I2C_CallbackIDTypeDef CallbackID,
+                                           pI2C_CallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                          uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Receive(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                         uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Write(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                    uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Mem_Read(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                   uint16_t MemAddSize, uint8_t *pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_IsDeviceReady(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint32_t Trials,
+                                        uint32_t Timeout);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Receive_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                            uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                      uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Transmit_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                              uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Receive_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint8_t *pData,
+                                             uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                        uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef *hi2c, uint16_t DevAddress, uint16_t MemAddress,
+                                       uint16_t MemAddSize, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef HAL_I2C_Master_Abort_IT(I2C_HandleTypeDef *hi2c, uint16_t DevAddress);
+uint32_t          HAL_I2C_GetError(I2C_HandleTypeDef *hi2c);
+
+#endif /* STM32U5XX_HAL_H */
@@ -0,0 +1,386 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * BSP I2C transfer queue on the emulated I2C peripherals.
+ *
+ * I2C1 runs in DMA mode, its reads falling back to interrupt transfers,
+ * I2C2 in polling mode. Threads write and read back the registers of their
+ * own device while an interrupt handler submits reads on I2C1: every
+ * transfer returns its own data, the peripheral is never started while
+ * busy and each submitted transfer completes once, in submission order.
+ * A device which stops responding fails its transfer after the timeout,
+ * transfers queued behind it for longer than the timeout leave the queue,
+ * and the queue continues, also when the abort itself does not complete.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "b_u585i_iot02a_bus.h"
+#include "b_u585i_iot02a_errno.h"
+
+#include "test_host.h"
+
+#define DEV_ADDR(n)         (0x20U + (2U * (n)))  /* Devices of the emulated buses */
+#define DEV_ISR             DEV_ADDR(6U)
+#define DEV_STALL           DEV_ADDR(7U)
+#define DEV_NONE            (0x70U)
+
+#define XFER_THREADS        (4U)      /* Per bus, each with its own device */
+#define XFER_ITERATIONS     (1500U)
+#define XFER_LEN_MAX        (16U)
+#define ISR_LEN             (8U)
+#define ORDER_XFERS         (16U)
+#define BENCH_RUNS          (20000U)
+
+extern volatile uint32_t HostI2cByteNs;
+extern volatile uint32_t HostI2cStallAddr;
+extern volatile uint32_t HostI2cAbortStall;
+extern volatile uint32_t HostI2cOverlaps;
+extern volatile uint32_t HostI2cDmaStarts;
+extern volatile uint32_t HostI2cItStarts;
+
+typedef struct {
+  const char *name;
+  int32_t   (*WriteReg)(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
+  int32_t   (*ReadReg)(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
+  int32_t   (*WriteReg16)(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
+  int32_t   (*ReadReg16)(uint16_t DevAddr, uint16_t Reg, uint8_t *pData, uint16_t Length);
+  int32_t   (*Send)(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
+  int32_t   (*Recv)(uint16_t DevAddr, uint8_t *pData, uint16_t Length);
+  int32_t   (*IsReady)(uint16_t DevAddr, uint32_t Trials);
+  int32_t   (*Submit)(BSP_I2C_Xfer_t *pXfer);
+} bus_t;
+
+static const bus_t Bus[2] = {
+  { "I2C1 (DMA)", BSP_I2C1_WriteReg, BSP_I2C1_ReadReg, BSP_I2C1_WriteReg16, BSP_I2C1_ReadReg16,
+    BSP_I2C1_Send, BSP_I2C1_Recv, BSP_I2C1_IsReady, BSP_I2C1_Submit },
+  { "I2C2 (polling)", BSP_I2C2_WriteReg, BSP_I2C2_ReadReg, BSP_I2C2_WriteReg16, BSP_I2C2_ReadReg16,
+    BSP_I2C2_Send, BSP_I2C2_Recv, BSP_I2C2_IsReady, BSP_I2C2_Submit }
+};
+
+static volatile uint32_t IsrStop;
+static volatile uint32_t IsrSubmits;
+static volatile uint32_t IsrCallbacks;
+static BSP_I2C_Xfer_t    IsrXfer;
+static uint8_t           IsrData[ISR_LEN];
+static const uint8_t     IsrPattern[ISR_LEN] = { 0xA5U, 0x5AU, 0x01U, 0x02U, 0x03U, 0x04U, 0xFEU, 0xEFU };
+
+static BSP_I2C_Xfer_t    OrderXfer[ORDER_XFERS];
+static uint8_t           OrderData[ORDER_XFERS];
+static uint32_t          OrderDone[ORDER_XFERS];
+static volatile uint32_t OrderCount;
+
+typedef struct {
+  const bus_t     *bus;
+  volatile int32_t status;
+} stall_t;
+
+static void random_fill (uint8_t *data, uint32_t len) {
+  for (uint32_t i = 0U; i < len; i++) {
+    data[i] = (uint8_t)rand();
+  }
+}
+
+static void check_basic (const bus_t *bus) {
+  uint8_t wr[XFER_LEN_MAX], rd[XFER_LEN_MAX];
+  BSP_I2C_Xfer_t xfer;
+
+  random_fill(wr, sizeof(wr));
+  TEST_CHECK(bus->WriteReg(DEV_ADDR(0U), 0x10U, wr, 4U) == BSP_ERROR_NONE);
+  TEST_CHECK(bus->ReadReg(DEV_ADDR(0U), 0x10U, rd, 4U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(wr, rd, 4U) == 0);
+
+  random_fill(wr, sizeof(wr));
+  TEST_CHECK(bus->WriteReg16(DEV_ADDR(0U), 0x1234U, wr, XFER_LEN_MAX) == BSP_ERROR_NONE);
+  TEST_CHECK(bus->ReadReg16(DEV_ADDR(0U), 0x1234U, rd, XFER_LEN_MAX) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(wr, rd, XFER_LEN_MAX) == 0);
+
+  random_fill(wr, sizeof(wr));
+  TEST_CHECK(bus->Send(DEV_ADDR(1U), wr, 3U) == BSP_ERROR_NONE);
+  TEST_CHECK(bus->Recv(DEV_ADDR(1U), rd, 3U) == BSP_ERROR_NONE);
+  TEST_CHECK(memcmp(wr, rd, 3U) == 0);
+
+  /* Not acknowledged, the queue continues */
+  TEST_CHECK(bus->ReadReg(DEV_NONE, 0x10U, rd, 4U) == BSP_ERROR_BUS_ACKNOWLEDGE_FAILURE);
+  TEST_CHECK(bus->IsReady(DEV_NONE, 1U) == BSP_ERROR_BUSY);
+  TEST_CHECK(bus->IsReady(DEV_ADDR(0U), 1U) == BSP_ERROR_NONE);
+  TEST_CHECK(bus->ReadReg(DEV_ADDR(0U), 0x10U, rd, 1U) == BSP_ERROR_NONE);
+
+  TEST_CHECK(bus->Submit(NULL) == BSP_ERROR_WRONG_PARAM);
+  memset(&xfer, 0, sizeof(xfer));
+  xfer.Dir = BSP_I2C_XFER_RECV + 1U;
+  TEST_CHECK(bus->Submit(&xfer) == BSP_ERROR_WRONG_PARAM);
+}
+
+/* Register accesses of one device, checked against a copy of its registers. */
+static void xfer_thread (void *arg) {
+  const uint32_t id  = (uint32_t)(uintptr_t)arg;
+  const bus_t   *bus = &Bus[id / XFER_THREADS];
+  const uint16_t dev = (uint16_t)DEV_ADDR(id % XFER_THREADS);
+  uint8_t regs[256U + XFER_LEN_MAX];
+  uint8_t data[XFER_LEN_MAX];
+
+  memset(regs, 0, sizeof(regs));
+  TEST_CHECK(bus->WriteReg(dev, 0U, regs, 255U) == BSP_ERROR_NONE);
+  for (uint32_t n = 0U; n < XFER_ITERATIONS; n++) {
+    const uint32_t op  = (uint32_t)rand() % 8U;
+    const uint16_t reg = (uint16_t)((uint32_t)rand() % 240U);
+    const uint16_t len = (uint16_t)(1U + ((uint32_t)rand() % XFER_LEN_MAX));
+
+    if (op < 4U) {
+      random_fill(data, len);
+      TEST_CHECK(bus->WriteReg(dev, reg, data, len) == BSP_ERROR_NONE);
+      memcpy(&regs[reg], data, len);
+    } else if (op < 7U) {
+      memset(data, 0, sizeof(data));
+      TEST_CHECK(bus->ReadReg(dev, reg, data, len) == BSP_ERROR_NONE);
+      TEST_CHECK(memcmp(&regs[reg], data, len) == 0);
+    } else {
+      TEST_CHECK(bus->IsReady(dev, 1U) == BSP_ERROR_NONE);
+    }
+  }
+}
+
+static void isr_callback (BSP_I2C_Xfer_t *pXfer) {
+  TEST_CHECK(pXfer == &IsrXfer);
+  TEST_CHECK(host_irq_active() != 0U);
+  IsrCallbacks++;
+}
+
+/* Interrupt handler reading a device with BSP_I2C1_Submit while the threads use the bus. */
+static void isr_thread (void *arg) {
+  const struct timespec ts = { 0, 50000L };
+  uint8_t data[1];
+
+  (void)arg;
+  host_irq_enter();
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_ISR, 0U, data, 1U) == BSP_ERROR_FEATURE_NOT_SUPPORTED);
+  TEST_CHECK(BSP_I2C1_IsReady(DEV_ISR, 1U) == BSP_ERROR_FEATURE_NOT_SUPPORTED);
+  host_irq_exit();
+
+  while (IsrStop == 0U) {
+    nanosleep(&ts, NULL);
+    host_irq_enter();
+    if (IsrXfer.Status != BSP_ERROR_BUSY) {
+      if (IsrSubmits != 0U) {
+        TEST_CHECK(IsrXfer.Status == BSP_ERROR_NONE);
+        TEST_CHECK(memcmp(IsrData, IsrPattern, ISR_LEN) == 0);
+      }
+      memset(IsrData, 0, ISR_LEN);
+      IsrXfer.DevAddr    = DEV_ISR;
+      IsrXfer.Reg        = 0U;
+      IsrXfer.MemAddSize = I2C_MEMADD_SIZE_8BIT;
+      IsrXfer.Length     = ISR_LEN;
+      IsrXfer.pData      = IsrData;
+      IsrXfer.Dir        = BSP_I2C_XFER_READ;
+      IsrXfer.Callback   = isr_callback;
+      TEST_CHECK(BSP_I2C1_Submit(&IsrXfer) == BSP_ERROR_NONE);
+      IsrSubmits++;
+    }
+    host_irq_exit();
+  }
+
+  for (uint32_t n = 0U; (n < 1000U) && (IsrXfer.Status == BSP_ERROR_BUSY); n++) {
+    osDelay(1U);
+  }
+  TEST_CHECK(IsrXfer.Status == BSP_ERROR_NONE);
+}
+
+static void check_concurrent (void) {
+  osThreadId_t thread[2U * XFER_THREADS];
+  osThreadId_t isr;
+
+  TEST_CHECK(BSP_I2C1_WriteReg(DEV_ISR, 0U, (uint8_t *)IsrPattern, ISR_LEN) == BSP_ERROR_NONE);
+  IsrXfer.Status = BSP_ERROR_NONE;
+
+  host_preempt(1U);
+  isr = osThreadNew(isr_thread, NULL, NULL);
+  for (uint32_t i = 0U; i < (2U * XFER_THREADS); i++) {
+    thread[i] = osThreadNew(xfer_thread, (void *)(uintptr_t)i, NULL);
+  }
+  for (uint32_t i = 0U; i < (2U * XFER_THREADS); i++) {
+    osThreadJoin(thread[i]);
+  }
+  IsrStop = 1U;
+  osThreadJoin(isr);
+  host_preempt(0U);
+
+  TEST_CHECK(IsrSubmits > 0U);
+  TEST_CHECK(IsrCallbacks == IsrSubmits);
+  TEST_CHECK(HostI2cDmaStarts > 0U);
+  TEST_CHECK(HostI2cItStarts > 0U);
+  fprintf(stderr, "interrupt handler transfers %u, DMA starts %u, interrupt starts %u\n",
+          (unsigned)IsrSubmits, (unsigned)HostI2cDmaStarts, (unsigned)HostI2cItStarts);
+}
+
+static void order_callback (BSP_I2C_Xfer_t *pXfer) {
+  const uint32_t n = __atomic_fetch_add(&OrderCount, 1U, __ATOMIC_SEQ_CST);
+
+  if (n < ORDER_XFERS) {
+    OrderDone[n] = (uint32_t)(pXfer - OrderXfer);
+  }
+}
+
+/* Transfers submitted back to back complete in submission order, reads see the writes before them. */
+static void check_order (const bus_t *bus) {
+  OrderCount = 0U;
+  for (uint32_t i = 0U; i < ORDER_XFERS; i++) {
+    BSP_I2C_Xfer_t *xfer = &OrderXfer[i];
+
+    memset(xfer, 0, sizeof(*xfer));
+    xfer->DevAddr    = DEV_ADDR(2U);
+    xfer->Reg        = (uint16_t)(0x80U + (i / 2U));
+    xfer->MemAddSize = I2C_MEMADD_SIZE_8BIT;
+    xfer->Length     = 1U;
+    xfer->pData      = &OrderData[i];
+    xfer->Dir        = ((i % 2U) == 0U) ? BSP_I2C_XFER_WRITE : BSP_I2C_XFER_READ;
+    xfer->Callback   = order_callback;
+    OrderData[i]     = ((i % 2U) == 0U) ? (uint8_t)(0x40U + i) : 0U;
+  }
+  for (uint32_t i = 0U; i < ORDER_XFERS; i++) {
+    TEST_CHECK(bus->Submit(&OrderXfer[i]) == BSP_ERROR_NONE);
+  }
+  for (uint32_t n = 0U; (n < 1000U) && (OrderCount < ORDER_XFERS); n++) {
+    osDelay(1U);
+  }
+
+  TEST_CHECK(OrderCount == ORDER_XFERS);
+  for (uint32_t i = 0U; i < ORDER_XFERS; i++) {
+    TEST_CHECK(OrderDone[i] == i);
+    TEST_CHECK(OrderXfer[i].Status == BSP_ERROR_NONE);
+    TEST_CHECK(OrderData[i] == (uint8_t)(0x40U + (i & ~1U)));
+  }
+}
+
+static void stall_thread (void *arg) {
+  stall_t *stall = arg;
+  uint8_t data[2];
+
+  stall->status = stall->bus->ReadReg(DEV_STALL, 0U, data, 2U);
+}
+
+/* A device not responding fails its transfer after the timeout, the transfer queued behind succeeds. */
+static void check_stall (const bus_t *bus) {
+  stall_t stall = { bus, BSP_ERROR_BUSY };
+  osThreadId_t thread;
+  uint8_t data[1] = { 0x5AU };
+  uint64_t t0;
+
+  HostI2cStallAddr = DEV_STALL;
+  t0 = test_time_ns();
+  thread = osThreadNew(stall_thread, &stall, NULL);
+  osDelay(BUS_I2C_POLL_TIMEOUT / 2U);
+  TEST_CHECK(bus->WriteReg(DEV_ADDR(3U), 0U, data, 1U) == BSP_ERROR_NONE);
+  osThreadJoin(thread);
+  TEST_CHECK(stall.status == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK((test_time_ns() - t0) >= (BUS_I2C_POLL_TIMEOUT * 1000000ULL));
+  HostI2cStallAddr = 0U;
+
+  data[0] = 0U;
+  TEST_CHECK(bus->ReadReg(DEV_ADDR(3U), 0U, data, 1U) == BSP_ERROR_NONE);
+  TEST_CHECK(data[0] == 0x5AU);
+}
+
+/* Polling: a transfer queued behind two stalled ones times out and leaves the queue, */
+/* the one submitted after it executes once the bus is free again.                    */
+static void check_queue_timeout (void) {
+  stall_t stall[2] = { { &Bus[1], BSP_ERROR_BUSY }, { &Bus[1], BSP_ERROR_BUSY } };
+  osThreadId_t thread[2];
+  uint8_t data[1] = { 0xC3U };
+
+  HostI2cStallAddr = DEV_STALL;
+  thread[0] = osThreadNew(stall_thread, &stall[0], NULL);
+  osDelay(1U);
+  thread[1] = osThreadNew(stall_thread, &stall[1], NULL);
+  osDelay(BUS_I2C_POLL_TIMEOUT / 4U);
+  TEST_CHECK(BSP_I2C2_WriteReg(DEV_ADDR(3U), 1U, data, 1U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(BSP_I2C2_WriteReg(DEV_ADDR(3U), 2U, data, 1U) == BSP_ERROR_NONE);
+  osThreadJoin(thread[0]);
+  osThreadJoin(thread[1]);
+  TEST_CHECK(stall[0].status == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK(stall[1].status == BSP_ERROR_PERIPH_FAILURE);
+  HostI2cStallAddr = 0U;
+
+  data[0] = 0U;
+  TEST_CHECK(BSP_I2C2_ReadReg(DEV_ADDR(3U), 2U, data, 1U) == BSP_ERROR_NONE);
+  TEST_CHECK(data[0] == 0xC3U);
+}
+
+/* The abort does not complete either: the transfer is removed after a second timeout. */
+static void check_abort_stall (void) {
+  static uint8_t data[2];
+  uint64_t t0;
+
+  HostI2cStallAddr  = DEV_STALL;
+  HostI2cAbortStall = 1U;
+  t0 = test_time_ns();
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_STALL, 0U, data, 2U) == BSP_ERROR_PERIPH_FAILURE);
+  TEST_CHECK((test_time_ns() - t0) >= (2U * BUS_I2C_POLL_TIMEOUT * 1000000ULL));
+
+  /* The late abort completion belongs to no transfer any more */
+  HostI2cAbortStall = 0U;
+  HostI2cStallAddr  = 0U;
+  osDelay(2U);
+  TEST_CHECK(BSP_I2C1_ReadReg(DEV_ADDR(3U), 0U, data, 1U) == BSP_ERROR_NONE);
+  TEST_CHECK(data[0] == 0x5AU);
+}
+
+static void bench (void) {
+  uint8_t data[1];
+  uint64_t t0, t[2];
+
+  HostI2cByteNs = 0U;
+  for (uint32_t b = 0U; b < 2U; b++) {
+    t0 = test_time_ns();
+    for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+      (void)Bus[b].ReadReg(DEV_ADDR(0U), 0U, data, 1U);
+    }
+    t[b] = test_time_ns() - t0;
+  }
+
+  fprintf(stderr, "register read %s %.2f us, %s %.2f us\n",
+          Bus[0].name, (double)t[0] / (1000.0 * BENCH_RUNS), Bus[1].name, (double)t[1] / (1000.0 * BENCH_RUNS));
+}
+
+int main (void) {
+  static DMA_HandleTypeDef hdma_i2c1_tx;
+
+  srand(1U);
+
+  /* I2C1 has a transmit DMA channel only */
+  hi2c1.hdmatx = &hdma_i2c1_tx;
+  TEST_CHECK(BSP_I2C1_Init() == BSP_ERROR_NONE);
+  TEST_CHECK(BSP_I2C2_Init() == BSP_ERROR_NONE);
+
+  for (uint32_t b = 0U; b < 2U; b++) {
+    check_basic(&Bus[b]);
+    check_order(&Bus[b]);
+  }
+  check_concurrent();
+  for (uint32_t b = 0U; b < 2U; b++) {
+    check_stall(&Bus[b]);
+  }
+  check_queue_timeout();
+  check_abort_stall();
+  TEST_CHECK(HostI2cOverlaps == 0U);
+
+  bench();
+
+  return TEST_RESULT("bsp_i2c");
+}
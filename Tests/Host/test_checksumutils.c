@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * mx_wifi CRC8/CRC16 checksums against bitwise references.
+ *
+ * Check values, random buffers updated in random pieces, and a micro
+ * benchmark of the table driven CRCs. The CRC16 peripheral path runs on
+ * the emulated peripheral, also from concurrent threads which must fall
+ * back to the table while another one owns the peripheral.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "checksumutils.h"
+#include "cmsis_os2.h"
+
+#include "test_host.h"
+
+#define BUF_SIZE_MAX        (2048U)
+#define SPLIT_RUNS          (2000U)
+#define BENCH_SIZE          (1500U)
+#define BENCH_RUNS          (20000U)
+#define HW_THREADS          (4U)
+#define HW_RUNS             (300U)
+
+extern volatile uint32_t HostCrcAccumulates;
+
+/* CRC-8/MAXIM, reflected polynomial 0x8C, one bit at a time. */
+static uint8_t crc8_ref (const uint8_t *data, size_t len) {
+  uint8_t crc = 0U;
+
+  for (size_t i = 0U; i < len; i++) {
+    crc ^= data[i];
+    for (uint32_t bit = 0U; bit < 8U; bit++) {
+      crc = ((crc & 1U) != 0U) ? (uint8_t)((crc >> 1) ^ 0x8CU) : (uint8_t)(crc >> 1);
+    }
+  }
+  return crc;
+}
+
+/* CRC-16/XMODEM, polynomial 0x1021, one bit at a time. */
+static uint16_t crc16_ref (const uint8_t *data, size_t len) {
+  uint16_t crc = 0U;
+
+  for (size_t i = 0U; i < len; i++) {
+    crc ^= (uint16_t)((uint16_t)data[i] << 8);
+    for (uint32_t bit = 0U; bit < 8U; bit++) {
+      crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+    }
+  }
+  return crc;
+}
+
+static void random_fill (uint8_t *data, size_t len) {
+  for (size_t i = 0U; i < len; i++) {
+    data[i] = (uint8_t)rand();
+  }
+}
+
+/* CRC16 of a buffer updated in random pieces. */
+static uint16_t crc16_split (const uint8_t *data, size_t len) {
+  CRC16_Context ctx;
+  uint16_t crc;
+  size_t done = 0U;
+
+  CRC16_Init(&ctx);
+  while (done < len) {
+    size_t piece = (size_t)rand() % (len - done + 1U);
+
+    if ((rand() % 4) == 0) {
+      piece = len - done;
+    }
+    CRC16_Update(&ctx, &data[done], piece);
+    done += piece;
+  }
+  CRC16_Final(&ctx, &crc);
+  return crc;
+}
+
+static uint8_t crc8_split (const uint8_t *data, size_t len) {
+  CRC8_Context ctx;
+  uint8_t crc;
+  size_t done = 0U;
+
+  CRC8_Init(&ctx);
+  while (done < len) {
+    const size_t piece = (size_t)rand() % (len - done + 1U);
+
+    CRC8_Update(&ctx, &data[done], piece);
+    done += piece;
+  }
+  CRC8_Final(&ctx, &crc);
+  return crc;
+}
+
+static void check_values (void) {
+  static const uint8_t check[] = "123456789";
+  CRC8_Context ctx8;
+  CRC16_Context ctx16;
+  uint8_t crc8;
+  uint16_t crc16;
+
+  CRC8_Init(&ctx8);
+  CRC8_Update(&ctx8, check, 9U);
+  CRC8_Final(&ctx8, &crc8);
+  TEST_CHECK(crc8 == 0xA1U);
+
+  CRC16_Init(&ctx16);
+  CRC16_Update(&ctx16, check, 9U);
+  CRC16_Final(&ctx16, &crc16);
+  TEST_CHECK(crc16 == 0x31C3U);
+
+  TEST_CHECK(crc8_ref(check, 9U) == 0xA1U);
+  TEST_CHECK(crc16_ref(check, 9U) == 0x31C3U);
+}
+
+static void check_splits (void) {
+  static uint8_t data[BUF_SIZE_MAX];
+
+  for (uint32_t n = 0U; n < SPLIT_RUNS; n++) {
+    const size_t len = (size_t)rand() % (BUF_SIZE_MAX + 1U);
+
+    random_fill(data, len);
+    TEST_CHECK(crc16_split(data, len) == crc16_ref(data, len));
+    TEST_CHECK(crc8_split(data, len) == crc8_ref(data, len));
+  }
+}
+
+static void bench (void) {
+  static uint8_t data[BENCH_SIZE];
+  CRC16_Context ctx16;
+  CRC8_Context ctx8;
+  volatile uint32_t sink = 0U;
+  uint64_t t0, t_table16, t_ref16, t_table8;
+
+  random_fill(data, sizeof(data));
+
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    uint16_t crc;
+
+    CRC16_Init(&ctx16);
+    CRC16_Update(&ctx16, data, sizeof(data));
+    CRC16_Final(&ctx16, &crc);
+    sink += crc;
+  }
+  t_table16 = test_time_ns() - t0;
+
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    sink += crc16_ref(data, sizeof(data));
+  }
+  t_ref16 = test_time_ns() - t0;
+
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    uint8_t crc;
+
+    CRC8_Init(&ctx8);
+    CRC8_Update(&ctx8, data, sizeof(data));
+    CRC8_Final(&ctx8, &crc);
+    sink += crc;
+  }
+  t_table8 = test_time_ns() - t0;
+  (void)sink;
+
+  fprintf(stderr, "crc16 table %.2f ns/byte, bitwise %.2f ns/byte, crc8 table %.2f ns/byte\n",
+          (double)t_table16 / (BENCH_RUNS * (double)BENCH_SIZE),
+          (double)t_ref16 / (BENCH_RUNS * (double)BENCH_SIZE),
+          (double)t_table8 / (BENCH_RUNS * (double)BENCH_SIZE));
+}
+
+/* Concurrent CRC16 with the peripheral: only one computation may use it at a time. */
+static void hw_thread (void *arg) {
+  static __thread uint8_t data[BUF_SIZE_MAX];
+
+  (void)arg;
+  for (uint32_t n = 0U; n < HW_RUNS; n++) {
+    const size_t len = 64U + ((size_t)rand() % (BUF_SIZE_MAX - 63U));
+
+    random_fill(data, len);
+    TEST_CHECK(crc16_split(data, len) == crc16_ref(data, len));
+  }
+}
+
+static void check_hw (void) {
+  static CRC_HandleTypeDef hcrc;
+  static uint8_t data[BUF_SIZE_MAX];
+  osThreadId_t thread[HW_THREADS];
+  CRC16_Context ctx;
+  uint32_t accumulates;
+  uint16_t crc;
+
+  TEST_CHECK(HW_CRC16_Init(&hcrc) == 0);
+
+  accumulates = HostCrcAccumulates;
+  random_fill(data, sizeof(data));
+  CRC16_Init(&ctx);
+  CRC16_Update(&ctx, data, 9U);
+  CRC16_Update(&ctx, &data[9], sizeof(data) - 9U);
+  CRC16_Final(&ctx, &crc);
+  TEST_CHECK(crc == crc16_ref(data, sizeof(data)));
+  TEST_CHECK(HostCrcAccumulates == (accumulates + 1U));
+  TEST_CHECK(crc16_split(data, sizeof(data)) == crc16_ref(data, sizeof(data)));
+
+  for (uint32_t i = 0U; i < HW_THREADS; i++) {
+    thread[i] = osThreadNew(hw_thread, NULL, NULL);
+  }
+  for (uint32_t i = 0U; i < HW_THREADS; i++) {
+    osThreadJoin(thread[i]);
+  }
+}
+
+int main (void) {
+  srand(1U);
+
+  /* Table path, the peripheral is not initialized yet. */
+  check_values();
+  check_splits();
+  bench();
+  TEST_CHECK(HostCrcAccumulates == 0U);
+
+  check_hw();
+
+  return TEST_RESULT("checksumutils");
+}
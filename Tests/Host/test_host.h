@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * Checks shared by the host tests.
+ */
+
+#ifndef TEST_HOST_H_
+#define TEST_HOST_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+static volatile uint32_t TestFailures;
+
+/* Record a failed check and continue. */
+#define TEST_CHECK(cond)                                                        \
+  do {                                                                          \
+    if (!(cond)) {                                                              \
+      fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond);  \
+      __atomic_fetch_add(&TestFailures, 1U, __ATOMIC_RELAXED);                  \
+    }                                                                           \
+  } while (0)
+
+/* Result of the test program. */
+#define TEST_RESULT(name)                                                                   \
+  ((TestFailures == 0U) ? (fprintf(stderr, "%s: PASS\n", (name)), 0)                       \
+                        : (fprintf(stderr, "%s: FAIL (%u)\n", (name), (unsigned)TestFailures), 1))
+
+/* Time in nanoseconds for the micro benchmarks. */
+static inline uint64_t test_time_ns (void) {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+#endif /* TEST_HOST_H_ */
@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * mx_wifi receive buffer pool under concurrent allocation and release.
+ *
+ * Threads allocate more buffers than the pool holds, fill them with their
+ * own pattern and check it before release. Part of the buffers is released
+ * by another thread. A block handed out twice shows up as a broken pattern,
+ * a lost block as missing pool capacity at the end.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mx_wifi.h"
+
+#include "test_host.h"
+
+#define POOL_THREADS        (8U)
+#define POOL_ITERATIONS     (20000U)
+#define POOL_HOLD_MAX       (4U)      /* Buffers held at the same time by a thread */
+#define POOL_HANDOVER_SIZE  (64U)
+
+static osMessageQueueId_t Handover;
+
+static void fill (mx_buf_t *buf, uint32_t tag) {
+  uint8_t *data = MX_NET_BUFFER_PAYLOAD(buf);
+
+  memcpy(data, &tag, sizeof(tag));
+  memset(&data[sizeof(tag)], (int)(tag & 0xFFU), MX_NET_BUFFER_GET_PAYLOAD_SIZE(buf) - sizeof(tag));
+}
+
+static uint32_t check (mx_buf_t *buf, uint32_t tag) {
+  const uint8_t *data = MX_NET_BUFFER_PAYLOAD(buf);
+  const uint32_t len = MX_NET_BUFFER_GET_PAYLOAD_SIZE(buf);
+  uint32_t value;
+
+  memcpy(&value, data, sizeof(value));
+  if (value != tag) {
+    return 0U;
+  }
+  for (uint32_t i = sizeof(tag); i < len; i++) {
+    if (data[i] != (uint8_t)tag) {
+      return 0U;
+    }
+  }
+  return 1U;
+}
+
+static uint32_t random_len (void) {
+  return 8U + ((uint32_t)rand() % (MX_WIFI_BUFFER_SIZE - 7U));
+}
+
+static void pool_thread (void *arg) {
+  const uint32_t id = (uint32_t)(uintptr_t)arg;
+  mx_buf_t *held[POOL_HOLD_MAX];
+  uint32_t tag[POOL_HOLD_MAX];
+
+  for (uint32_t n = 0U; n < POOL_ITERATIONS; n++) {
+    const uint32_t count = 1U + ((uint32_t)rand() % POOL_HOLD_MAX);
+
+    for (uint32_t i = 0U; i < count; i++) {
+      held[i] = MX_NET_BUFFER_ALLOC(random_len());
+      TEST_CHECK(held[i] != NULL);
+      tag[i] = (id << 24) | ((n & 0xFFFFU) << 8) | i;
+      fill(held[i], tag[i]);
+    }
+    osThreadYield();
+    for (uint32_t i = 0U; i < count; i++) {
+      TEST_CHECK(check(held[i], tag[i]) != 0U);
+      if ((i == 0U) && ((n % 3U) == 0U)) {
+        TEST_CHECK(osMessageQueuePut(Handover, &held[i], 0U, osWaitForever) == osOK);
+      } else {
+        MX_NET_BUFFER_FREE(held[i]);
+      }
+    }
+  }
+}
+
+/* Releases the buffers handed over by the other threads. */
+static void release_thread (void *arg) {
+  mx_buf_t *buf;
+
+  (void)arg;
+  while (osMessageQueueGet(Handover, &buf, NULL, osWaitForever) == osOK) {
+    if (buf == NULL) {
+      break;
+    }
+    MX_NET_BUFFER_FREE(buf);
+  }
+}
+
+/* The whole pool is available again, each block once. */
+static void check_pool_intact (void) {
+  mx_buf_t *buf[MX_WIFI_RX_BUFFER_POOL_COUNT];
+  mx_buf_pool_stat_t before, after;
+
+  mx_buf_pool_get_stat(&before);
+  TEST_CHECK(before.used == 0U);
+  for (uint32_t i = 0U; i < MX_WIFI_RX_BUFFER_POOL_COUNT; i++) {
+    buf[i] = MX_NET_BUFFER_ALLOC(MX_WIFI_BUFFER_SIZE);
+    TEST_CHECK(buf[i] != NULL);
+    fill(buf[i], i);
+  }
+  mx_buf_pool_get_stat(&after);
+  TEST_CHECK(after.heap_allocs == before.heap_allocs);
+  TEST_CHECK(after.used == MX_WIFI_RX_BUFFER_POOL_COUNT);
+  for (uint32_t i = 0U; i < MX_WIFI_RX_BUFFER_POOL_COUNT; i++) {
+    TEST_CHECK(check(buf[i], i) != 0U);
+    MX_NET_BUFFER_FREE(buf[i]);
+  }
+  mx_buf_pool_get_stat(&after);
+  TEST_CHECK(after.used == 0U);
+}
+
+int main (void) {
+  osThreadId_t thread[POOL_THREADS];
+  osThreadId_t release;
+  mx_buf_t *end = NULL;
+  mx_buf_pool_stat_t stat;
+
+  srand(1U);
+  host_preempt(1U);
+
+  check_pool_intact();
+
+  Handover = osMessageQueueNew(POOL_HANDOVER_SIZE, sizeof(mx_buf_t *), NULL);
+  release  = osThreadNew(release_thread, NULL, NULL);
+  for (uint32_t i = 0U; i < POOL_THREADS; i++) {
+    thread[i] = osThreadNew(pool_thread, (void *)(uintptr_t)i, NULL);
+  }
+  for (uint32_t i = 0U; i < POOL_THREADS; i++) {
+    osThreadJoin(thread[i]);
+  }
+  osMessageQueuePut(Handover, &end, 0U, osWaitForever);
+  osThreadJoin(release);
+  osMessageQueueDelete(Handover);
+
+  mx_buf_pool_get_stat(&stat);
+  TEST_CHECK(stat.used_max == MX_WIFI_RX_BUFFER_POOL_COUNT);
+  TEST_CHECK(stat.heap_allocs > 0U);
+  check_pool_intact();
+
+  fprintf(stderr, "pool allocs %u, heap allocs %u, used max %u of %u\n",
+          (unsigned)stat.allocs, (unsigned)stat.heap_allocs, (unsigned)stat.used_max, (unsigned)stat.count);
+
+  return TEST_RESULT("mx_buf_pool");
+}
@@ -0,0 +1,264 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * mx_wifi IPC requests from concurrent threads against an emulated module.
+ *
+ * The module echoes the command params. Prompt requests are answered at
+ * once and must always succeed with their own echo. Late requests are
+ * answered around their timeout: they may time out, but must never get
+ * the answer of another request or leave a signal behind for the next
+ * user of their request entry.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mx_wifi.h"
+#include "core/mx_wifi_ipc.h"
+#include "core/mx_wifi_hci.h"
+#include "io_pattern/mx_wifi_io.h"
+
+#include "test_host.h"
+
+#define REQ_THREADS         (8U)      /* More than the request entries */
+#define REQ_ITERATIONS      (1500U)
+#define REQ_TIMEOUT         (2000U)   /* Prompt requests */
+#define REQ_LATENCY_MAX     (500U)    /* Prompt requests, a lost answer signal ends in the timeout */
+#define REQ_LATE_TIMEOUT    (4U)      /* Late requests, answered 0..8 ms after the command */
+#define REQ_PARAMS_MAX      (48U)     /* Above the inline params size with the data */
+
+#define MODE_PROMPT         (0U)
+#define MODE_LATE           (1U)
+
+/* Command seen by the emulated module */
+typedef struct {
+  uint32_t tick;
+  uint16_t len;
+  uint8_t  frame[MIPC_HEADER_SIZE + (2U * REQ_PARAMS_MAX)];
+} emu_cmd_t;
+
+static MX_WIFIObject_t    WifiObj;
+static osMessageQueueId_t EmuQueue[2];
+static volatile uint32_t  Stop;
+static volatile uint32_t  Answered;
+static volatile uint32_t  LateTimeouts;
+static volatile uint32_t  LateAnswers;
+
+MX_WIFIObject_t *wifi_obj_get (void) {
+  return &WifiObj;
+}
+
+void process_txrx_poll (uint32_t timeout) {
+  (void)timeout;
+}
+
+/* The first params byte selects how the module answers. */
+static void emu_receive (emu_cmd_t *cmd) {
+  const uint32_t mode = (cmd->len > MIPC_PKT_PARAMS_OFFSET) ? cmd->frame[MIPC_PKT_PARAMS_OFFSET] : MODE_PROMPT;
+
+  cmd->tick = HAL_GetTick();
+  TEST_CHECK(osMessageQueuePut(EmuQueue[mode & 1U], &cmd, 0U, osWaitForever) == osOK);
+}
+
+static uint16_t emu_send (uint8_t *data, uint16_t size) {
+  emu_cmd_t *cmd = malloc(sizeof(emu_cmd_t));
+
+  TEST_CHECK((cmd != NULL) && (size <= sizeof(cmd->frame)));
+  memcpy(cmd->frame, data, size);
+  cmd->len = size;
+  emu_receive(cmd);
+  return size;
+}
+
+static uint16_t emu_sendv (const MX_WIFI_IO_Segment_t *seg, uint8_t seg_count) {
+  emu_cmd_t *cmd = malloc(sizeof(emu_cmd_t));
+  uint16_t len = 0U;
+
+  TEST_CHECK(cmd != NULL);
+  for (uint8_t i = 0U; i < seg_count; i++) {
+    TEST_CHECK((len + seg[i].len) <= sizeof(cmd->frame));
+    memcpy(&cmd->frame[len], seg[i].data, seg[i].len);
+    len += seg[i].len;
+  }
+  cmd->len = len;
+  emu_receive(cmd);
+  return len;
+}
+
+/* Module answering the commands of one queue, the late one after a random delay. */
+static void emu_thread (void *arg) {
+  const uint32_t mode = (uint32_t)(uintptr_t)arg;
+  emu_cmd_t *cmd;
+
+  while (osMessageQueueGet(EmuQueue[mode], &cmd, NULL, osWaitForever) == osOK) {
+    mx_buf_t *nbuf;
+
+    if (cmd == NULL) {
+      break;
+    }
+    if (mode == MODE_LATE) {
+      const uint32_t due = cmd->tick + ((uint32_t)rand() % (2U * REQ_LATE_TIMEOUT + 1U));
+      const uint32_t now = HAL_GetTick();
+
+      if ((int32_t)(due - now) > 0) {
+        osDelay(due - now);
+      }
+    }
+    nbuf = MX_NET_BUFFER_ALLOC(cmd->len);
+    TEST_CHECK(nbuf != NULL);
+    memcpy(MX_NET_BUFFER_PAYLOAD(nbuf), cmd->frame, cmd->len);
+    MX_NET_BUFFER_SET_PAYLOAD_SIZE(nbuf, cmd->len);
+    free(cmd);
+    mx_wifi_hci_input(nbuf);
+  }
+}
+
+/* Receive thread of the driver */
+static void rx_thread (void *arg) {
+  (void)arg;
+  while (Stop == 0U) {
+    mipc_poll(10U);
+  }
+}
+
+static void req_thread (void *arg) {
+  const uint8_t id = (uint8_t)(uintptr_t)arg;
+  uint8_t cparams[REQ_PARAMS_MAX];
+  uint8_t data[REQ_PARAMS_MAX];
+  uint8_t rbuffer[2U * REQ_PARAMS_MAX];
+  uint8_t expect[2U * REQ_PARAMS_MAX];
+
+  for (uint32_t n = 0U; n < REQ_ITERATIONS; n++) {
+    const uint8_t mode = ((rand() % 4) == 0) ? MODE_LATE : MODE_PROMPT;
+    const uint16_t cparams_size = (uint16_t)(6U + ((uint32_t)rand() % (REQ_PARAMS_MAX - 5U)));
+    const uint16_t data_size = ((rand() % 2) == 0) ? 0U : (uint16_t)(1U + ((uint32_t)rand() % REQ_PARAMS_MAX));
+    uint16_t rbuffer_size = (uint16_t)sizeof(rbuffer);
+    uint32_t tick;
+    int32_t ret;
+
+    cparams[0] = mode;
+    cparams[1] = id;
+    memcpy(&cparams[2], &n, sizeof(n));
+    for (uint16_t i = 6U; i < cparams_size; i++) {
+      cparams[i] = (uint8_t)rand();
+    }
+    for (uint16_t i = 0U; i < data_size; i++) {
+      data[i] = (uint8_t)rand();
+    }
+    memcpy(expect, cparams, cparams_size);
+    memcpy(&expect[cparams_size], data, data_size);
+    memset(rbuffer, 0, sizeof(rbuffer));
+
+    tick = HAL_GetTick();
+    ret = mipc_request_with_data(MIPC_API_SYS_ECHO_CMD, cparams, cparams_size, data, data_size,
+                                 rbuffer, &rbuffer_size, (mode == MODE_LATE) ? REQ_LATE_TIMEOUT : REQ_TIMEOUT);
+    if (ret == MIPC_CODE_SUCCESS) {
+      TEST_CHECK(rbuffer_size == (cparams_size + data_size));
+      TEST_CHECK(memcmp(rbuffer, expect, cparams_size + data_size) == 0);
+      if (mode == MODE_LATE) {
+        __atomic_fetch_add(&LateAnswers, 1U, __ATOMIC_RELAXED);
+      } else {
+        TEST_CHECK((HAL_GetTick() - tick) < REQ_LATENCY_MAX);
+      }
+      __atomic_fetch_add(&Answered, 1U, __ATOMIC_RELAXED);
+    } else {
+      TEST_CHECK(mode == MODE_LATE);
+      __atomic_fetch_add(&LateTimeouts, 1U, __ATOMIC_RELAXED);
+    }
+  }
+}
+
+/* All the request entries are free again and usable at the same time. */
+static void check_entries_free (void) {
+  mipc_req_handle_t handle[MX_WIFI_MAX_PENDING_REQUEST_COUNT];
+  uint8_t cparams[MX_WIFI_MAX_PENDING_REQUEST_COUNT][6];
+  uint8_t rbuffer[MX_WIFI_MAX_PENDING_REQUEST_COUNT][6];
+  uint16_t rbuffer_size[MX_WIFI_MAX_PENDING_REQUEST_COUNT];
+
+  for (uint32_t i = 0U; i < MX_WIFI_MAX_PENDING_REQUEST_COUNT; i++) {
+    memset(cparams[i], (int)i, sizeof(cparams[i]));
+    cparams[i][0] = MODE_PROMPT;
+    rbuffer_size[i] = (uint16_t)sizeof(rbuffer[i]);
+    TEST_CHECK(mipc_request_start(MIPC_API_SYS_ECHO_CMD, cparams[i], sizeof(cparams[i]), NULL, 0U,
+                                  rbuffer[i], &rbuffer_size[i], 0U, &handle[i]) == MIPC_CODE_SUCCESS);
+  }
+  for (uint32_t i = 0U; i < MX_WIFI_MAX_PENDING_REQUEST_COUNT; i++) {
+    TEST_CHECK(mipc_request_finish(handle[i], REQ_TIMEOUT) == MIPC_CODE_SUCCESS);
+    TEST_CHECK(memcmp(rbuffer[i], cparams[i], sizeof(cparams[i])) == 0);
+  }
+}
+
+static void run (mipc_sendv_func_t sendv) {
+  osThreadId_t req[REQ_THREADS];
+  osThreadId_t rx, emu[2];
+  emu_cmd_t *end = NULL;
+  mx_buf_pool_stat_t pool;
+
+  Stop = 0U;
+  TEST_CHECK(mipc_init(emu_send, sendv) == MIPC_CODE_SUCCESS);
+  EmuQueue[MODE_PROMPT] = osMessageQueueNew(64U, sizeof(emu_cmd_t *), NULL);
+  EmuQueue[MODE_LATE]   = osMessageQueueNew(64U, sizeof(emu_cmd_t *), NULL);
+  emu[MODE_PROMPT] = osThreadNew(emu_thread, (void *)(uintptr_t)MODE_PROMPT, NULL);
+  emu[MODE_LATE]   = osThreadNew(emu_thread, (void *)(uintptr_t)MODE_LATE, NULL);
+  rx = osThreadNew(rx_thread, NULL, NULL);
+
+  for (uint32_t i = 0U; i < REQ_THREADS; i++) {
+    req[i] = osThreadNew(req_thread, (void *)(uintptr_t)i, NULL);
+  }
+  for (uint32_t i = 0U; i < REQ_THREADS; i++) {
+    osThreadJoin(req[i]);
+  }
+
+  /* Let the late answers of timed out requests arrive, they must be dropped. */
+  osDelay(4U * REQ_LATE_TIMEOUT);
+  check_entries_free();
+
+  osMessageQueuePut(EmuQueue[MODE_PROMPT], &end, 0U, osWaitForever);
+  osMessageQueuePut(EmuQueue[MODE_LATE], &end, 0U, osWaitForever);
+  osThreadJoin(emu[MODE_PROMPT]);
+  osThreadJoin(emu[MODE_LATE]);
+  osDelay(20U);
+  Stop = 1U;
+  osThreadJoin(rx);
+  osMessageQueueDelete(EmuQueue[MODE_PROMPT]);
+  osMessageQueueDelete(EmuQueue[MODE_LATE]);
+  TEST_CHECK(mipc_deinit() == MIPC_CODE_SUCCESS);
+
+  mx_buf_pool_get_stat(&pool);
+  TEST_CHECK(pool.used == 0U);
+}
+
+int main (void) {
+  mipc_tx_stat_t tx;
+
+  srand(1U);
+  host_preempt(1U);
+  LOCK_INIT(WifiObj.lockcmd);
+
+  /* Commands copied into one buffer, then sent from the caller buffers. */
+  run(NULL);
+  run(emu_sendv);
+
+  mipc_get_tx_stat(&tx);
+  TEST_CHECK(tx.zero_copy > 0U);
+  TEST_CHECK(Answered > 0U);
+
+  fprintf(stderr, "answered %u, late answered %u, late timed out %u\n",
+         (unsigned)Answered, (unsigned)LateAnswers, (unsigned)LateTimeouts);
+
+  return TEST_RESULT("mx_wifi_ipc");
+}
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * mx_wifi SLIP encoder and decoder against the byte at a time reference.
+ *
+ * The references are the encoder and receive state machine the block
+ * versions replace. Equivalence: random payloads encoded at once and in
+ * random parts, and streams of frames with garbage, truncated and
+ * oversized frames decoded in random blocks. Fuzz: random streams rich in
+ * special characters. Throughput of both versions is reported.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "mx_wifi.h"
+#include "core/mx_wifi_ipc.h"
+#include "core/mx_wifi_slip.h"
+
+#include "test_host.h"
+
+#define SLIP_BUFFER_SIZE    (MIPC_PKT_MAX_SIZE + 100)   /* As in mx_wifi_slip.c */
+#define PAYLOAD_MAX         (MIPC_PKT_MAX_SIZE)
+#define ENCODE_RUNS         (5000U)
+#define STREAM_RUNS         (300U)
+#define STREAM_SIZE         (16384U)
+#define FUZZ_RUNS           (300U)
+#define FRAMES_MAX          (8192U)
+#define BENCH_SIZE          (1500U)
+#define BENCH_RUNS          (5000U)
+
+/* Decoded frames */
+typedef struct {
+  uint32_t count;
+  uint16_t len[FRAMES_MAX];
+  uint8_t *data[FRAMES_MAX];
+} frames_t;
+
+/* Reference SLIP encoder. */
+static uint16_t ref_encode (const uint8_t *data, uint16_t len, uint8_t *out) {
+  uint16_t j = 0U;
+
+  out[j++] = SLIP_START;
+  for (uint16_t i = 0U; i < len; i++) {
+    if (data[i] == SLIP_START) {
+      out[j++] = SLIP_ESCAPE;
+      out[j++] = SLIP_ESCAPE_START;
+    } else if (data[i] == SLIP_END) {
+      out[j++] = SLIP_ESCAPE;
+      out[j++] = SLIP_ESCAPE_END;
+    } else if (data[i] == SLIP_ESCAPE) {
+      out[j++] = SLIP_ESCAPE;
+      out[j++] = SLIP_ESCAPE_ES;
+    } else {
+      out[j++] = data[i];
+    }
+  }
+  out[j++] = SLIP_END;
+  return j;
+}
+
+/* Reference SLIP receive state machine. */
+static struct {
+  uint16_t state;
+  uint16_t index;
+  uint8_t  buffer[SLIP_BUFFER_SIZE];
+} RefRx;
+
+enum { REF_IDLE, REF_CONTINUE, REF_GOT_ESCAPE };
+
+static void frames_add (frames_t *frames, const uint8_t *data, uint16_t len) {
+  TEST_CHECK(frames->count < FRAMES_MAX);
+  if (frames->count < FRAMES_MAX) {
+    frames->data[frames->count] = malloc((len != 0U) ? len : 1U);
+    memcpy(frames->data[frames->count], data, len);
+    frames->len[frames->count] = len;
+    frames->count++;
+  }
+}
+
+static void frames_free (frames_t *frames) {
+  for (uint32_t i = 0U; i < frames->count; i++) {
+    free(frames->data[i]);
+  }
+  frames->count = 0U;
+}
+
+static void ref_input_byte (uint8_t data, frames_t *frames) {
+  uint32_t reset = 0U;
+
+  if (RefRx.index >= SLIP_BUFFER_SIZE) {
+    RefRx.index = 0U;
+    RefRx.state = REF_IDLE;
+  }
+
+  switch (RefRx.state) {
+    case REF_GOT_ESCAPE:
+      if (data == SLIP_START) {
+        RefRx.index = 0U;
+      } else if (data == SLIP_ESCAPE_START) {
+        RefRx.buffer[RefRx.index++] = SLIP_START;
+      } else if (data == SLIP_ESCAPE_ES) {
+        RefRx.buffer[RefRx.index++] = SLIP_ESCAPE;
+      } else if (data == SLIP_ESCAPE_END) {
+        RefRx.buffer[RefRx.index++] = SLIP_END;
+      } else {
+        reset = 1U;
+      }
+      if (reset == 0U) {
+        RefRx.state = REF_CONTINUE;
+      }
+      break;
+
+    case REF_IDLE:
+      if (data == SLIP_START) {
+        RefRx.index = 0U;
+        RefRx.state = REF_CONTINUE;
+      }
+      break;
+
+    default:
+      if (data == SLIP_START) {
+        RefRx.index = 0U;
+      } else if (data == SLIP_END) {
+        if (frames != NULL) {
+          frames_add(frames, RefRx.buffer, RefRx.index);
+        }
+        reset = 1U;
+      } else if (data == SLIP_ESCAPE) {
+        RefRx.state = REF_GOT_ESCAPE;
+      } else {
+        RefRx.buffer[RefRx.index++] = data;
+      }
+      break;
+  }
+
+  if (reset != 0U) {
+    RefRx.index = 0U;
+    RefRx.state = REF_IDLE;
+  }
+}
+
+static void ref_decode (const uint8_t *data, uint32_t len, frames_t *frames) {
+  for (uint32_t i = 0U; i < len; i++) {
+    ref_input_byte(data[i], frames);
+  }
+}
+
+/* Decode with slip_input_block, in random blocks (block_max 0) or fixed blocks. */
+static void block_decode (const uint8_t *data, uint32_t len, uint16_t block_max, frames_t *frames) {
+  uint32_t i = 0U;
+
+  while (i < len) {
+    uint16_t block = (block_max != 0U) ? block_max : (uint16_t)(1U + ((uint32_t)rand() % 700U));
+    uint16_t consumed;
+    mx_buf_t *nbuf;
+
+    if (block > (len - i)) {
+      block = (uint16_t)(len - i);
+    }
+    nbuf = slip_input_block(&data[i], block, &consumed);
+    TEST_CHECK(consumed <= block);
+    TEST_CHECK((consumed == block) || (nbuf != NULL));
+    i += consumed;
+    if (nbuf != NULL) {
+      if (frames != NULL) {
+        frames_add(frames, MX_NET_BUFFER_PAYLOAD(nbuf), (uint16_t)MX_NET_BUFFER_GET_PAYLOAD_SIZE(nbuf));
+      }
+      MX_NET_BUFFER_FREE(nbuf);
+    }
+  }
+}
+
+static void frames_check (const frames_t *a, const frames_t *b) {
+  TEST_CHECK(a->count == b->count);
+  for (uint32_t i = 0U; (i < a->count) && (i < b->count); i++) {
+    TEST_CHECK(a->len[i] == b->len[i]);
+    TEST_CHECK(memcmp(a->data[i], b->data[i], a->len[i]) == 0);
+  }
+}
+
+/* Random bytes, special characters with a probability of about 1/density. */
+static void random_payload (uint8_t *data, uint32_t len, uint32_t density) {
+  static const uint8_t special[] = { SLIP_START, SLIP_END, SLIP_ESCAPE,
+                                     SLIP_ESCAPE_START, SLIP_ESCAPE_ES, SLIP_ESCAPE_END };
+
+  for (uint32_t i = 0U; i < len; i++) {
+    if ((density != 0U) && (((uint32_t)rand() % density) == 0U)) {
+      data[i] = special[(uint32_t)rand() % sizeof(special)];
+    } else {
+      data[i] = (uint8_t)rand();
+    }
+  }
+}
+
+static void check_encode (void) {
+  static uint8_t data[PAYLOAD_MAX];
+  static uint8_t ref[(2U * PAYLOAD_MAX) + 2U];
+  static uint8_t out[(2U * PAYLOAD_MAX) + 2U];
+  static const uint32_t density[] = { 0U, 2U, 16U, 256U };
+
+  for (uint32_t n = 0U; n < ENCODE_RUNS; n++) {
+    const uint16_t len = (uint16_t)((uint32_t)rand() % (PAYLOAD_MAX + 1U));
+    const uint16_t ref_len = (random_payload(data, len, density[n % 4U]), ref_encode(data, len, ref));
+    slip_encoder_t enc;
+    uint16_t out_len = 0U;
+    uint16_t chunk;
+    uint16_t part;
+    uint8_t *frame;
+
+    TEST_CHECK(slip_encoded_size(data, len) == ref_len);
+
+    TEST_CHECK(slip_encode(data, len, out, ref_len) == ref_len);
+    TEST_CHECK(memcmp(out, ref, ref_len) == 0);
+    TEST_CHECK(slip_encode(data, len, out, (uint16_t)(ref_len - 1U)) == 0U);
+
+    /* Part by part in a small buffer, as mx_wifi_hci_send does. */
+    chunk = (uint16_t)(2U + ((uint32_t)rand() % 200U));
+    slip_encoder_init(&enc, data, len);
+    do {
+      part = slip_encode_next(&enc, &out[out_len], chunk);
+      TEST_CHECK((part > 0U) && (part <= chunk));
+      out_len += part;
+    } while (!slip_encoder_done(&enc) && (out_len < sizeof(out)));
+    TEST_CHECK(slip_encode_next(&enc, &out[out_len], chunk) == 0U);
+    TEST_CHECK(out_len == ref_len);
+    TEST_CHECK(memcmp(out, ref, ref_len) == 0);
+
+    frame = slip_transfer(data, len, &part);
+    TEST_CHECK((frame != NULL) && (part == ref_len));
+    if (frame != NULL) {
+      TEST_CHECK(memcmp(frame, ref, ref_len) == 0);
+      MX_WIFI_FREE(frame);
+    }
+  }
+}
+
+/* Build a stream of frames with garbage, truncated frames, bad escapes and oversized frames. */
+static uint32_t random_stream (uint8_t *stream, uint32_t size) {
+  static uint8_t data[SLIP_BUFFER_SIZE + 64U];
+  uint32_t len = 0U;
+
+  while (len < (size - (2U * sizeof(data)) - 2U)) {
+    const uint32_t kind = (uint32_t)rand() % 16U;
+    uint16_t plen = (uint16_t)((uint32_t)rand() % 300U);
+
+    if (kind == 0U) {
+      /* Garbage between frames */
+      random_payload(&stream[len], plen, 8U);
+      len += plen;
+    } else if (kind == 1U) {
+      /* Frame truncated before its END */
+      random_payload(data, plen, 16U);
+      len += ref_encode(data, plen, &stream[len]) - 1U;
+    } else if (kind == 2U) {
+      /* Invalid escape in the frame */
+      len += ref_encode(data, plen, &stream[len]) - 1U;
+      stream[len++] = SLIP_ESCAPE;
+      stream[len++] = (uint8_t)rand();
+    } else if (kind == 3U) {
+      /* Frame longer than the receive buffer */
+      plen = (uint16_t)(SLIP_BUFFER_SIZE - 4U + ((uint32_t)rand() % 64U));
+      random_payload(data, plen, 0U);
+      len += ref_encode(data, plen, &stream[len]);
+    } else {
+      random_payload(data, plen, (kind < 8U) ? 4U : 64U);
+      len += ref_encode(data, plen, &stream[len]);
+    }
+  }
+  return len;
+}
+
+static void check_decode (void) {
+  static uint8_t stream[STREAM_SIZE];
+  static frames_t ref, blk, one;
+
+  for (uint32_t n = 0U; n < STREAM_RUNS; n++) {
+    const uint32_t len = random_stream(stream, sizeof(stream));
+
+    memset(&RefRx, 0, sizeof(RefRx));
+    ref_decode(stream, len, &ref);
+    block_decode(stream, len, 0U, &blk);
+    frames_check(&ref, &blk);
+    TEST_CHECK(ref.count > 0U);
+
+    /* One byte at a time through the public byte interface, from idle again. */
+    block_decode((const uint8_t[]){ SLIP_END }, 1U, 1U, NULL);
+    for (uint32_t i = 0U; i < len; i++) {
+      mx_buf_t *nbuf = slip_input_byte(stream[i]);
+
+      if (nbuf != NULL) {
+        frames_add(&one, MX_NET_BUFFER_PAYLOAD(nbuf), (uint16_t)MX_NET_BUFFER_GET_PAYLOAD_SIZE(nbuf));
+        MX_NET_BUFFER_FREE(nbuf);
+      }
+    }
+    frames_check(&ref, &one);
+
+    frames_free(&ref);
+    frames_free(&blk);
+    frames_free(&one);
+
+    /* Both decoders end idle, the next stream starts clean. */
+    ref_decode((const uint8_t[]){ SLIP_END }, 1U, NULL);
+    block_decode((const uint8_t[]){ SLIP_END }, 1U, 1U, NULL);
+  }
+}
+
+/* Random streams rich in special characters, decoded in random blocks. */
+static void fuzz_decode (void) {
+  static uint8_t stream[STREAM_SIZE];
+  static frames_t ref, blk;
+
+  for (uint32_t n = 0U; n < FUZZ_RUNS; n++) {
+    const uint32_t len = 1U + ((uint32_t)rand() % sizeof(stream));
+
+    random_payload(stream, len, 1U + (n % 8U));
+    memset(&RefRx, 0, sizeof(RefRx));
+    ref_decode(stream, len, &ref);
+    block_decode(stream, len, 0U, &blk);
+    frames_check(&ref, &blk);
+    for (uint32_t i = 0U; i < blk.count; i++) {
+      TEST_CHECK(blk.len[i] <= SLIP_BUFFER_SIZE);
+    }
+    frames_free(&ref);
+    frames_free(&blk);
+
+    ref_decode((const uint8_t[]){ SLIP_END }, 1U, NULL);
+    block_decode((const uint8_t[]){ SLIP_END }, 1U, 1U, NULL);
+  }
+}
+
+static void bench (void) {
+  static uint8_t data[BENCH_SIZE];
+  static uint8_t stream[(2U * BENCH_SIZE) + 2U];
+  static uint8_t out[(2U * BENCH_SIZE) + 2U];
+  volatile uint32_t sink = 0U;
+  uint16_t stream_len;
+  uint64_t t0, t_ref_enc, t_enc, t_ref_dec, t_dec;
+
+  /* Network data: about one special character in 128 bytes */
+  random_payload(data, sizeof(data), 128U);
+  stream_len = ref_encode(data, sizeof(data), stream);
+
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    sink += ref_encode(data, sizeof(data), out);
+  }
+  t_ref_enc = test_time_ns() - t0;
+
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    slip_encoder_t enc;
+
+    slip_encoder_init(&enc, data, sizeof(data));
+    while (!slip_encoder_done(&enc)) {
+      sink += slip_encode_next(&enc, out, MX_WIFI_SLIP_TX_CHUNK_SIZE);
+    }
+  }
+  t_enc = test_time_ns() - t0;
+
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    ref_decode(stream, stream_len, NULL);
+  }
+  t_ref_dec = test_time_ns() - t0;
+
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    block_decode(stream, stream_len, MX_CIRCULAR_UART_RX_BUFFER_SIZE, NULL);
+  }
+  t_dec = test_time_ns() - t0;
+  (void)sink;
+
+  fprintf(stderr, "encode %.0f MB/s (reference %.0f MB/s), decode %.0f MB/s (reference %.0f MB/s)\n",
+          (1e3 * BENCH_RUNS * BENCH_SIZE) / (double)t_enc, (1e3 * BENCH_RUNS * BENCH_SIZE) / (double)t_ref_enc,
+          (1e3 * BENCH_RUNS * BENCH_SIZE) / (double)t_dec, (1e3 * BENCH_RUNS * BENCH_SIZE) / (double)t_ref_dec);
+}
+
+int main (void) {
+  mx_buf_pool_stat_t pool;
+
+  srand(1U);
+
+  check_encode();
+  check_decode();
+  fuzz_decode();
+  bench();
+
+  mx_buf_pool_get_stat(&pool);
+  TEST_CHECK(pool.used <= 1U);   /* Receive buffer of the next frame */
+
+  return TEST_RESULT("mx_wifi_slip");
+}
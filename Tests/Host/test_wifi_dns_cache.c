@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * WiFi_EMW3080 host name cache against an emulated module resolver.
+ *
+ * The module resolves a name to an address derived from the name and a
+ * generation count, so a refreshed address is told apart from the cached
+ * one. Host not found and timeouts are selected by the name. The tick
+ * count is moved forward to age the entries. Checked: hits, misses,
+ * negative caching, stale use with background refresh, least recently
+ * used replacement, names not cached, clear on deactivation, and
+ * concurrent lookups always returning the address of their own name.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "WiFi_EMW3080.h"
+#include "mx_wifi.h"
+
+#include "test_host.h"
+
+#define MODULE_DELAY        (2U)      /* Resolution time of the module in ms */
+#define LOOKUP_THREADS      (6U)
+#define LOOKUP_ITERATIONS   (3000U)
+#define LOOKUP_NAMES        (WIFI_EMW3080_DNS_CACHE_SIZE + 2)
+#define BENCH_RUNS          (100000U)
+
+extern ARM_DRIVER_WIFI ARM_Driver_WiFi_(WIFI_EMW3080_DRV_NUM);
+#define Drv ARM_Driver_WiFi_(WIFI_EMW3080_DRV_NUM)
+
+static volatile uint32_t ModuleQueries;
+static volatile uint32_t ModuleGeneration;
+static volatile uint32_t ModuleDelay = MODULE_DELAY;
+
+/* Address of a name: the first three bytes from the name, the last one the generation. */
+static void name_address (const char *name, uint32_t generation, uint8_t *ip) {
+  uint32_t hash = 2166136261U;
+
+  for (const char *p = name; *p != '\0'; p++) {
+    hash = (hash ^ (uint8_t)*p) * 16777619U;
+  }
+  ip[0] = (uint8_t)(10U + (hash % 200U));
+  ip[1] = (uint8_t)(hash >> 8);
+  ip[2] = (uint8_t)(hash >> 16);
+  ip[3] = (uint8_t)generation;
+}
+
+int32_t MX_WIFI_Socket_gethostbyname (MX_WIFIObject_t *Obj, struct mx_sockaddr *Addr, const mx_char_t *Name) {
+  struct mx_sockaddr_in *sa = (struct mx_sockaddr_in *)Addr;
+
+  (void)Obj;
+  __atomic_add_fetch(&ModuleQueries, 1U, __ATOMIC_SEQ_CST);
+  if (ModuleDelay != 0U) {
+    osDelay(ModuleDelay);
+  }
+  if (strncmp(Name, "unknown", 7U) == 0) {
+    return MX_WIFI_STATUS_ERROR;
+  }
+  if (strncmp(Name, "timeout", 7U) == 0) {
+    return MX_WIFI_STATUS_TIMEOUT;
+  }
+  memset(sa, 0, sizeof(*sa));
+  sa->sin_len    = (uint8_t)sizeof(*sa);
+  sa->sin_family = MX_AF_INET;
+  name_address(Name, ModuleGeneration, (uint8_t *)&sa->sin_addr);
+  return 0;
+}
+
+MX_WIFI_STATUS_T MX_WIFI_Disconnect (MX_WIFIObject_t *Obj) {
+  (void)Obj;
+  return MX_WIFI_STATUS_OK;
+}
+
+static int32_t lookup (const char *name, uint8_t *ip) {
+  uint32_t ip_len = 4U;
+  int32_t rc;
+
+  memset(ip, 0, 4U);
+  rc = Drv.SocketGetHostByName(name, ARM_SOCKET_AF_INET, ip, &ip_len);
+  if (rc == 0) {
+    TEST_CHECK(ip_len == 4U);
+  }
+  return rc;
+}
+
+/* Lookup resolved with the expected address and number of module queries. */
+static void check_lookup (const char *name, uint32_t generation, uint32_t queries) {
+  const uint32_t before = ModuleQueries;
+  uint8_t ip[4], expected[4];
+
+  name_address(name, generation, expected);
+  TEST_CHECK(lookup(name, ip) == 0);
+  TEST_CHECK(memcmp(ip, expected, 4U) == 0);
+  TEST_CHECK((ModuleQueries - before) == queries);
+}
+
+static WiFi_EMW3080_DnsCacheStats_t stats_get (void) {
+  WiFi_EMW3080_DnsCacheStats_t stats;
+
+  TEST_CHECK(WiFi_EMW3080_GetHostByNameCacheStats(&stats) == 0);
+  return stats;
+}
+
+/* Waits for the background refresh of the given count of entries. */
+static void wait_refresh (uint32_t refreshes) {
+  for (uint32_t n = 0U; (n < 1000U) && (stats_get().refreshes < refreshes); n++) {
+    osDelay(1U);
+  }
+  TEST_CHECK(stats_get().refreshes == refreshes);
+}
+
+static void check_hits (void) {
+  WiFi_EMW3080_DnsCacheStats_t stats;
+  uint8_t ip[4];
+
+  check_lookup("broker.example.com", 0U, 1U);
+  check_lookup("broker.example.com", 0U, 0U);
+  check_lookup("broker.example.com", 0U, 0U);
+
+  /* Host not found is remembered for the negative TTL. */
+  TEST_CHECK(lookup("unknown.example.com", ip) == ARM_SOCKET_EHOSTNOTFOUND);
+  TEST_CHECK(lookup("unknown.example.com", ip) == ARM_SOCKET_EHOSTNOTFOUND);
+  TEST_CHECK(ModuleQueries == 2U);
+  host_tick_advance(WIFI_EMW3080_DNS_CACHE_NEG_TTL);
+  TEST_CHECK(lookup("unknown.example.com", ip) == ARM_SOCKET_EHOSTNOTFOUND);
+  TEST_CHECK(ModuleQueries == 3U);
+
+  /* Failed requests are not cached. */
+  TEST_CHECK(lookup("timeout.example.com", ip) == ARM_SOCKET_ETIMEDOUT);
+  TEST_CHECK(lookup("timeout.example.com", ip) == ARM_SOCKET_ETIMEDOUT);
+  TEST_CHECK(ModuleQueries == 5U);
+
+  stats = stats_get();
+  TEST_CHECK(stats.hits == 2U);
+  TEST_CHECK(stats.negative_hits == 1U);
+  TEST_CHECK(stats.misses == 5U);
+  TEST_CHECK(stats.evictions == 0U);
+}
+
+static void check_refresh (void) {
+  const uint32_t refreshes = stats_get().refreshes;
+  const uint32_t queries   = ModuleQueries;
+  uint8_t ip[4], expected[4];
+
+  /* Expired address is returned at once and refreshed in the background. */
+  ModuleGeneration = 1U;
+  host_tick_advance(WIFI_EMW3080_DNS_CACHE_TTL);
+  name_address("broker.example.com", 0U, expected);
+  TEST_CHECK(lookup("broker.example.com", ip) == 0);
+  TEST_CHECK(memcmp(ip, expected, 4U) == 0);
+  TEST_CHECK(stats_get().stale_hits == 1U);
+  wait_refresh(refreshes + 1U);
+  TEST_CHECK(ModuleQueries == (queries + 1U));
+  check_lookup("broker.example.com", 1U, 0U);
+
+  /* Not used within twice the TTL: resolved again before it is returned. */
+  ModuleGeneration = 2U;
+  host_tick_advance(2U * WIFI_EMW3080_DNS_CACHE_TTL);
+  check_lookup("broker.example.com", 2U, 1U);
+  check_lookup("broker.example.com", 2U, 0U);
+  TEST_CHECK(stats_get().refreshes == (refreshes + 1U));
+}
+
+static void check_replace (void) {
+  char name[WIFI_EMW3080_DNS_CACHE_NAME_LEN + 8];
+  WiFi_EMW3080_DnsCacheStats_t before;
+  const uint32_t generation = ModuleGeneration;
+
+  /* Fill the cache, the first name is used again and stays, the second is replaced. */
+  before = stats_get();
+  for (int32_t i = 0; i < WIFI_EMW3080_DNS_CACHE_SIZE; i++) {
+    snprintf(name, sizeof(name), "host%d.example.com", (int)i);
+    check_lookup(name, generation, 1U);
+  }
+  check_lookup("host0.example.com", generation, 0U);
+  check_lookup("new.example.com", generation, 1U);
+  check_lookup("host0.example.com", generation, 0U);
+  check_lookup("host1.example.com", generation, 1U);
+  TEST_CHECK(stats_get().evictions > before.evictions);
+
+  /* Names not fitting the cache entry are always resolved by the module. */
+  memset(name, 'a', WIFI_EMW3080_DNS_CACHE_NAME_LEN);
+  name[WIFI_EMW3080_DNS_CACHE_NAME_LEN] = '\0';
+  check_lookup(name, generation, 1U);
+  check_lookup(name, generation, 1U);
+
+  /* Deactivation forgets the names of the previous network. */
+  (void)Drv.Deactivate(0U);
+  check_lookup("host0.example.com", generation, 1U);
+}
+
+/* Concurrent lookups of more names than the cache holds, while the addresses expire. */
+static void lookup_thread (void *arg) {
+  char name[32];
+  uint8_t ip[4], expected[4];
+
+  (void)arg;
+  for (uint32_t n = 0U; n < LOOKUP_ITERATIONS; n++) {
+    const int32_t i = rand() % LOOKUP_NAMES;
+
+    snprintf(name, sizeof(name), "node%d.example.com", (int)i);
+    name_address(name, 0U, expected);
+    TEST_CHECK(lookup(name, ip) == 0);
+    TEST_CHECK(memcmp(ip, expected, 3U) == 0);
+    if ((n % 500U) == 0U) {
+      host_tick_advance(WIFI_EMW3080_DNS_CACHE_TTL / 2U);
+    }
+  }
+}
+
+static void check_concurrent (void) {
+  osThreadId_t thread[LOOKUP_THREADS];
+  WiFi_EMW3080_DnsCacheStats_t stats;
+
+  ModuleDelay = 0U;
+  host_preempt(1U);
+  for (uint32_t i = 0U; i < LOOKUP_THREADS; i++) {
+    thread[i] = osThreadNew(lookup_thread, NULL, NULL);
+  }
+  for (uint32_t i = 0U; i < LOOKUP_THREADS; i++) {
+    osThreadJoin(thread[i]);
+  }
+  host_preempt(0U);
+  ModuleDelay = MODULE_DELAY;
+
+  stats = stats_get();
+  fprintf(stderr, "hits %u, stale hits %u, negative hits %u, misses %u, refreshes %u, evictions %u\n",
+          (unsigned)stats.hits, (unsigned)stats.stale_hits, (unsigned)stats.negative_hits,
+          (unsigned)stats.misses, (unsigned)stats.refreshes, (unsigned)stats.evictions);
+}
+
+static void bench (void) {
+  uint8_t ip[4];
+  uint64_t t0, t_hit, t_miss;
+
+  (void)lookup("bench.example.com", ip);
+  t0 = test_time_ns();
+  for (uint32_t n = 0U; n < BENCH_RUNS; n++) {
+    (void)lookup("bench.example.com", ip);
+  }
+  t_hit = test_time_ns() - t0;
+
+  t0 = test_time_ns();
+  (void)lookup("timeout.example.com", ip);
+  t_miss = test_time_ns() - t0;
+
+  fprintf(stderr, "lookup cached %.2f us, module %.2f us\n",
+          (double)t_hit / (1000.0 * BENCH_RUNS), (double)t_miss / 1000.0);
+}
+
+int main (void) {
+  srand(1U);
+
+  TEST_CHECK(Drv.Initialize(NULL) == ARM_DRIVER_OK);
+
+  check_hits();
+  check_refresh();
+  check_replace();
+  check_concurrent();
+  bench();
+
+  TEST_CHECK(Drv.Uninitialize() == ARM_DRIVER_OK);
+
+  return TEST_RESULT("wifi_dns_cache");
+}